@@ -0,0 +1,84 @@
+#include "Analitice.h"
+#include "GeneratoareDate.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+const DateSintetice& dateAnalitice() {
+    static const auto date = genereazaDateSintetice(100'000, 10'000, 1'000'000);
+    return *date;
+}
+
+// Costul adăugat fiecărui împrumut creat: schița, tabelul facultate × lună și cele două HyperLogLog
+void BM_Analitice_ImprumutCreat(benchmark::State& state) {
+    const auto& imprumuturi = dateAnalitice().imprumuturi;
+    AnaliticeImprumuturi agregate;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto& imprumut = *imprumuturi[i];
+        agregate.imprumutCreat(imprumut.getIdCarte(), imprumut.getUtilizator(), imprumut.getDataImprumut());
+        i = i + 1 == imprumuturi.size() ? 0 : i + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Analitice_ImprumutCreat);
+
+// Raportul complet din agregatele ținute la zi: top 10, tabelul pe luni, penalități, cititori distincti
+void BM_Analitice_RaportIncremental(benchmark::State& state) {
+    const auto& imprumuturi = dateAnalitice().imprumuturi;
+    AnaliticeImprumuturi agregate;
+    for (const auto& imprumut : imprumuturi) {
+        agregate.imprumutCreat(imprumut->getIdCarte(), imprumut->getUtilizator(), imprumut->getDataImprumut());
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(agregate.topCarti(10));
+        benchmark::DoNotOptimize(agregate.peFacultatiSiLuni());
+        benchmark::DoNotOptimize(agregate.penalitati(TipUtilizator::Student));
+        benchmark::DoNotOptimize(agregate.cititoriDistincti());
+    }
+}
+BENCHMARK(BM_Analitice_RaportIncremental)->Unit(benchmark::kMicrosecond);
+
+// Referință: același raport, exact, dintr-o parcurgere completă a împrumuturilor
+void BM_Analitice_RaportScanare(benchmark::State& state) {
+    const auto& imprumuturi = dateAnalitice().imprumuturi;
+    for (auto _ : state) {
+        std::unordered_map<IdCarte, std::uint64_t> carti;
+        std::unordered_map<std::uint64_t, std::uint64_t> facultateLuna;
+        std::unordered_set<std::string_view> cititori;
+        double penalitatiStudenti = 0;
+        for (const auto& imprumut : imprumuturi) {
+            const auto& utilizator = imprumut->getUtilizator();
+            ++carti[imprumut->getIdCarte()];
+            ++facultateLuna[std::uint64_t{utilizator.getIdFacultateDepartament()} << 32
+                            | static_cast<std::uint32_t>(imprumut->getDataImprumut().getIndexLuna())];
+            cititori.insert(utilizator.getEmail());
+            if (utilizator.getTip() == TipUtilizator::Student) {
+                penalitatiStudenti += imprumut->getPenalitateAplicata();
+            }
+        }
+        std::vector<std::pair<std::uint64_t, IdCarte>> top;
+        top.reserve(carti.size());
+        for (const auto& [id, numar] : carti) {
+            top.emplace_back(numar, id);
+        }
+        std::partial_sort(top.begin(), top.begin() + std::min<std::ptrdiff_t>(10, static_cast<std::ptrdiff_t>(top.size())), top.end(),
+                          [](const auto& a, const auto& b) { return a.first > b.first; });
+        benchmark::DoNotOptimize(top.data());
+        benchmark::DoNotOptimize(facultateLuna.size());
+        benchmark::DoNotOptimize(cititori.size());
+        benchmark::DoNotOptimize(penalitatiStudenti);
+    }
+}
+BENCHMARK(BM_Analitice_RaportScanare)->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -0,0 +1,16 @@
+#include <benchmark/benchmark.h>
+
+// Ca BENCHMARK_MAIN(), plus commit-ul măsurat în contextul rezultatelor (--benchmark_out=... JSON/CSV),
+// ca rulările de pe ramuri diferite să poată fi comparate
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+#ifdef BIBLIOTECA_COMMIT
+    benchmark::AddCustomContext("commit", BIBLIOTECA_COMMIT);
+#endif
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include "Biblioteca.h"
+#include "GeneratoareDate.h"
+#include "Imprumut.h"
+#include "Utilizator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// Căile din meniu cap-coadă, pe datele din GeneratoareDate, la mai multe scări
+namespace {
+
+// Aruncă tot ce se scrie; afișările se măsoară fără costul terminalului
+class BufferNul : public std::streambuf {
+protected:
+    int_type overflow(int_type c) override { return traits_type::not_eof(c); }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+// Redirecționează cout cât trăiește obiectul
+class CoutRedirectionat {
+    BufferNul buffer;
+    std::streambuf* vechi;
+
+public:
+    CoutRedirectionat() : vechi(std::cout.rdbuf(&buffer)) {}
+    ~CoutRedirectionat() { std::cout.rdbuf(vechi); }
+};
+
+// Căutarea după email din registrul global, jumătate găsite, jumătate lipsă
+void BM_Utilizator_CautaUtilizator(benchmark::State& state) {
+    const auto numar = static_cast<std::size_t>(state.range(0));
+    const std::string prefix = "cauta" + std::to_string(numar) + "-";
+    std::vector<std::string> emailuri;
+    emailuri.reserve(numar);
+    for (std::size_t i = 0; i < numar; ++i) {
+        emailuri.push_back(emailSintetic(prefix, i));
+        Utilizator::getRegistru().adauga(std::make_shared<Student>("Student", emailuri.back(), "FMI"));
+    }
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<std::size_t> distributie(0, numar - 1);
+    const std::string lipsa = emailSintetic("lipsa", 0);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Utilizator::cautaUtilizator(++i & 1 ? emailuri[distributie(rng)] : lipsa));
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    for (const auto& email : emailuri) {
+        Utilizator::getRegistru().sterge(email);
+    }
+}
+BENCHMARK(BM_Utilizator_CautaUtilizator)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+
+// Opțiunea 3 din meniu: titlu -> carte prin index, email -> utilizator, apoi împrumutul prin fabrică
+void BM_Imprumut_CreareDinMeniu(benchmark::State& state) {
+    const auto numar = static_cast<std::size_t>(state.range(0));
+    const auto date = genereazaDateSintetice(numar, 1000, 0);
+    const std::string prefix = "meniu" + std::to_string(numar) + "-";
+    std::vector<std::string> titluri, emailuri;
+    for (std::size_t i = 0; i < 1024; ++i) {
+        titluri.push_back(titluSintetic(i * numar / 1024));
+        emailuri.push_back(emailSintetic(prefix, i));
+        Utilizator::getRegistru().adauga(std::make_shared<Student>("Student", emailuri.back(), "FMI"));
+    }
+
+    const DataZi imprumut = DataZi::dinCalendar(2024, 3, 1);
+    std::vector<std::shared_ptr<ImprumutAbstract>> imprumuturi;
+    imprumuturi.reserve(1 << 20);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto intrare = date->index.cauta(titluri[i & 1023]);
+        const auto utilizator = Utilizator::cautaUtilizator(emailuri[i & 1023]);
+        imprumuturi.push_back(ImprumutFactory::creareImprumut(date->catalog[intrare->id], *utilizator, imprumut, imprumut + 21));
+        if (++i % (1 << 20) == 0) {
+            state.PauseTiming(); // istoricul utilizatorilor crește oricum; ținem doar memoria împrumuturilor în frâu
+            imprumuturi.clear();
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    imprumuturi.clear();
+    for (const auto& email : emailuri) {
+        Utilizator::getRegistru().sterge(email);
+    }
+}
+BENCHMARK(BM_Imprumut_CreareDinMeniu)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+
+// Penalitățile la o dată de returnare, împrumut cu împrumut, pe un set amestecat de cărți și utilizatori
+void BM_Imprumut_CalculeazaPenalitate(benchmark::State& state) {
+    const auto numar = static_cast<std::size_t>(state.range(0));
+    const auto date = genereazaDateSintetice(10'000, 1000, numar);
+    const DataZi returnare = DataZi::dinCalendar(2024, 1, 15);
+    for (auto _ : state) {
+        double total = 0;
+        for (const auto& imprumut : date->imprumuturi) {
+            total += imprumut->calculeazaPenalitate(returnare);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(numar));
+}
+BENCHMARK(BM_Imprumut_CalculeazaPenalitate)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+
+// Opțiunea 8 din meniu: istoricul unui utilizator cu N împrumuturi, titlurile rezolvate din catalog
+void BM_Utilizator_AfiseazaIstoric(benchmark::State& state) {
+    const auto numar = static_cast<std::size_t>(state.range(0));
+    const auto date = genereazaDateSintetice(10'000, 1, numar);
+    const CoutRedirectionat redirectionare;
+    for (auto _ : state) {
+        date->utilizatori.front()->afiseazaIstoriculImprumuturilor(date->catalog);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(numar));
+}
+BENCHMARK(BM_Utilizator_AfiseazaIstoric)->RangeMultiplier(10)->Range(10, 1000);
+
+} // namespace
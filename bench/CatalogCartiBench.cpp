@@ -0,0 +1,125 @@
+#include "CatalogCarti.h"
+#include "GeneratoareDate.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Filtru pe an peste vechea reprezentare: un pointer urmărit pentru fiecare carte
+void BM_FiltruAn_VectorSharedPtr(benchmark::State& state) {
+    const auto numar = static_cast<std::size_t>(state.range(0));
+    std::vector<std::shared_ptr<Carte>> carti;
+    carti.reserve(numar);
+    for (std::size_t i = 0; i < numar; ++i) {
+        carti.push_back(carteSintetica(i));
+    }
+    for (auto _ : state) {
+        std::size_t gasite = 0;
+        for (const auto& carte : carti) {
+            gasite += carte->getAnPublicare() >= 1990 && carte->getAnPublicare() <= 2000;
+        }
+        benchmark::DoNotOptimize(gasite);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(numar));
+}
+BENCHMARK(BM_FiltruAn_VectorSharedPtr)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+
+void BM_FiltruAn_CatalogColoane(benchmark::State& state) {
+    const auto numar = static_cast<std::size_t>(state.range(0));
+    CatalogCarti catalog;
+    catalog.rezerva(numar);
+    for (std::size_t i = 0; i < numar; ++i) {
+        catalog.adauga(*carteSintetica(i));
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(catalog.cautaDupaAn(1990, 2000));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(numar));
+    state.counters["octeti_per_carte"] = static_cast<double>(catalog.memorieOcupata()) / static_cast<double>(numar);
+}
+BENCHMARK(BM_FiltruAn_CatalogColoane)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+
+// Costul publicării unei versiuni după fiecare carte adăugată. Argument: 0 fără publicare, 1 cu
+void BM_VersiuneCatalog_AdaugaSiPublica(benchmark::State& state) {
+    constexpr std::size_t numar = 100'000;
+    std::vector<std::shared_ptr<Carte>> carti;
+    for (std::size_t i = 0; i < numar; ++i) {
+        carti.push_back(carteSintetica(i));
+    }
+    for (auto _ : state) {
+        CatalogCarti catalog;
+        for (const auto& carte : carti) {
+            catalog.adauga(*carte);
+            if (state.range(0)) {
+                catalog.publica();
+            }
+        }
+        benchmark::DoNotOptimize(catalog.size());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(numar));
+}
+BENCHMARK(BM_VersiuneCatalog_AdaugaSiPublica)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// Adăugări cât un alt fir parcurge în buclă tot catalogul (un export). Argument: 0 - parcurgerea ține
+// un shared_mutex, iar adăugarea o blocare exclusivă, ca înainte; 1 - parcurgerea fixează o versiune,
+// iar adăugarea nu așteaptă nimic
+void BM_VersiuneCatalog_AdaugariInTimpulParcurgerii(benchmark::State& state) {
+    const bool cuVersiuni = state.range(0) != 0;
+    constexpr std::size_t initiale = 200'000;
+    CatalogCarti catalog;
+    catalog.rezerva(initiale);
+    for (std::size_t i = 0; i < initiale; ++i) {
+        catalog.adauga(*carteSintetica(i));
+    }
+    catalog.publica();
+
+    std::shared_mutex mutexCatalog;
+    std::atomic<bool> gata{false};
+    std::atomic<std::size_t> parcurgeri{0};
+    std::thread cititor([&] {
+        while (!gata.load(std::memory_order_relaxed)) {
+            std::size_t caractere = 0;
+            if (cuVersiuni) {
+                const auto versiune = catalog.versiune();
+                for (const auto carte : *versiune) {
+                    caractere += carte.getTitlu().size();
+                }
+            } else {
+                const std::shared_lock<std::shared_mutex> blocare(mutexCatalog);
+                for (const auto carte : catalog) {
+                    caractere += carte.getTitlu().size();
+                }
+            }
+            benchmark::DoNotOptimize(caractere);
+            parcurgeri.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    std::size_t urmatoarea = initiale;
+    for (auto _ : state) {
+        const auto carte = carteSintetica(urmatoarea++);
+        if (cuVersiuni) {
+            catalog.adauga(*carte);
+            catalog.publica();
+        } else {
+            const std::unique_lock<std::shared_mutex> blocare(mutexCatalog);
+            catalog.adauga(*carte);
+        }
+    }
+    gata.store(true, std::memory_order_relaxed);
+    cititor.join();
+    state.counters["parcurgeri"] = static_cast<double>(parcurgeri.load());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_VersiuneCatalog_AdaugariInTimpulParcurgerii)->Arg(0)->Arg(1)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,47 @@
+#include "Formatare.h"
+#include "GeneratoareDate.h"
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <memory>
+
+namespace {
+
+const DateSintetice& dateListare() {
+    static const auto date = genereazaDateSintetice(1'000'000, 1, 0);
+    return *date;
+}
+
+// Referință: vechea afișare, cu endl (deci un flush și un apel de sistem) după fiecare linie
+void BM_Listare_OstreamEndl(benchmark::State& state) {
+    const auto& catalog = dateListare().catalog;
+    std::ofstream nul("/dev/null");
+    for (auto _ : state) {
+        for (const auto carte : catalog) {
+            nul << "Titlu: " << carte.getTitlu() << ", Autor: " << carte.getAutor() << ", An publicare: " << carte.getAnPublicare() << std::endl;
+            if (carte.getTip() == TipCarte::Fizica) {
+                nul << "Numar pagini: " << carte.getNumarPagini() << ", Stare fizica: " << carte.getStareFizica() << std::endl;
+            } else {
+                nul << "Dimensiune fisier: " << carte.getDimensiuneFisier() << " MB, Format: " << carte.getFormat() << std::endl;
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(catalog.size()));
+}
+BENCHMARK(BM_Listare_OstreamEndl)->Unit(benchmark::kMillisecond);
+
+// Argument: FormatListare (0 text, 1 csv, 2 json)
+void BM_Listare_Cursor(benchmark::State& state) {
+    const auto& catalog = dateListare().catalog;
+    std::ofstream nul("/dev/null", std::ios::binary);
+    const auto formatator = Formatator::creeaza(static_cast<FormatListare>(state.range(0)));
+    for (auto _ : state) {
+        IesireBufferata iesire(nul, 1 << 20);
+        CursorCatalog(catalog.versiune(), *formatator, iesire).scrieTot(64 * 1024);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(catalog.size()));
+}
+BENCHMARK(BM_Listare_Cursor)->DenseRange(0, 2)->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -0,0 +1,56 @@
+#include "GeneratoareDate.h"
+
+#include <random>
+
+std::string titluSintetic(std::size_t i) {
+    return "Titlu carte " + std::to_string(i * 2654435761u % 1000000007u);
+}
+
+std::shared_ptr<Carte> carteSintetica(std::size_t i) {
+    const std::string titlu = titluSintetic(i);
+    const std::string autor = "Autor " + std::to_string(i % 50'000);
+    const int an = 1900 + static_cast<int>(i % 125);
+    if (i % 3 == 0) {
+        return std::make_shared<CarteDigitala>(titlu, autor, an, 1.5f, i % 2 ? "PDF" : "EPUB");
+    }
+    return std::make_shared<CarteFizica>(titlu, autor, an, 100 + static_cast<int>(i % 900), i % 7 ? "buna" : "uzata");
+}
+
+std::string emailSintetic(std::string_view prefix, std::size_t i) {
+    return std::string(prefix) + std::to_string(i) + "@exemplu.ro";
+}
+
+std::unique_ptr<DateSintetice> genereazaDateSintetice(std::size_t numarCarti, std::size_t numarUtilizatori,
+                                             std::size_t numarImprumuturi, std::uint32_t samanta) {
+    auto date = std::make_unique<DateSintetice>();
+    date->catalog.rezerva(numarCarti);
+    for (std::size_t i = 0; i < numarCarti; ++i) {
+        date->catalog.adauga(*carteSintetica(i));
+    }
+    date->catalog.publica();
+    date->index.reconstruieste();
+
+    date->utilizatori.reserve(numarUtilizatori);
+    for (std::size_t i = 0; i < numarUtilizatori; ++i) {
+        const std::string email = emailSintetic("sintetic", i);
+        if (i % 10 == 0) {
+            date->utilizatori.push_back(std::make_shared<Profesor>("Profesor " + std::to_string(i), email, "Informatica"));
+        } else {
+            date->utilizatori.push_back(std::make_shared<Student>("Student " + std::to_string(i), email, "FMI"));
+        }
+    }
+
+    std::mt19937 rng(samanta);
+    std::uniform_int_distribution<std::size_t> carte(0, numarCarti - 1);
+    std::uniform_int_distribution<std::size_t> utilizator(0, numarUtilizatori - 1);
+    std::uniform_int_distribution<int> zi(0, 729);
+    std::uniform_int_distribution<int> durata(1, 60);
+    const DataZi inceput = DataZi::dinCalendar(2022, 1, 1);
+    date->imprumuturi.reserve(numarImprumuturi);
+    for (std::size_t i = 0; i < numarImprumuturi && numarCarti > 0 && numarUtilizatori > 0; ++i) {
+        const DataZi imprumut = inceput + zi(rng);
+        date->imprumuturi.push_back(ImprumutFactory::creareImprumut(
+            date->catalog[static_cast<IdCarte>(carte(rng))], *date->utilizatori[utilizator(rng)], imprumut, imprumut + durata(rng)));
+    }
+    return date;
+}
@@ -0,0 +1,40 @@
+#ifndef OOP_GENERATOARE_DATE_H
+#define OOP_GENERATOARE_DATE_H
+
+#include "CatalogCarti.h"
+#include "Imprumut.h"
+#include "IndexTitluri.h"
+#include "Utilizator.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Date sintetice deterministe pentru benchmark-uri: aceeași sămânță dă aceleași date la fiecare rulare
+
+// Titluri unice, în ordine pseudo-aleatoare (nu sortate după i)
+std::string titluSintetic(std::size_t i);
+
+// Cărți fizice și digitale amestecate; 50k de autori, ani 1900-2024, o carte fizică din 7 uzată
+std::shared_ptr<Carte> carteSintetica(std::size_t i);
+
+// Emailuri unice; prefixul separă seturile care ajung în registrul global
+std::string emailSintetic(std::string_view prefix, std::size_t i);
+
+// Catalog + index + utilizatori + împrumuturi. Utilizatorii nu sunt trecuți în registrul global,
+// deci se pot genera oricâte seturi în același proces
+struct DateSintetice {
+    CatalogCarti catalog;
+    IndexTitluri index{catalog};
+    std::vector<std::shared_ptr<Utilizator>> utilizatori;
+    std::vector<std::shared_ptr<ImprumutAbstract>> imprumuturi;
+};
+
+// Împrumuturile aleg cartea și utilizatorul uniform, cu date în 2022-2023 și 1-60 de zile de împrumut
+std::unique_ptr<DateSintetice> genereazaDateSintetice(std::size_t numarCarti, std::size_t numarUtilizatori,
+                                             std::size_t numarImprumuturi, std::uint32_t samanta = 42);
+
+#endif //OOP_GENERATOARE_DATE_H
@@ -0,0 +1,49 @@
+#include "ImportDate.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+namespace {
+
+// Fișier de test cu `numar` cărți; un rând din 1000 este invalid
+std::string genereazaFisierCarti(std::size_t numar, FormatImport format) {
+    const std::string cale = format == FormatImport::Csv ? "biblioteca_bench_carti.csv" : "biblioteca_bench_carti.jsonl";
+    std::ofstream fisier(cale, std::ios::binary);
+    if (format == FormatImport::Csv) {
+        fisier << "tip,titlu,autor,anPublicare,numarPagini,stareFizica,dimensiuneFisier,format\n";
+    }
+    for (std::size_t i = 0; i < numar; ++i) {
+        const bool fizica = i % 3 != 0;
+        const std::string an = i % 1000 == 999 ? "x" : std::to_string(1900 + i % 125);
+        if (format == FormatImport::Csv) {
+            fisier << (fizica ? "Fizica" : "Digitala") << ",\"Titlu, carte " << i << "\",Autor " << i % 50'000 << ','
+                   << an << ',' << (fizica ? "250,buna,," : ",,1.5,PDF") << '\n';
+        } else {
+            fisier << "{\"tip\":\"" << (fizica ? "Fizica" : "Digitala") << "\",\"titlu\":\"Titlu \\\"carte\\\" " << i
+                   << "\",\"autor\":\"Autor " << i % 50'000 << "\",\"anPublicare\":\"" << an << "\","
+                   << (fizica ? "\"numarPagini\":250,\"stareFizica\":\"buna\"}" : "\"dimensiuneFisier\":1.5,\"format\":\"PDF\"}") << '\n';
+        }
+    }
+    return cale;
+}
+
+// Import de 1M de cărți în singleton, după numărul de fire de parsare; catalogul crește de la o rulare la alta
+void BM_ImportCarti(benchmark::State& state, FormatImport format) {
+    const std::size_t numar = 1'000'000;
+    const std::string cale = genereazaFisierCarti(numar, format);
+    const ImportDate import(static_cast<unsigned>(state.range(0)));
+    for (auto _ : state) {
+        const auto raport = import.importaCarti(cale, BibliotecaSingleton::getInstance());
+        state.counters["randuri_pe_secunda"] = raport.randuriPeSecunda();
+        state.counters["invalide"] = static_cast<double>(raport.randuriInvalide);
+    }
+    std::remove(cale.c_str());
+}
+BENCHMARK_CAPTURE(BM_ImportCarti, csv, FormatImport::Csv)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ImportCarti, jsonl, FormatImport::Jsonl)->Arg(1)->Arg(4)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -0,0 +1,111 @@
+#include "Imprumut.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Creare și eliberare de împrumuturi prin fabrică (pool dedicat) față de make_shared (heap general).
+// Se creează câte 100k deodată, ca alocatorul să lucreze cu mulți vecini vii, nu cu un singur slot refolosit
+constexpr std::size_t imprumuturiPeLot = 100'000;
+
+void BM_Imprumut_CreareFabricaPool(benchmark::State& state) {
+    CatalogCarti catalog;
+    const CarteView carte = catalog[catalog.adauga(CarteFizica("Titlu", "Autor", 2000, 200, "buna"))];
+    Student student("Student", "bench-imprumut-pool@exemplu.ro", "Facultate");
+    std::vector<std::shared_ptr<ImprumutAbstract>> imprumuturi;
+    imprumuturi.reserve(imprumuturiPeLot);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < imprumuturiPeLot; ++i) {
+            imprumuturi.push_back(ImprumutFactory::creareImprumut(carte, student, DataZi(19000), DataZi(19014)));
+        }
+        imprumuturi.clear();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * imprumuturiPeLot));
+}
+BENCHMARK(BM_Imprumut_CreareFabricaPool)->Unit(benchmark::kMillisecond);
+
+void BM_Imprumut_CreareMakeShared(benchmark::State& state) {
+    CatalogCarti catalog;
+    const CarteView carte = catalog[catalog.adauga(CarteFizica("Titlu", "Autor", 2000, 200, "buna"))];
+    Student student("Student", "bench-imprumut-heap@exemplu.ro", "Facultate");
+    std::vector<std::shared_ptr<ImprumutAbstract>> imprumuturi;
+    imprumuturi.reserve(imprumuturiPeLot);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < imprumuturiPeLot; ++i) {
+            imprumuturi.push_back(std::make_shared<ImprumutCarteFizica>(DataZi(19000), DataZi(19014), carte, student));
+        }
+        imprumuturi.clear();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * imprumuturiPeLot));
+}
+BENCHMARK(BM_Imprumut_CreareMakeShared)->Unit(benchmark::kMillisecond);
+
+// Doar id-ul: un fir atinge contorul comun o dată la AlocatorIduri::dimensiuneBloc id-uri
+void BM_Imprumut_GenereazaIdConcurent(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ImprumutAbstract::genereazaID());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Imprumut_GenereazaIdConcurent)->ThreadRange(1, 8)->UseRealTime();
+
+// Împrumuturi create din mai multe fire, ca de la mai multe ghișee: fiecare fir are utilizatorul lui,
+// cartea e comună. Debitul ar trebui să crească aproape liniar cu numărul de nuclee
+void BM_Imprumut_CreareConcurenta(benchmark::State& state) {
+    static CatalogCarti catalog;
+    static const IdCarte idCarte = catalog.adauga(CarteFizica("Titlu", "Autor", 2000, 200, "buna"));
+    const CarteView carte = catalog[idCarte];
+    Student student("Student", "bench-imprumut-fir" + std::to_string(state.thread_index()) + "@exemplu.ro", "Facultate");
+    std::vector<std::shared_ptr<ImprumutAbstract>> imprumuturi;
+    imprumuturi.reserve(1024);
+    for (auto _ : state) {
+        imprumuturi.push_back(ImprumutFactory::creareImprumut(carte, student, DataZi(19000), DataZi(19014)));
+        if (imprumuturi.size() == 1024) {
+            imprumuturi.clear();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Imprumut_CreareConcurenta)->ThreadRange(1, 8)->UseRealTime();
+
+// Test de stres: fire care creează simultan id-uri; toate trebuie să fie distincte
+void BM_Imprumut_IduriUnice(benchmark::State& state) {
+    const auto numarFire = static_cast<std::size_t>(state.range(0));
+    constexpr std::size_t iduriPeFir = 200'000;
+    for (auto _ : state) {
+        std::vector<std::vector<IdImprumut>> iduri(numarFire);
+        {
+            std::vector<std::jthread> fire;
+            for (auto& iduriFir : iduri) {
+                fire.emplace_back([&iduriFir] {
+                    iduriFir.reserve(iduriPeFir);
+                    for (std::size_t i = 0; i < iduriPeFir; ++i) {
+                        iduriFir.push_back(ImprumutAbstract::genereazaID());
+                    }
+                });
+            }
+        }
+        state.PauseTiming();
+        std::vector<IdImprumut> toate;
+        for (const auto& iduriFir : iduri) {
+            toate.insert(toate.end(), iduriFir.begin(), iduriFir.end());
+        }
+        std::sort(toate.begin(), toate.end());
+        if (std::adjacent_find(toate.begin(), toate.end()) != toate.end()) {
+            state.SkipWithError("id duplicat");
+            break;
+        }
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * numarFire * iduriPeFir));
+}
+BENCHMARK(BM_Imprumut_IduriUnice)->RangeMultiplier(2)->Range(1, 8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,73 @@
+#include "CatalogCarti.h"
+#include "IndexText.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Titluri din 3-6 cuvinte, cu frecvențe Zipf pe un vocabular de 50k cuvinte, unele cu diacritice
+struct CatalogText {
+    CatalogCarti catalog;
+    IndexText index{catalog};
+    std::vector<std::string> vocabular;
+};
+
+const CatalogText& catalogText(std::size_t numar) {
+    static std::unique_ptr<CatalogText> date;
+    if (date && date->catalog.size() == numar) {
+        return *date;
+    }
+    date = std::make_unique<CatalogText>();
+    static constexpr const char* radacini[] = {"istorie", "țară", "poveste", "război", "științe", "mare", "ştefan", "învățătură",
+                                               "drum", "carte", "pădure", "viață", "noapte", "suflet", "școală", "munte"};
+    for (std::size_t i = 0; i < 50'000; ++i) {
+        date->vocabular.push_back(std::string(radacini[i % 16]) + (i < 16 ? "" : std::to_string(i)));
+    }
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    const auto cuvant = [&]() -> const std::string& {
+        return date->vocabular[static_cast<std::size_t>(std::pow(50'000.0, uniform(rng))) - 1]; // aproximativ Zipf
+    };
+    date->catalog.rezerva(numar);
+    for (std::size_t i = 0; i < numar; ++i) {
+        std::string titlu = cuvant();
+        for (std::size_t j = 2 + rng() % 5; j > 0; --j) {
+            titlu += ' ';
+            titlu += cuvant();
+        }
+        date->catalog.adauga(CarteFizica(titlu, "Autor " + std::to_string(i % 50'000), 2000, 100, "buna"));
+    }
+    date->index.actualizeaza();
+    return *date;
+}
+
+// Argumente: numărul de cărți, numărul de cuvinte din interogare (primul e frecvent, restul mai rare)
+void BM_IndexText_CautaTop20(benchmark::State& state) {
+    const auto& date = catalogText(static_cast<std::size_t>(state.range(0)));
+    std::mt19937 rng(7);
+    std::vector<std::string> interogari;
+    for (int i = 0; i < 256; ++i) {
+        std::string interogare = date.vocabular[rng() % 16];
+        for (int j = 1; j < state.range(1); ++j) {
+            interogare += ' ' + date.vocabular[16 + rng() % 2000];
+        }
+        interogari.push_back(interogare);
+    }
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(date.index.cauta(interogari[i++ & 255], 20));
+    }
+    state.counters["octeti_per_carte"] = static_cast<double>(date.index.memorieOcupata()) / static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_IndexText_CautaTop20)
+    ->ArgsProduct({{1'000'000, 10'000'000}, {1, 2, 3}})
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,82 @@
+#include "CatalogCarti.h"
+#include "GeneratoareDate.h"
+#include "IndexTitluri.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<std::string> genereazaTitluri(std::size_t numar) {
+    std::vector<std::string> titluri;
+    titluri.reserve(numar);
+    for (std::size_t i = 0; i < numar; ++i) {
+        titluri.push_back(titluSintetic(i));
+    }
+    return titluri;
+}
+
+void construiesteCatalog(const std::vector<std::string>& titluri, CatalogCarti& catalog, IndexTitluri& index) {
+    catalog.rezerva(titluri.size());
+    for (const auto& titlu : titluri) {
+        catalog.adauga(CarteFizica(titlu, "Autor", 2000, 100, "buna"));
+    }
+    index.reconstruieste();
+}
+
+// Caută titluri aleatoare existente; latența trebuie să rămână aceeași de la 10k la 10M de cărți
+void BM_IndexTitluri_CautaExact(benchmark::State& state) {
+    const auto numar = static_cast<std::size_t>(state.range(0));
+    const auto titluri = genereazaTitluri(numar);
+    CatalogCarti catalog;
+    IndexTitluri index(catalog);
+    construiesteCatalog(titluri, catalog, index);
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<std::size_t> distributie(0, numar - 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.cauta(titluri[distributie(rng)]));
+    }
+}
+BENCHMARK(BM_IndexTitluri_CautaExact)->RangeMultiplier(10)->Range(10'000, 10'000'000);
+
+void BM_IndexTitluri_CautaPrefix(benchmark::State& state) {
+    const auto numar = static_cast<std::size_t>(state.range(0));
+    const auto titluri = genereazaTitluri(numar);
+    CatalogCarti catalog;
+    IndexTitluri index(catalog);
+    construiesteCatalog(titluri, catalog, index);
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<std::size_t> distributie(0, numar - 1);
+    for (auto _ : state) {
+        const auto& titlu = titluri[distributie(rng)];
+        benchmark::DoNotOptimize(index.cautaPrefix(std::string_view(titlu).substr(0, titlu.size() - 2), 20));
+    }
+}
+BENCHMARK(BM_IndexTitluri_CautaPrefix)->RangeMultiplier(10)->Range(10'000, 10'000'000);
+
+// Referință: vechea căutare liniară din meniul de împrumut
+void BM_CautareLiniara(benchmark::State& state) {
+    const auto numar = static_cast<std::size_t>(state.range(0));
+    const auto titluri = genereazaTitluri(numar);
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<std::size_t> distributie(0, numar - 1);
+    for (auto _ : state) {
+        const auto& cautat = titluri[distributie(rng)];
+        for (const auto& titlu : titluri) {
+            if (titlu == cautat) {
+                benchmark::DoNotOptimize(&titlu);
+                break;
+            }
+        }
+    }
+}
+BENCHMARK(BM_CautareLiniara)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+
+} // namespace
@@ -0,0 +1,66 @@
+#include "GeneratoareDate.h"
+#include "InterogareCarti.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+// "Cărți fizice uzate ale autorului X, după 1990"; argument: autorul cerut trece prin 20 de autori diferiți
+Interogare interogareUzate(std::size_t i) {
+    Interogare interogare;
+    interogare.autor = "Autor " + std::to_string(i % 20 * 997);
+    interogare.anMinim = 1990;
+    interogare.stareFizica = "uzata";
+    return interogare;
+}
+
+void BM_Interogare_Indexuri(benchmark::State& state) {
+    const auto date = genereazaDateSintetice(static_cast<std::size_t>(state.range(0)), 1, 0);
+    IndexCatalog index(date->catalog);
+    index.actualizeaza();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.executa(interogareUzate(i++)));
+    }
+    state.counters["octeti_index_per_carte"] = static_cast<double>(index.memorieOcupata()) / static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_Interogare_Indexuri)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+
+// Fără filtru selectiv pe autor: bitmap-ul de stare intersectat cu cel de tip, apoi anii pe coloană
+void BM_Interogare_MultimiBiti(benchmark::State& state) {
+    const auto date = genereazaDateSintetice(static_cast<std::size_t>(state.range(0)), 1, 0);
+    IndexCatalog index(date->catalog);
+    index.actualizeaza();
+    Interogare interogare;
+    interogare.tip = TipCarte::Fizica;
+    interogare.stareFizica = "uzata";
+    interogare.ordonare = OrdonareCarti::Titlu;
+    interogare.limita = 50;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.executa(interogare));
+    }
+}
+BENCHMARK(BM_Interogare_MultimiBiti)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+
+// Referință: scanare completă a catalogului pentru fiecare interogare
+void BM_Interogare_Scanare(benchmark::State& state) {
+    const auto date = genereazaDateSintetice(static_cast<std::size_t>(state.range(0)), 1, 0);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto interogare = interogareUzate(i++);
+        std::vector<IdCarte> gasite;
+        for (const auto carte : date->catalog) {
+            if (carte.getAutor() == *interogare.autor && carte.getAnPublicare() >= 1990
+                && carte.getTip() == TipCarte::Fizica && carte.getStareFizica() == "uzata") {
+                gasite.push_back(carte.getId());
+            }
+        }
+        benchmark::DoNotOptimize(gasite);
+    }
+}
+BENCHMARK(BM_Interogare_Scanare)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,104 @@
+#include "GeneratoareDate.h"
+#include "Exceptii.h"
+#include "Inventar.h"
+#include "Utilizator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+
+namespace {
+
+constexpr std::size_t numarCarti = 100'000;
+
+struct DateInventar {
+    CatalogCarti catalog;
+    Inventar inventar{catalog};
+};
+
+IdCarte primaFizica(const CatalogCarti& catalog) {
+    IdCarte id = 0;
+    while (catalog[id].getTip() != TipCarte::Fizica) {
+        ++id;
+    }
+    return id;
+}
+
+// Fiecare carte fizică are 4 exemplare, iar prima are 64, pentru cazul în care toate firele vor aceeași carte
+DateInventar& inventarPopulat() {
+    static DateInventar date;
+    static const bool populat = [] {
+        for (std::size_t i = 0; i < numarCarti; ++i) {
+            date.catalog.adauga(*carteSintetica(i));
+        }
+        date.inventar.actualizeaza();
+        const IdCarte prima = primaFizica(date.catalog);
+        for (IdCarte id = 0; id < numarCarti; ++id) {
+            if (date.catalog[id].getTip() == TipCarte::Fizica) {
+                date.inventar.seteazaExemplare(id, id == prima ? Inventar::maximExemplare : 4);
+            }
+        }
+        return true;
+    }();
+    (void)populat;
+    return date;
+}
+
+// Împrumut + returnare pe cărți alese uniform; fiecare fir are propriul utilizator
+void BM_Inventar_ImprumutaReturneaza(benchmark::State& state) {
+    auto& date = inventarPopulat();
+    Profesor profesor("Nume", "profesor" + std::to_string(state.thread_index()), "Departament");
+    std::mt19937 rng(static_cast<unsigned>(state.thread_index()));
+    std::uniform_int_distribution<IdCarte> distributie(0, numarCarti - 1);
+    for (auto _ : state) {
+        const IdCarte id = distributie(rng);
+        try {
+            const auto exemplar = date.inventar.imprumuta(id, profesor);
+            date.inventar.returneaza(id, exemplar, profesor);
+        } catch (const ImprumutException&) {
+            // Carte generică sau niciun exemplar rămas: tot o verificare completă
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Inventar_ImprumutaReturneaza)->ThreadRange(1, 8)->UseRealTime();
+
+// Toate firele pe aceeași carte: CAS-uri pe același cuvânt de exemplare
+void BM_Inventar_AceeasiCarte(benchmark::State& state) {
+    auto& date = inventarPopulat();
+    const IdCarte id = primaFizica(date.catalog);
+    Profesor profesor("Nume", "profesor" + std::to_string(state.thread_index()), "Departament");
+    for (auto _ : state) {
+        try {
+            const auto exemplar = date.inventar.imprumuta(id, profesor);
+            date.inventar.returneaza(id, exemplar, profesor);
+        } catch (const ImprumutException&) {
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Inventar_AceeasiCarte)->ThreadRange(1, 8)->UseRealTime();
+
+// Limita atinsă: respingerea nu parcurge istoricul, oricât de lung ar fi
+void BM_Inventar_RespingeLaLimita(benchmark::State& state) {
+    auto& date = inventarPopulat();
+    const IdCarte id = primaFizica(date.catalog);
+    Student student("Nume", "student-limita", "Facultate");
+    for (int i = 0; i < student.limitaImprumuturi(); ++i) {
+        student.restaureazaImprumut();
+    }
+    for (int i = 0; i < 100'000; ++i) {
+        student.adaugaImprumut(IstoricImprumut(id, DataZi(19000), DataZi(19014)));
+    }
+    for (auto _ : state) {
+        try {
+            date.inventar.imprumuta(id, student);
+        } catch (const ImprumutException& ex) {
+            benchmark::DoNotOptimize(ex.what());
+        }
+    }
+}
+BENCHMARK(BM_Inventar_RespingeLaLimita);
+
+} // namespace
@@ -0,0 +1,62 @@
+#include "IstoricImprumuturi.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+namespace {
+
+constexpr std::size_t numarCarti = 1'000'000;
+
+// Un profesor cu vechime: câteva împrumuturi pe zi, cărți alese uniform din tot catalogul
+void populeaza(IstoricImprumuturi& istoric, std::size_t numar) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<IdCarte> carte(0, numarCarti - 1);
+    for (std::size_t i = 0; i < numar; ++i) {
+        const DataZi data(15000 + static_cast<std::int32_t>(i / 3));
+        istoric.adauga(IstoricImprumut(carte(rng), data, data + 14));
+    }
+}
+
+void BM_Istoric_Adauga(benchmark::State& state) {
+    const auto numar = static_cast<std::size_t>(state.range(0));
+    std::size_t octeti = 0;
+    for (auto _ : state) {
+        IstoricImprumuturi istoric;
+        populeaza(istoric, numar);
+        octeti = istoric.octetiInMemorie();
+        benchmark::DoNotOptimize(istoric.numar());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    state.counters["octeti_pe_imprumut"] = static_cast<double>(octeti) / static_cast<double>(numar);
+}
+BENCHMARK(BM_Istoric_Adauga)->Arg(50'000);
+
+// Împrumuturile unei luni oarecare dintr-un istoric lung
+void BM_Istoric_Interval(benchmark::State& state) {
+    IstoricImprumuturi istoric;
+    populeaza(istoric, static_cast<std::size_t>(state.range(0)));
+    const auto zile = static_cast<std::int32_t>(state.range(0) / 3);
+    std::mt19937 rng(11);
+    std::size_t gasite = 0;
+    for (auto _ : state) {
+        const DataZi de(15000 + static_cast<std::int32_t>(rng() % static_cast<unsigned>(zile - 30)));
+        const auto rezultat = istoric.intre(de, de + 30);
+        gasite += rezultat.size();
+        benchmark::DoNotOptimize(rezultat.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(gasite));
+}
+BENCHMARK(BM_Istoric_Interval)->RangeMultiplier(10)->Range(1'000, 100'000);
+
+void BM_Istoric_Ultimele(benchmark::State& state) {
+    IstoricImprumuturi istoric;
+    populeaza(istoric, 100'000);
+    for (auto _ : state) {
+        const auto rezultat = istoric.ultimele(static_cast<std::size_t>(state.range(0)));
+        benchmark::DoNotOptimize(rezultat.data());
+    }
+}
+BENCHMARK(BM_Istoric_Ultimele)->Arg(10)->Arg(1000);
+
+} // namespace
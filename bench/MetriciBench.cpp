@@ -0,0 +1,41 @@
+#include "Metrici.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+
+namespace {
+
+// Referință: un singur atomic comun, pe care firele își fură linia de cache
+std::atomic<std::uint64_t> contorComun{0};
+
+void BM_Metrici_ContorComun(benchmark::State& state) {
+    for (auto _ : state) {
+        contorComun.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+BENCHMARK(BM_Metrici_ContorComun)->ThreadRange(1, 8)->UseRealTime();
+
+ContorSharduit contor;
+
+void BM_Metrici_ContorSharduit(benchmark::State& state) {
+    for (auto _ : state) {
+        contor.adauga();
+    }
+}
+BENCHMARK(BM_Metrici_ContorSharduit)->ThreadRange(1, 8)->UseRealTime();
+
+// Costul adăugat unui apel instrumentat, la diferite rate de eșantionare
+void BM_Metrici_Cronometru(benchmark::State& state) {
+    static MetricaLatenta metrica0{"bench0", "", 0};
+    static MetricaLatenta metrica4{"bench4", "", 4};
+    static MetricaLatenta metrica6{"bench6", "", 6};
+    MetricaLatenta& metrica = state.range(0) == 0 ? metrica0 : state.range(0) == 4 ? metrica4 : metrica6;
+    for (auto _ : state) {
+        const CronometruMetrica cronometru(metrica);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Metrici_Cronometru)->Arg(0)->Arg(4)->Arg(6);
+
+} // namespace
@@ -0,0 +1,62 @@
+#include "MotorPenalitati.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct DateImprumuturi {
+    CatalogCarti catalog;
+    std::vector<std::shared_ptr<Utilizator>> utilizatori;
+    std::vector<std::shared_ptr<ImprumutAbstract>> imprumuturi;
+};
+
+std::unique_ptr<DateImprumuturi> genereazaImprumuturi(std::size_t numar) {
+    auto rezultat = std::make_unique<DateImprumuturi>();
+    auto& date = *rezultat;
+    for (int i = 0; i < 1000; ++i) {
+        date.utilizatori.push_back(std::make_shared<Student>("Student", "bench-motor" + std::to_string(i) + "@exemplu.ro", "Facultate"));
+    }
+    const CarteView buna = date.catalog[date.catalog.adauga(CarteFizica("Titlu", "Autor", 2000, 200, "buna"))];
+    const CarteView uzata = date.catalog[date.catalog.adauga(CarteFizica("Titlu", "Autor", 2000, 200, "uzata"))];
+    const CarteView digitala = date.catalog[date.catalog.adauga(CarteDigitala("Titlu", "Autor", 2000, 1.5f, "PDF"))];
+    date.imprumuturi.reserve(numar);
+    for (std::size_t i = 0; i < numar; ++i) {
+        const DataZi imprumut(19000 + static_cast<int>(i % 400));
+        auto& utilizator = *date.utilizatori[i % date.utilizatori.size()];
+        const CarteView& carte = i % 3 == 0 ? digitala : (i % 5 ? buna : uzata);
+        date.imprumuturi.push_back(ImprumutFactory::creareImprumut(carte, utilizator, imprumut, imprumut + 14));
+    }
+    return rezultat;
+}
+
+// Argumente: numărul de împrumuturi, numărul de fire
+void BM_MotorPenalitati_Calculeaza(benchmark::State& state) {
+    const auto date = genereazaImprumuturi(static_cast<std::size_t>(state.range(0)));
+    const MotorPenalitati motor(static_cast<unsigned>(state.range(1)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(motor.calculeaza(date->imprumuturi, DataZi(19300)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MotorPenalitati_Calculeaza)
+    ->ArgsProduct({{100'000, 1'000'000}, {1, 2, 4, 8}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Referință: câte un apel virtual pe împrumut, trecut direct în contul utilizatorului, ca înainte
+void BM_Penalitati_ApelVirtualPeImprumut(benchmark::State& state) {
+    const auto date = genereazaImprumuturi(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& imprumut : date->imprumuturi) {
+            imprumut->getUtilizator().adaugaPenalitate(imprumut->calculeazaPenalitate(DataZi(19300)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Penalitati_ApelVirtualPeImprumut)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+} // namespace
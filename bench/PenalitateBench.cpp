@@ -0,0 +1,115 @@
+#include "DataZi.h"
+#include "Imprumut.h"
+#include "PoliticaPenalitati.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <ctime>
+#include <deque>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Referință: vechea calculeazaPenalitate, cu istringstream + get_time + mktime la fiecare apel
+double penalitateVeche(const std::string& dataImprumut, const std::string& returnare, double penalitateZi) {
+    std::tm dataImprumutTM = {}, dataReturnareTM = {};
+    std::istringstream ssImprumut(dataImprumut);
+    std::istringstream ssReturnare(returnare);
+    ssImprumut >> std::get_time(&dataImprumutTM, "%Y-%m-%d");
+    ssReturnare >> std::get_time(&dataReturnareTM, "%Y-%m-%d");
+
+    auto imprumutDate = std::chrono::system_clock::from_time_t(std::mktime(&dataImprumutTM));
+    auto returnareDate = std::chrono::system_clock::from_time_t(std::mktime(&dataReturnareTM));
+    auto diff = std::chrono::duration_cast<std::chrono::hours>(returnareDate - imprumutDate).count() / 24;
+    return diff > 14 ? static_cast<double>(diff - 14) * penalitateZi : 0;
+}
+
+std::vector<std::string> genereazaDate(std::size_t numar) {
+    std::vector<std::string> date;
+    date.reserve(numar);
+    for (std::size_t i = 0; i < numar; ++i) {
+        date.push_back(DataZi(19000 + static_cast<int>(i % 1500)).toString());
+    }
+    return date;
+}
+
+void BM_Penalitate_MktimePeSiruri(benchmark::State& state) {
+    const auto date = genereazaDate(1024);
+    const std::string returnare = "2026-06-30";
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(penalitateVeche(date[i++ & 1023], returnare, 5.0));
+    }
+}
+BENCHMARK(BM_Penalitate_MktimePeSiruri);
+
+void BM_Penalitate_DataZi(benchmark::State& state) {
+    const auto date = genereazaDate(1024);
+    CatalogCarti catalog;
+    const CarteView carte = catalog[catalog.adauga(CarteDigitala("Titlu", "Autor", 2000, 1.5f, "PDF"))];
+    // Utilizatorul nu e folosit de calculul pentru cărți digitale; împrumuturile îl țin doar prin referință
+    Student student("Nume", "bench-penalitate@exemplu.ro", "Facultate");
+    std::deque<ImprumutCarteDigitala> imprumuturi; // împrumuturile nu se mută (starea returnării e atomică)
+    for (const auto& data : date) {
+        imprumuturi.emplace_back(DataZi::parseazaSauArunca(data), DataZi::parseazaSauArunca(data), carte, student);
+    }
+    const DataZi returnare = DataZi::parseazaSauArunca("2026-06-30");
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(imprumuturi[i++ & 1023].calculeazaPenalitate(returnare));
+    }
+}
+BENCHMARK(BM_Penalitate_DataZi);
+
+// Tariful pe zi prin ierarhia Carte: apel virtual și comparația stării fizice ca șir, pentru fiecare carte
+void BM_Penalitate_TarifVirtual(benchmark::State& state) {
+    std::vector<std::shared_ptr<Carte>> carti;
+    for (std::size_t i = 0; i < 1024; ++i) {
+        if (i % 2) {
+            carti.push_back(std::make_shared<CarteDigitala>("Titlu", "Autor", 2000, 1.5f, "PDF"));
+        } else {
+            carti.push_back(std::make_shared<CarteFizica>("Titlu", "Autor", 2000, 100, i % 3 ? "buna" : "uzata"));
+        }
+    }
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(carti[i++ & 1023]->calculeazaPenalitate());
+    }
+}
+BENCHMARK(BM_Penalitate_TarifVirtual);
+
+// Același tarif din tabelul tip carte × stare × tip utilizator, cu indicii deja enumerări
+void BM_Penalitate_TarifTabel(benchmark::State& state) {
+    struct Chei {
+        TipCarte tip;
+        StareCarte stare;
+        TipUtilizator utilizator;
+    };
+    std::vector<Chei> chei;
+    for (std::size_t i = 0; i < 1024; ++i) {
+        chei.push_back({i % 2 ? TipCarte::Digitala : TipCarte::Fizica, i % 3 ? StareCarte::Buna : StareCarte::Uzata,
+                        i % 5 ? TipUtilizator::Student : TipUtilizator::Profesor});
+    }
+    const auto& tabel = TabelPenalitati::curent();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto& c = chei[i++ & 1023];
+        benchmark::DoNotOptimize(tabel.rata(c.tip, c.stare, c.utilizator));
+    }
+}
+BENCHMARK(BM_Penalitate_TarifTabel);
+
+void BM_DataZi_Parseaza(benchmark::State& state) {
+    const auto date = genereazaDate(1024);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(DataZi::parseaza(date[i++ & 1023]));
+    }
+}
+BENCHMARK(BM_DataZi_Parseaza);
+
+} // namespace
@@ -0,0 +1,58 @@
+#include "GeneratoareDate.h"
+#include "MotorPenalitati.h"
+#include "PlanificatorIntarzieri.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace {
+
+constexpr int zileAvansate = 30;
+const DataZi inceput = DataZi::dinCalendar(2023, 1, 1);
+
+// Argument: numărul de împrumuturi deschise. Câte o avansare de o zi plus acumularea penalităților,
+// pe 30 de zile; ceasul e adus la `inceput` în afara măsurătorii, ca restanța din 2022 să nu conteze
+void BM_Planificator_AvansareZilnica(benchmark::State& state) {
+    const auto date = genereazaDateSintetice(100'000, 10'000, static_cast<std::size_t>(state.range(0)));
+    std::size_t devenite = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto planificator = std::make_unique<PlanificatorIntarzieri>(DataZi::dinCalendar(2022, 1, 1));
+        for (const auto& imprumut : date->imprumuturi) {
+            planificator->adauga(imprumut);
+        }
+        planificator->avanseaza(inceput + -1);
+        state.ResumeTiming();
+
+        for (int zi = 0; zi < zileAvansate; ++zi) {
+            devenite += planificator->avanseaza(inceput + zi).imprumuturi.size();
+            benchmark::DoNotOptimize(planificator->acumuleazaPenalitati());
+        }
+
+        state.PauseTiming();
+        planificator.reset();
+        state.ResumeTiming();
+    }
+    state.counters["devenite_intarziate"] = benchmark::Counter(static_cast<double>(devenite), benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations() * zileAvansate);
+}
+BENCHMARK(BM_Planificator_AvansareZilnica)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+// Referință: aceleași 30 de zile, cu câte o parcurgere completă a împrumuturilor pe zi
+void BM_Planificator_ScanareZilnicaMotor(benchmark::State& state) {
+    const auto date = genereazaDateSintetice(100'000, 10'000, static_cast<std::size_t>(state.range(0)));
+    const MotorPenalitati motor(1);
+    for (auto _ : state) {
+        for (int zi = 0; zi < zileAvansate; ++zi) {
+            const auto rezultat = motor.calculeaza(date->imprumuturi, inceput + zi);
+            MotorPenalitati::aplica(date->imprumuturi, rezultat);
+            benchmark::DoNotOptimize(rezultat.total);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * zileAvansate);
+}
+BENCHMARK(BM_Planificator_ScanareZilnicaMotor)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -0,0 +1,117 @@
+#include "RegistruUtilizatori.h"
+#include "Utilizator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t numarUtilizatori = 200'000;
+
+const std::vector<std::string>& emailuri() {
+    static const std::vector<std::string> valori = [] {
+        std::vector<std::string> rezultat;
+        rezultat.reserve(numarUtilizatori);
+        for (std::size_t i = 0; i < numarUtilizatori; ++i) {
+            rezultat.push_back("utilizator" + std::to_string(i) + "@exemplu.ro");
+        }
+        return rezultat;
+    }();
+    return valori;
+}
+
+RegistruUtilizatori& registruPopulat() {
+    static RegistruUtilizatori registru;
+    static const bool populat = [] {
+        for (const auto& email : emailuri()) {
+            registru.adauga(std::make_shared<Student>("Nume", email, "Facultate"));
+        }
+        return true;
+    }();
+    (void)populat;
+    return registru;
+}
+
+// Căutări concurente după email, ca la rezolvarea utilizatorului pe fiecare cerere
+void BM_Registru_CautaConcurent(benchmark::State& state) {
+    const auto& registru = registruPopulat();
+    std::mt19937 rng(static_cast<unsigned>(state.thread_index()));
+    std::uniform_int_distribution<std::size_t> distributie(0, numarUtilizatori - 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(registru.cauta(emailuri()[distributie(rng)]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Registru_CautaConcurent)->ThreadRange(1, 8)->UseRealTime();
+
+// 90% citiri, 10% inserări/ștergeri pe chei separate per fir
+void BM_Registru_Mixt(benchmark::State& state) {
+    auto& registru = registruPopulat();
+    std::mt19937 rng(static_cast<unsigned>(state.thread_index()));
+    std::uniform_int_distribution<std::size_t> distributie(0, numarUtilizatori - 1);
+    std::vector<std::shared_ptr<Utilizator>> temporari;
+    for (int i = 0; i < 1000; ++i) {
+        temporari.push_back(std::make_shared<Student>("Nume", "temporar" + std::to_string(state.thread_index()) + "-" + std::to_string(i), "Facultate"));
+    }
+    std::size_t contor = 0;
+    for (auto _ : state) {
+        if (++contor % 10 == 0) {
+            const auto& utilizator = temporari[contor % temporari.size()];
+            if (!registru.adauga(utilizator)) {
+                registru.sterge(utilizator->getEmail());
+            }
+        } else {
+            benchmark::DoNotOptimize(registru.cauta(emailuri()[distributie(rng)]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Registru_Mixt)->ThreadRange(1, 8)->UseRealTime();
+
+constexpr const char* facultati[] = {"Facultatea de Matematica si Informatica", "Facultatea de Fizica",
+                                     "Facultatea de Chimie", "Facultatea de Litere"};
+
+std::vector<std::shared_ptr<Utilizator>> utilizatoriPeFacultati() {
+    std::vector<std::shared_ptr<Utilizator>> utilizatori;
+    utilizatori.reserve(numarUtilizatori);
+    for (std::size_t i = 0; i < numarUtilizatori; ++i) {
+        utilizatori.push_back(std::make_shared<Student>("Nume", "facultate" + std::to_string(i), facultati[i % 4]));
+    }
+    return utilizatori;
+}
+
+// Numărarea colegilor de facultate, cu textul comparat la fiecare utilizator
+void BM_Facultate_ComparaSir(benchmark::State& state) {
+    const auto utilizatori = utilizatoriPeFacultati();
+    const std::string cautata = facultati[0];
+    for (auto _ : state) {
+        std::size_t numar = 0;
+        for (const auto& utilizator : utilizatori) {
+            numar += utilizator->getFacultateDepartament() == cautata;
+        }
+        benchmark::DoNotOptimize(numar);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(utilizatori.size()));
+}
+BENCHMARK(BM_Facultate_ComparaSir);
+
+// Aceeași numărare, cu id-ul internat rezolvat o singură dată
+void BM_Facultate_ComparaId(benchmark::State& state) {
+    const auto utilizatori = utilizatoriPeFacultati();
+    const auto cautata = utilizatori.front()->getIdFacultateDepartament();
+    for (auto _ : state) {
+        std::size_t numar = 0;
+        for (const auto& utilizator : utilizatori) {
+            numar += utilizator->getIdFacultateDepartament() == cautata;
+        }
+        benchmark::DoNotOptimize(numar);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(utilizatori.size()));
+}
+BENCHMARK(BM_Facultate_ComparaId);
+
+} // namespace
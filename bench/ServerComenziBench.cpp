@@ -0,0 +1,57 @@
+#include "GeneratoareDate.h"
+#include "Biblioteca.h"
+#include "ServerComenzi.h"
+
+#include <benchmark/benchmark.h>
+
+#include <sstream>
+#include <string>
+
+namespace {
+
+constexpr std::size_t numarCarti = 100'000;
+constexpr std::size_t comenziPeLot = 4096;
+
+// Cărțile sintetice ajung în singleton o singură dată, pentru toate benchmark-urile din fișier
+BibliotecaSingleton& bibliotecaPopulata() {
+    static const bool populata = [] {
+        auto& biblioteca = BibliotecaSingleton::getInstance();
+        for (std::size_t i = 0; i < numarCarti; ++i) {
+            biblioteca.adaugaCarte(carteSintetica(i));
+        }
+        return true;
+    }();
+    (void)populata;
+    return BibliotecaSingleton::getInstance();
+}
+
+// Un flux de comenzi servit cap-coadă: parsare, pool, răspunsuri în ordine.
+// Argumentul: la câte comenzi una e o scriere (0 = doar citiri)
+void BM_Server_Flux(benchmark::State& state) {
+    auto& biblioteca = bibliotecaPopulata();
+    std::vector<std::shared_ptr<Utilizator>> utilizatori;
+    std::vector<std::shared_ptr<ImprumutAbstract>> imprumuturi;
+    ServerComenzi server(biblioteca, utilizatori, imprumuturi, nullptr);
+
+    const auto perioada = static_cast<std::size_t>(state.range(0));
+    std::string comenzi;
+    for (std::size_t i = 0; i < comenziPeLot; ++i) {
+        const std::string titlu = titluSintetic(i * 7919 % numarCarti);
+        if (perioada != 0 && i % perioada == 0) {
+            comenzi += "exemplare\t" + titlu + "\t" + std::to_string(1 + i % 4) + "\n";
+        } else {
+            comenzi += "cauta\t" + titlu + "\n";
+        }
+    }
+
+    for (auto _ : state) {
+        std::istringstream intrare(comenzi);
+        std::ostringstream iesire;
+        server.servesteFlux(intrare, iesire);
+        benchmark::DoNotOptimize(iesire.str().size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * comenziPeLot));
+}
+BENCHMARK(BM_Server_Flux)->Arg(0)->Arg(10)->Arg(2)->Unit(benchmark::kMillisecond);
+
+} // namespace
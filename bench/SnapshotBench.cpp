@@ -0,0 +1,67 @@
+#include "CatalogCarti.h"
+#include "IndexTitluri.h"
+#include "Snapshot.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+namespace {
+
+const std::string caleSnapshot = "biblioteca_bench_snapshot.bin";
+
+void scrieSnapshot(std::size_t numar) {
+    CatalogCarti catalog;
+    IndexTitluri index(catalog);
+    catalog.rezerva(numar);
+    for (std::size_t i = 0; i < numar; ++i) {
+        const std::string titlu = "Titlu carte " + std::to_string(i * 2654435761u % 1000000007u);
+        const std::string autor = "Autor " + std::to_string(i % 50'000);
+        catalog.adauga(CarteFizica(titlu, autor, 1900 + static_cast<int>(i % 125), 100, i % 7 ? "buna" : "uzata"));
+    }
+    index.reconstruieste();
+
+    ScriitorSnapshot snapshot(caleSnapshot);
+    catalog.salveaza(snapshot);
+    index.salveaza(snapshot);
+    snapshot.finalizeaza(0);
+}
+
+// Pornire din snapshot: mapare + verificarea antetului + reconstruirea pool-ului de autori.
+// Fișierul e de obicei deja în page cache după scriere, deci se măsoară costul fără I/O.
+void BM_Snapshot_Incarcare(benchmark::State& state) {
+    const auto numar = static_cast<std::size_t>(state.range(0));
+    scrieSnapshot(numar);
+    for (auto _ : state) {
+        CatalogCarti catalog;
+        IndexTitluri index(catalog);
+        const CititorSnapshot snapshot(caleSnapshot);
+        catalog.incarca(snapshot);
+        index.incarca(snapshot);
+        benchmark::DoNotOptimize(index.cauta("Titlu carte 0"));
+    }
+    state.counters["carti"] = static_cast<double>(numar);
+    std::remove(caleSnapshot.c_str());
+}
+BENCHMARK(BM_Snapshot_Incarcare)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond)->Iterations(5);
+
+// Referință: reconstruirea aceluiași catalog și index carte cu carte, ca după o repornire fără snapshot
+void BM_Snapshot_ReconstruireCarteCuCarte(benchmark::State& state) {
+    const auto numar = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        CatalogCarti catalog;
+        IndexTitluri index(catalog);
+        catalog.rezerva(numar);
+        for (std::size_t i = 0; i < numar; ++i) {
+            const std::string titlu = "Titlu carte " + std::to_string(i * 2654435761u % 1000000007u);
+            const std::string autor = "Autor " + std::to_string(i % 50'000);
+            index.adauga(catalog.adauga(CarteFizica(titlu, autor, 1900 + static_cast<int>(i % 125), 100, i % 7 ? "buna" : "uzata")));
+        }
+        benchmark::DoNotOptimize(index.cauta("Titlu carte 0"));
+    }
+}
+BENCHMARK(BM_Snapshot_ReconstruireCarteCuCarte)->Arg(1'000'000)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+} // namespace
@@ -2,6 +2,8 @@ option(WARNINGS_AS_ERRORS "Treat warnings as errors" OFF)
 option(USE_ASAN "Use Address Sanitizer" OFF)
 option(USE_MSAN "Use Memory Sanitizer" OFF)
 option(CMAKE_COLOR_DIAGNOSTICS "Enable color diagnostics" ON)
+option(BUILD_BENCHMARKS "Build the biblioteca_bench target" OFF)
+option(BIBLIOTECA_METRICI "Hot-path counters and latency histograms (OFF compiles them out)" ON)
 
 # update name in .github/workflows/cmake.yml:27 when changing "bin" name here
 set(DESTINATION_DIR "bin")
@@ -0,0 +1,56 @@
+#ifndef OOP_ALOCATOR_IDURI_H
+#define OOP_ALOCATOR_IDURI_H
+
+#include <atomic>
+#include <cstdint>
+
+// Id-uri unice pe 64 de biți, date concurent. Fiecare fir rezervă dintr-un contor comun câte un bloc
+// de dimensiuneBloc id-uri și le dă apoi pe rând din blocul propriu, fără operații atomice; contorul
+// comun e atins o dată la dimensiuneBloc id-uri. Id-urile unui fir sunt crescătoare, dar cele ale
+// firelor diferite se întrepătrund: ordinea id-urilor nu mai e ordinea creării.
+class AlocatorIduri {
+public:
+    static constexpr std::uint64_t dimensiuneBloc = 256;
+
+private:
+    // Blocul firului curent; instanta deosebește alocatoarele, chiar refolosite la aceeași adresă
+    struct Bloc {
+        std::uint64_t instanta = 0;
+        std::uint64_t generatie = 0;
+        std::uint64_t urmator = 0;
+        std::uint64_t sfarsit = 0;
+    };
+
+    static thread_local Bloc blocFir;
+
+    const std::uint64_t instanta;
+    alignas(64) std::atomic<std::uint64_t> primulLiber{1}; // primul id nerezervat de niciun fir
+    // Crește doar când un id restaurat cade într-un bloc deja rezervat; blocurile mai vechi sunt
+    // abandonate. Altfel linia nu e scrisă niciodată, deci citirea ei pe fiecare id rămâne locală
+    alignas(64) std::atomic<std::uint64_t> generatie{0};
+
+    std::uint64_t rezervaBloc(Bloc& bloc);
+
+public:
+    AlocatorIduri();
+
+    AlocatorIduri(const AlocatorIduri&) = delete;
+    AlocatorIduri& operator=(const AlocatorIduri&) = delete;
+
+    std::uint64_t genereaza() {
+        Bloc& bloc = blocFir;
+        if (bloc.instanta == instanta && bloc.urmator != bloc.sfarsit
+            && bloc.generatie == generatie.load(std::memory_order_relaxed)) {
+            return bloc.urmator++;
+        }
+        return rezervaBloc(bloc);
+    }
+
+    // După încărcarea unor id-uri salvate: id-urile noi nu se vor suprapune cu id
+    void avanseazaDupa(std::uint64_t id);
+
+    // Primul id pe care niciun fir nu l-a rezervat încă
+    [[nodiscard]] std::uint64_t getPrimulLiber() const { return primulLiber.load(std::memory_order_relaxed); }
+};
+
+#endif //OOP_ALOCATOR_IDURI_H
@@ -0,0 +1,149 @@
+#ifndef OOP_ANALITICE_H
+#define OOP_ANALITICE_H
+
+#include "Carte.h"
+#include "DataZi.h"
+#include "Metrici.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class Utilizator;
+enum class TipUtilizator : std::uint8_t;
+
+// O carte din schița de frecvențe: numar e o margine superioară, numar - eroare una inferioară
+struct FrecventaEstimata {
+    IdCarte id;
+    std::uint64_t numar;
+    std::uint64_t eroare;
+};
+
+// Cele mai împrumutate cărți dintr-un flux, cu algoritmul Space-Saving: cel mult `capacitate` contoare,
+// ținute într-un heap după număr. O carte nouă, cu toate contoarele ocupate, preia contorul minim și
+// moștenește numărul lui ca eroare. Orice carte cu mai mult de N / capacitate împrumuturi e sigur
+// printre contoare, iar numărul ei e supraestimat cu cel mult N / capacitate.
+class SchitaFrecvente {
+private:
+    static constexpr std::uint32_t faraPozitie = UINT32_MAX;
+
+    std::vector<FrecventaEstimata> heap; // minimul în vârf
+    std::vector<std::uint32_t> pozitii;  // după id-ul cărții (id-urile din catalog sunt dense)
+    std::size_t capacitate;
+
+    // Mută `element` din golul de la `pozitie` spre frunze / spre rădăcină, până la locul lui
+    void coboara(std::size_t pozitie, FrecventaEstimata element);
+    void urca(std::size_t pozitie, FrecventaEstimata element);
+    void aseaza(std::size_t pozitie, const FrecventaEstimata& element);
+
+public:
+    explicit SchitaFrecvente(std::size_t capacitate);
+
+    void adauga(IdCarte id);
+
+    // Cele mai frecvente `k` (cel mult capacitate), descrescător după numar; nu depinde de N
+    [[nodiscard]] std::vector<FrecventaEstimata> top(std::size_t k) const;
+
+    [[nodiscard]] std::size_t getCapacitate() const { return capacitate; }
+
+    // Toate contoarele, în ordinea heap-ului, pentru combinarea mai multor schițe
+    [[nodiscard]] const std::vector<FrecventaEstimata>& getContoare() const { return heap; }
+
+    // Cel mai mare număr pe care îl poate avea o carte absentă dintre contoare: minimul, dacă schița e plină
+    [[nodiscard]] std::uint64_t margineAbsente() const { return heap.size() < capacitate ? 0 : heap[0].numar; }
+};
+
+// Numărul aproximativ de valori distincte (HyperLogLog): 2^precizie registre de câte un octet, cu
+// eroarea relativă tipică 1.04 / sqrt(2^precizie). Suma 2^-registru și registrele nule sunt ținute
+// la zi la fiecare adăugare, deci estimarea e O(1)
+class HyperLogLog {
+private:
+    std::vector<std::uint8_t> registre;
+    unsigned precizie;
+    double sumaInverse;    // sum 2^-registre[j]
+    std::size_t registreNule;
+
+    // Registrul `index` devine cel puțin `rang`, cu suma și registrele nule ținute la zi
+    void ridica(std::size_t index, std::uint8_t rang);
+
+public:
+    explicit HyperLogLog(unsigned precizie = 12);
+
+    // `amprenta` trebuie să fie o dispersie bună pe 64 de biți
+    void adauga(std::uint64_t amprenta);
+
+    // Reuniunea cu o altă schiță de aceeași precizie: maximul pe fiecare registru
+    void combina(const HyperLogLog& alta);
+
+    [[nodiscard]] double estimeaza() const;
+};
+
+// Împrumuturile unei facultăți sau ale unui departament într-o lună (vezi DataZi::getIndexLuna)
+struct ImprumuturiFacultateLuna {
+    std::uint32_t idFacultateDepartament;
+    std::int32_t luna;
+    std::uint64_t numar;
+};
+
+// Agregate pentru rapoarte, ținute la zi la fiecare împrumut creat (inclusiv cele încărcate la pornire)
+// și la fiecare penalitate trecută în cont, ca un raport să nu mai parcurgă împrumuturile sau
+// istoricul. Crearea unui împrumut scrie doar în shard-ul firului curent (vezi ContorSharduit), deci
+// firele nu se blochează între ele; citirile combină shard-urile și costă cât mărimea agregatelor
+// înmulțită cu numărul de shard-uri: contoarele schițelor, registrele, rândurile facultate × lună.
+class AnaliticeImprumuturi {
+public:
+    static constexpr std::size_t capacitateTop = 256;
+    static constexpr std::size_t numarTipuriUtilizator = 2;
+
+private:
+    // Agregatele împrumuturilor create de firele unui shard; mutex-ul e disputat doar peste 16 fire
+    struct alignas(64) ShardImprumuturi {
+        mutable std::mutex mutexShard;
+        SchitaFrecvente carti{capacitateTop};
+        std::map<std::pair<std::int32_t, std::uint32_t>, std::uint64_t> lunaFacultate; // (lună, id facultate) -> număr
+        HyperLogLog cititori;
+        std::unordered_map<std::int32_t, HyperLogLog> cititoriPeLuna;
+        std::uint64_t imprumuturi = 0;
+    };
+
+    // Penalitățile pot fi aplicate din mai multe fire: fiecare fir adună în propria linie de cache
+    struct alignas(64) ShardPenalitati {
+        std::array<std::atomic<double>, numarTipuriUtilizator> suma{};
+    };
+
+    std::array<ShardImprumuturi, ContorSharduit::numarSharduri> sharduri;
+    std::array<ShardPenalitati, ContorSharduit::numarSharduri> sumePenalitati{};
+
+public:
+    // Apelat la crearea oricărui împrumut
+    void imprumutCreat(IdCarte carte, const Utilizator& utilizator, DataZi data);
+
+    // Apelat la orice modificare a soldului de penalități al unui utilizator (și negativă)
+    void penalitateAplicata(TipUtilizator tip, double suma);
+
+    // Din schițele shard-urilor combinate: o carte absentă dintr-un shard plin e socotită acolo cu
+    // minimul lui, deci numar rămâne o margine superioară, iar numar - eroare una inferioară
+    [[nodiscard]] std::vector<FrecventaEstimata> topCarti(std::size_t k) const;
+
+    // Ordonate după lună, apoi după facultate. Fiecare shard ține rândurile deja ordonate, deci citirea
+    // doar le interclasează, fără sortare: cost liniar în rânduri × shard-uri, nu în împrumuturi
+    [[nodiscard]] std::vector<ImprumuturiFacultateLuna> peFacultatiSiLuni() const;
+
+    [[nodiscard]] double penalitati(TipUtilizator tip) const;
+
+    // Utilizatori distincți care au împrumutat ceva, în total sau într-o lună; aproximativ
+    [[nodiscard]] std::uint64_t cititoriDistincti() const;
+    [[nodiscard]] std::uint64_t cititoriDistinctiLuna(std::int32_t luna) const;
+
+    [[nodiscard]] std::uint64_t numarImprumuturi() const;
+};
+
+extern AnaliticeImprumuturi analitice;
+
+#endif //OOP_ANALITICE_H
@@ -0,0 +1,141 @@
+#ifndef OOP_BIBLIOTECA_H
+#define OOP_BIBLIOTECA_H
+
+#include "Carte.h"
+#include "CatalogCarti.h"
+#include "DataZi.h"
+#include "Imprumut.h"
+#include "IndexText.h"
+#include "IndexTitluri.h"
+#include "InterogareCarti.h"
+#include "Inventar.h"
+#include "Metrici.h"
+#include "PlanificatorIntarzieri.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+// Design Pattern: Singleton for Library
+class BibliotecaSingleton {
+private:
+    CatalogCarti catalog;
+    IndexTitluri indexTitluri; // reține doar id-uri, titlurile sunt citite din catalog
+    mutable IndexCatalog indexCatalog; // adus la zi de prima interogare după adăugări
+    mutable IndexText indexText;       // la zi după adaugaCarte; după importuri, la prima căutare
+    Inventar inventar;                 // la zi după orice adăugare, ca împrumuturile să nu-l actualizeze
+    PlanificatorIntarzieri intarzieri; // toate împrumuturile deschise, după ziua în care devin întârziate
+
+    BibliotecaSingleton() : indexTitluri(catalog), indexCatalog(catalog), indexText(catalog), inventar(catalog) {}
+
+public:
+    BibliotecaSingleton(const BibliotecaSingleton&) = delete;
+    BibliotecaSingleton& operator=(const BibliotecaSingleton&) = delete;
+
+    static BibliotecaSingleton& getInstance() {
+        static BibliotecaSingleton instance;
+        return instance;
+    }
+
+    // Catalogul viu: doar din firul care adaugă cărți sau sub blocarea care îl exclude
+    const CatalogCarti& getCarti() const {
+        return catalog;
+    }
+
+    // Catalogul de la ultima adăugare încheiată, neschimbat cât timp e ținut; pentru exporturi și
+    // parcurgeri lungi din alte fire, care nu trebuie să blocheze adăugările
+    [[nodiscard]] std::shared_ptr<const VersiuneCatalog> getVersiuneCatalog() const {
+        return catalog.versiune();
+    }
+
+    [[nodiscard]] CarteView getCarte(IdCarte id) const {
+        return catalog[id];
+    }
+
+    IdCarte adaugaCarte(const std::shared_ptr<Carte>& carte);
+
+    // Adăugare în lot (import masiv); întoarce id-ul primei cărți adăugate.
+    // Căutarea după prefix vede cărțile abia după finalizeazaLoturi()
+    IdCarte adaugaCarti(std::span<const RandCarte> randuri);
+
+    void finalizeazaLoturi() {
+        indexTitluri.compacteaza();
+    }
+
+    [[nodiscard]] std::optional<IntrareTitlu> cautaCarte(std::string_view titlu) const {
+        MASOARA_LATENTA(metrici.cautareTitlu);
+        return indexTitluri.cauta(titlu);
+    }
+
+    [[nodiscard]] std::vector<IntrareTitlu> cautaDupaPrefix(std::string_view prefix, std::size_t limita) const {
+        return indexTitluri.cautaPrefix(prefix, limita);
+    }
+
+    [[nodiscard]] std::vector<IntrareTitlu> cautaInterval(std::string_view dela, std::string_view panaLa, std::size_t limita) const {
+        return indexTitluri.cautaInterval(dela, panaLa, limita);
+    }
+
+    [[nodiscard]] std::vector<IntrareTitlu> paginaDupa(std::string_view titlu, std::size_t marime) const {
+        return indexTitluri.paginaDupa(titlu, marime);
+    }
+
+    [[nodiscard]] std::vector<IntrareTitlu> paginaDupa(IdCarte ultima, std::size_t marime) const {
+        return indexTitluri.paginaDupa(ultima, marime);
+    }
+
+    // Filtre pe autor, ani, tip, stare fizică / format, cu ordonare și paginare.
+    // Indexează întâi cărțile adăugate de la interogarea anterioară
+    [[nodiscard]] RezultatInterogare interogheaza(const Interogare& interogare) const {
+        indexCatalog.actualizeaza();
+        return indexCatalog.executa(interogare);
+    }
+
+    // Căutare după cuvinte din titlu și autor, cu sau fără diacritice; cele mai relevante `k` cărți
+    [[nodiscard]] std::vector<RezultatText> cautaText(std::string_view text, std::size_t k) const {
+        indexText.actualizeaza();
+        return indexText.cauta(text, k);
+    }
+
+    // Verifică limita utilizatorului și ia un exemplar de pe raft, ambele în timp constant, apoi creează
+    // împrumutul; ImprumutException dacă nu se poate. Verificările pot rula în paralel
+    std::shared_ptr<ImprumutAbstract> imprumuta(IdCarte id, Utilizator& utilizator, DataZi imprumut, DataZi returnare,
+                                                IdImprumut idImprumut = 0);
+
+    // Pune exemplarul înapoi pe raft; false dacă împrumutul era deja returnat
+    bool returneaza(ImprumutAbstract& imprumut);
+
+    // La încărcarea unui snapshot: starea salvată a împrumutului, fără verificarea limitei
+    void restaureazaImprumut(const std::shared_ptr<ImprumutAbstract>& imprumut, std::uint8_t exemplar, bool returnat);
+
+    void seteazaExemplare(IdCarte id, unsigned numar) {
+        inventar.seteazaExemplare(id, numar);
+    }
+
+    [[nodiscard]] const Inventar& getInventar() const {
+        return inventar;
+    }
+
+    // Împrumuturile create prin imprumuta() sau restaurate deschise sunt programate aici
+    PlanificatorIntarzieri& getIntarzieri() {
+        return intarzieri;
+    }
+
+    // Aduce la zi indexurile actualizate la prima folosire; după el, metodele const nu mai scriu nimic
+    // și pot rula în paralel între ele (modul server le apelează sub un shared_mutex)
+    void actualizeazaIndexuri() {
+        indexCatalog.actualizeaza();
+        indexText.actualizeaza();
+    }
+
+    void afisareCarti() const;
+
+    // Secțiunile de catalog și index ale unui snapshot
+    void salveaza(ScriitorSnapshot& snapshot);
+    void incarca(const CititorSnapshot& snapshot);
+};
+
+#endif //OOP_BIBLIOTECA_H
@@ -0,0 +1,107 @@
+#ifndef OOP_CARTE_H
+#define OOP_CARTE_H
+
+#include "PoolInternare.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Identificatorul unei cărți în catalog (indexul rândului)
+using IdCarte = std::uint32_t;
+
+// Tipul concret al unei cărți; reținut în index ca să nu mai fie nevoie de dynamic_pointer_cast
+enum class TipCarte : std::uint8_t {
+    Generica,
+    Fizica,
+    Digitala
+};
+
+// Starea fizică, ca indice în tabelul de penalități; cărțile digitale și generice sunt "bune"
+enum class StareCarte : std::uint8_t {
+    Buna,
+    Uzata
+};
+
+// Orice altceva decât "uzata" e o carte în stare bună
+constexpr StareCarte stareDinText(std::string_view stareFizica) {
+    return stareFizica == "uzata" ? StareCarte::Uzata : StareCarte::Buna;
+}
+
+constexpr std::string_view numeStare(StareCarte stare) {
+    return stare == StareCarte::Uzata ? "uzata" : "buna";
+}
+
+// Penalitate (interfață abstractă): tariful pe zi de întârziere al cărții, din tabelul de penalități
+// activ, pentru tariful de bază (student); împrumuturile folosesc tariful tipului de utilizator
+class Penalitate {
+public:
+    virtual double calculeazaPenalitate() const = 0; // Elimină parametrul
+    virtual ~Penalitate() = default;
+};
+
+// Clasa de bază: Carte
+class Carte : public Penalitate {
+protected:
+    std::string titlu;
+    std::string autor;
+    int anPublicare;
+
+public:
+    Carte() : titlu(""), autor(""), anPublicare(0) {}
+
+    Carte(const std::string& titlu, const std::string& autor, int anPublicare)
+        : titlu(titlu), autor(autor), anPublicare(anPublicare) {}
+
+    virtual void afisare() const;
+
+    [[nodiscard]] const std::string& getTitlu() const { return titlu; }
+    [[nodiscard]] const std::string& getAutor() const { return autor; }
+    [[nodiscard]] int getAnPublicare() const { return anPublicare; }
+
+    [[nodiscard]] virtual TipCarte getTip() const { return TipCarte::Generica; }
+
+    double calculeazaPenalitate() const override;
+};
+
+// Clasă derivată: CarteFizica
+class CarteFizica : public Carte {
+private:
+    int numarPagini;
+    StareCarte stare; // textul de la intrare e mapat o singură dată, în constructor
+
+public:
+    CarteFizica(const std::string& titlu, const std::string& autor, int anPublicare, int numarPagini, std::string_view stareFizica)
+        : Carte(titlu, autor, anPublicare), numarPagini(numarPagini), stare(stareDinText(stareFizica)) {}
+
+    void afisare() const override;
+
+    [[nodiscard]] TipCarte getTip() const override { return TipCarte::Fizica; }
+    [[nodiscard]] int getNumarPagini() const { return numarPagini; }
+    [[nodiscard]] StareCarte getStare() const { return stare; }
+    [[nodiscard]] std::string_view getStareFizica() const { return numeStare(stare); }
+
+    double calculeazaPenalitate() const override;
+};
+
+// Clasă derivată: CarteDigitala
+class CarteDigitala : public Carte {
+private:
+    float dimensiuneFisier;  // MB
+    std::uint32_t idFormat;  // PDF, EPUB; internat în formate
+    static PoolInternare formate;
+
+public:
+    CarteDigitala(const std::string& titlu, const std::string& autor, int anPublicare, float dimensiuneFisier, std::string_view format)
+        : Carte(titlu, autor, anPublicare), dimensiuneFisier(dimensiuneFisier), idFormat(formate.interneaza(format)) {}
+
+    void afisare() const override;
+
+    [[nodiscard]] TipCarte getTip() const override { return TipCarte::Digitala; }
+    [[nodiscard]] float getDimensiuneFisier() const { return dimensiuneFisier; }
+    [[nodiscard]] const std::string& getFormat() const { return formate[idFormat]; }
+
+    double calculeazaPenalitate() const override;
+};
+
+#endif //OOP_CARTE_H
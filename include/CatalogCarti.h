@@ -0,0 +1,227 @@
+#ifndef OOP_CATALOG_CARTI_H
+#define OOP_CATALOG_CARTI_H
+
+#include "Carte.h"
+#include "Coloana.h"
+#include "ColoanaSiruri.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+class CatalogCarti;
+enum class TipUtilizator : std::uint8_t;
+class CititorSnapshot;
+class ScriitorSnapshot;
+
+// Șiruri cap la cap, văzute prin pointeri (vezi ColoanaSiruri), fără să le dețină
+struct VedereSiruri {
+    const std::uint64_t* inceputuri = nullptr;
+    const char* caractere = nullptr;
+
+    [[nodiscard]] std::string_view operator[](std::uint32_t id) const {
+        return {caractere + inceputuri[id], static_cast<std::size_t>(inceputuri[id + 1] - inceputuri[id])};
+    }
+};
+
+// Coloanele catalogului, ca pointeri la primul element; CarteView citește doar prin ele.
+// A catalogului viu se schimbă la fiecare adăugare, a unei VersiuneCatalog niciodată
+struct VedereCatalog {
+    VedereSiruri titluri;
+    VedereSiruri autori;
+    VedereSiruri detalii;
+    const std::uint32_t* idAutor = nullptr;
+    const std::int32_t* anPublicare = nullptr;
+    const TipCarte* tipuri = nullptr;
+    const std::int32_t* numarPagini = nullptr;
+    const float* dimensiuneFisier = nullptr;
+    const std::uint32_t* idDetaliu = nullptr;
+    std::uint32_t idDetaliuUzata = UINT32_MAX; // id-ul detaliului "uzata", ca starea să fie o comparație de întregi
+    std::size_t numar = 0;
+};
+
+// View ușor peste un rând din catalog; oferă aceeași interfață ca ierarhia Carte fără să aloce
+class CarteView {
+private:
+    const VedereCatalog* vedere;
+    IdCarte id;
+
+public:
+    CarteView(const VedereCatalog& vedere, IdCarte id) : vedere(&vedere), id(id) {}
+    CarteView(const CatalogCarti& catalog, IdCarte id);
+
+    [[nodiscard]] IdCarte getId() const { return id; }
+    [[nodiscard]] std::string_view getTitlu() const;
+    [[nodiscard]] std::string_view getAutor() const;
+    [[nodiscard]] int getAnPublicare() const;
+    [[nodiscard]] TipCarte getTip() const;
+    [[nodiscard]] int getNumarPagini() const;
+    [[nodiscard]] float getDimensiuneFisier() const;
+    [[nodiscard]] std::string_view getStareFizica() const;
+    [[nodiscard]] std::string_view getFormat() const;
+    [[nodiscard]] StareCarte getStare() const;
+
+    // Tariful pe zi din tabelul de penalități activ, pentru un împrumut al unui utilizator de tipul dat
+    [[nodiscard]] double calculeazaPenalitate(TipUtilizator utilizator) const;
+
+    void afisare() const;
+
+    // Reconstruiește obiectul polimorf pentru codul care încă are nevoie de o Carte
+    [[nodiscard]] std::shared_ptr<Carte> materializeaza() const;
+};
+
+// Un rând de catalog dat câmp cu câmp, fără obiect Carte; șirurile sunt copiate la adăugare.
+// stareFizica pentru cărți fizice (normalizată la "buna"/"uzata"), format pentru cele digitale
+struct RandCarte {
+    TipCarte tip;
+    std::string_view titlu;
+    std::string_view autor;
+    std::int32_t anPublicare;
+    std::int32_t numarPagini;
+    float dimensiuneFisier;
+    std::string_view detaliu;
+};
+
+class IteratorCatalog {
+private:
+    const VedereCatalog* vedere;
+    IdCarte id;
+
+public:
+    IteratorCatalog(const VedereCatalog& vedere, IdCarte id) : vedere(&vedere), id(id) {}
+    CarteView operator*() const { return {*vedere, id}; }
+    IteratorCatalog& operator++() { ++id; return *this; }
+    bool operator==(const IteratorCatalog& alt) const { return id == alt.id; }
+};
+
+// Catalogul așa cum era la o publicare (CatalogCarti::publica): nu se mai schimbă, oricâte cărți se
+// adaugă după, deci poate fi parcurs fără nicio blocare cât timp scriitorul continuă. Ține în viață
+// bufferele coloanelor de atunci; cele înlocuite între timp prin creșterea coloanelor sunt eliberate
+// odată cu ultima versiune care le folosește.
+class VersiuneCatalog {
+public:
+    static constexpr std::size_t numarBuffere = 12;
+
+private:
+    VedereCatalog vedere;
+    std::array<std::shared_ptr<const void>, numarBuffere> buffere;
+    std::uint64_t numarVersiune;
+
+public:
+    VersiuneCatalog(const VedereCatalog& vedere, std::array<std::shared_ptr<const void>, numarBuffere> buffere,
+                    std::uint64_t numarVersiune)
+        : vedere(vedere), buffere(std::move(buffere)), numarVersiune(numarVersiune) {}
+
+    VersiuneCatalog(const VersiuneCatalog&) = delete;
+    VersiuneCatalog& operator=(const VersiuneCatalog&) = delete;
+
+    // Crește cu 1 la fiecare publicare
+    [[nodiscard]] std::uint64_t getNumarVersiune() const { return numarVersiune; }
+
+    [[nodiscard]] std::size_t size() const { return vedere.numar; }
+    [[nodiscard]] bool empty() const { return vedere.numar == 0; }
+
+    // View-urile și șirurile întoarse sunt valide cât timp versiunea e ținută
+    [[nodiscard]] CarteView operator[](IdCarte id) const { return {vedere, id}; }
+    [[nodiscard]] IteratorCatalog begin() const { return {vedere, 0}; }
+    [[nodiscard]] IteratorCatalog end() const { return {vedere, static_cast<IdCarte>(vedere.numar)}; }
+    [[nodiscard]] std::string_view titlu(IdCarte id) const { return vedere.titluri[id]; }
+
+    [[nodiscard]] std::span<const std::int32_t> coloanaAnPublicare() const { return {vedere.anPublicare, vedere.numar}; }
+    [[nodiscard]] std::span<const std::uint32_t> coloanaAutor() const { return {vedere.idAutor, vedere.numar}; }
+    [[nodiscard]] std::span<const TipCarte> coloanaTip() const { return {vedere.tipuri, vedere.numar}; }
+    [[nodiscard]] std::span<const std::uint32_t> coloanaDetaliu() const { return {vedere.idDetaliu, vedere.numar}; }
+};
+
+// Catalog stocat pe coloane: titlurile cap la cap într-o coloană de caractere, autorii și detaliile
+// internate, câmpurile numerice în coloane contigue, ca filtrele să fie scanări secvențiale.
+// Toate coloanele se pot mapa direct dintr-un snapshot; prima modificare le copiază în memorie.
+//
+// Un singur scriitor; cititorii din alte fire folosesc doar versiune(), care vede catalogul de la
+// ultima publicare. Fără publica(), adăugările rămân vizibile doar prin catalogul viu.
+class CatalogCarti {
+private:
+    ColoanaSiruri titluri;
+    PoolSiruri autori;
+    PoolSiruri detalii; // stareFizica pentru cărți fizice, format pentru cele digitale
+
+    Coloana<std::uint32_t> idAutor;
+    Coloana<std::int32_t> anPublicare;
+    Coloana<TipCarte> tipuri;
+    Coloana<std::int32_t> numarPagini;   // 0 pentru cărțile care nu sunt fizice
+    Coloana<float> dimensiuneFisier;     // 0 pentru cărțile care nu sunt digitale
+    Coloana<std::uint32_t> idDetaliu;
+
+    static constexpr std::uint32_t faraDetaliu = UINT32_MAX;
+    VedereCatalog vedere; // reîmprospătată după orice modificare a coloanelor
+
+    // Doar copierea pointerului e sub blocare; parcurgerea unei versiuni nu blochează nimic
+    mutable std::mutex mutexVersiune;
+    std::shared_ptr<const VersiuneCatalog> versiunePublicata;
+    std::uint64_t versiuni = 0;
+
+    friend class CarteView;
+
+    void actualizeazaVedere();
+
+public:
+    using Iterator = IteratorCatalog;
+
+    CatalogCarti();
+
+    IdCarte adauga(const Carte& carte);
+    IdCarte adauga(const RandCarte& rand);
+
+    void rezerva(std::size_t numar);
+
+    [[nodiscard]] std::size_t size() const { return tipuri.size(); }
+    [[nodiscard]] bool empty() const { return tipuri.empty(); }
+
+    [[nodiscard]] CarteView operator[](IdCarte id) const { return {vedere, id}; }
+    [[nodiscard]] Iterator begin() const { return {vedere, 0}; }
+    [[nodiscard]] Iterator end() const { return {vedere, static_cast<IdCarte>(size())}; }
+
+    // Publică starea curentă ca versiune nouă; doar scriitorul, după un grup de adăugări care trebuie
+    // văzut întreg (o carte, un lot de import, un snapshot încărcat)
+    void publica();
+
+    // Ultima versiune publicată, fixată cât timp rezultatul e ținut. Poate rula din orice fir,
+    // în paralel cu adăugările: costă o blocare scurtă și o incrementare de contor
+    [[nodiscard]] std::shared_ptr<const VersiuneCatalog> versiune() const {
+        const std::lock_guard<std::mutex> blocare(mutexVersiune);
+        return versiunePublicata;
+    }
+
+    [[nodiscard]] std::span<const std::int32_t> coloanaAnPublicare() const { return anPublicare.span(); }
+    [[nodiscard]] std::span<const std::uint32_t> coloanaAutor() const { return idAutor.span(); }
+    [[nodiscard]] std::span<const TipCarte> coloanaTip() const { return tipuri.span(); }
+    [[nodiscard]] std::span<const std::uint32_t> coloanaDetaliu() const { return idDetaliu.span(); }
+
+    // Id-ul intern al unui autor / al unei stări fizice sau al unui format; nullopt dacă nu apare în catalog
+    [[nodiscard]] std::optional<std::uint32_t> idAutorDupaNume(std::string_view autor) const;
+    [[nodiscard]] std::optional<std::uint32_t> idDetaliuDupaNume(std::string_view detaliu) const;
+
+    // Titlul ca view; valid până la următoarea carte adăugată
+    [[nodiscard]] std::string_view titlu(IdCarte id) const { return titluri[id]; }
+
+    // Filtre prin scanare pe coloană
+    [[nodiscard]] std::vector<IdCarte> cautaDupaAutor(std::string_view autor) const;
+    [[nodiscard]] std::vector<IdCarte> cautaDupaAn(int anMinim, int anMaxim) const;
+
+    [[nodiscard]] std::size_t memorieOcupata() const;
+
+    void salveaza(ScriitorSnapshot& snapshot) const;
+
+    // Înlocuiește conținutul cu coloanele mapate din snapshot, fără copiere
+    void incarca(const CititorSnapshot& snapshot);
+};
+
+inline CarteView::CarteView(const CatalogCarti& catalog, IdCarte id) : vedere(&catalog.vedere), id(id) {}
+
+#endif //OOP_CATALOG_CARTI_H
@@ -0,0 +1,123 @@
+#ifndef OOP_COLOANA_H
+#define OOP_COLOANA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+// Coloană de valori trivial copiabile. Poate fi fie proprie, fie o vedere peste o secțiune
+// dintr-un snapshot mapat în memorie; la prima scriere o coloană mapată se copiază (copy-on-write).
+//
+// Bufferul propriu e partajabil (vezi getProprietar): o versiune publicată a datelor îl ține în viață
+// după ce coloana a crescut într-unul nou. Adăugările scriu doar după ultimul element, deci nu ating
+// ce a văzut deja o versiune; modificarea pe loc copiază întâi un buffer ținut și de altcineva.
+template <typename T>
+class Coloana {
+    static_assert(std::is_trivially_copyable_v<T>, "Coloana stocheaza doar tipuri trivial copiabile");
+
+private:
+    std::shared_ptr<T[]> proprii;
+    std::size_t capacitate = 0;
+    std::shared_ptr<const void> proprietarMapare; // fișierul mapat, dacă a fost dat
+    const T* date = nullptr;
+    std::size_t numar = 0;
+    bool mapata = false;
+
+    void inlocuieste(std::shared_ptr<T[]> nou, std::size_t capacitateNoua, std::size_t numarNou) {
+        proprii = std::move(nou);
+        proprietarMapare.reset();
+        capacitate = capacitateNoua;
+        date = proprii.get();
+        numar = numarNou;
+        mapata = false;
+    }
+
+    // Buffer nou cu valorile curente copiate; cel vechi rămâne cât timp îl mai ține cineva
+    void realoca(std::size_t capacitateNoua) {
+        std::shared_ptr<T[]> nou(new T[capacitateNoua]);
+        std::copy_n(date, numar, nou.get());
+        inlocuieste(std::move(nou), capacitateNoua, numar);
+    }
+
+    void asiguraLoc(std::size_t necesar) {
+        if (mapata || necesar > capacitate) {
+            realoca(std::max(necesar, mapata ? numar : 2 * capacitate));
+        }
+    }
+
+public:
+    Coloana() = default;
+    Coloana(const Coloana&) = delete;
+    Coloana& operator=(const Coloana&) = delete;
+
+    void push_back(const T& valoare) {
+        asiguraLoc(numar + 1);
+        proprii[numar++] = valoare;
+    }
+
+    void extinde(std::span<const T> valori) {
+        asiguraLoc(numar + valori.size());
+        std::copy(valori.begin(), valori.end(), proprii.get() + numar);
+        numar += valori.size();
+    }
+
+    void reserve(std::size_t capacitateNoua) {
+        if (mapata || capacitateNoua > capacitate) {
+            realoca(std::max(capacitateNoua, numar));
+        }
+    }
+
+    void assign(std::size_t numarNou, const T& valoare) {
+        std::shared_ptr<T[]> nou(new T[numarNou]);
+        std::fill_n(nou.get(), numarNou, valoare);
+        inlocuieste(std::move(nou), numarNou, numarNou);
+    }
+
+    template <typename It>
+    void assign(It inceput, It sfarsit) {
+        const auto numarNou = static_cast<std::size_t>(std::distance(inceput, sfarsit));
+        std::shared_ptr<T[]> nou(new T[numarNou]);
+        std::copy(inceput, sfarsit, nou.get());
+        inlocuieste(std::move(nou), numarNou, numarNou);
+    }
+
+    // Acces pentru modificare pe loc; o coloană mapată sau un buffer ținut și de o versiune este copiat întâi
+    T* modifica() {
+        if (mapata || proprii.use_count() > 1) {
+            realoca(numar);
+        }
+        return proprii.get();
+    }
+
+    // Folosește direct memoria mapată, fără copiere; apelantul ține fișierul mapat în viață,
+    // eventual prin `proprietar`, păstrat apoi și de versiunile care văd coloana
+    void mapeaza(std::span<const T> sectiune, std::shared_ptr<const void> proprietar = {}) {
+        proprii.reset();
+        capacitate = 0;
+        proprietarMapare = std::move(proprietar);
+        date = sectiune.data();
+        numar = sectiune.size();
+        mapata = true;
+    }
+
+    // Ce ține în viață elementele văzute acum: bufferul propriu sau fișierul mapat (nul dacă nu a fost dat)
+    [[nodiscard]] std::shared_ptr<const void> getProprietar() const {
+        return mapata ? proprietarMapare : std::shared_ptr<const void>(proprii);
+    }
+
+    [[nodiscard]] const T& operator[](std::size_t i) const { return date[i]; }
+    [[nodiscard]] std::size_t size() const { return numar; }
+    [[nodiscard]] bool empty() const { return numar == 0; }
+    [[nodiscard]] const T* begin() const { return date; }
+    [[nodiscard]] const T* end() const { return date + numar; }
+    [[nodiscard]] std::span<const T> span() const { return {date, numar}; }
+    [[nodiscard]] const T& back() const { return date[numar - 1]; }
+
+    [[nodiscard]] std::size_t memorieOcupata() const { return mapata ? 0 : capacitate * sizeof(T); }
+};
+
+#endif //OOP_COLOANA_H
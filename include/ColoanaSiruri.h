@@ -0,0 +1,97 @@
+#ifndef OOP_COLOANA_SIRURI_H
+#define OOP_COLOANA_SIRURI_H
+
+#include "Coloana.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <unordered_set>
+
+// Șiruri stocate cap la cap într-o singură coloană de caractere, cu o coloană de începuturi
+// (n + 1 valori). Ambele coloane se pot mapa direct dintr-un snapshot.
+// View-urile întoarse sunt valide doar până la următoarea adăugare.
+class ColoanaSiruri {
+private:
+    Coloana<std::uint64_t> inceputuri;
+    Coloana<char> caractere;
+
+public:
+    std::uint32_t adauga(std::string_view sir);
+
+    void rezerva(std::size_t numar, std::size_t numarCaractere);
+
+    [[nodiscard]] std::string_view operator[](std::uint32_t id) const {
+        return {caractere.begin() + inceputuri[id], static_cast<std::size_t>(inceputuri[id + 1] - inceputuri[id])};
+    }
+
+    [[nodiscard]] std::size_t size() const { return inceputuri.empty() ? 0 : inceputuri.size() - 1; }
+
+    [[nodiscard]] const Coloana<std::uint64_t>& getInceputuri() const { return inceputuri; }
+    [[nodiscard]] const Coloana<char>& getCaractere() const { return caractere; }
+
+    // Verifică începuturile (crescătoare, de la 0, în interiorul caracterelor) înainte de mapare,
+    // ca un snapshot corupt să nu ducă la citiri în afara fișierului
+    void mapeaza(std::span<const std::uint64_t> inceputuriMapate, std::span<const char> caractereMapate,
+                 const std::shared_ptr<const void>& proprietar = {});
+
+    [[nodiscard]] std::size_t memorieOcupata() const {
+        return inceputuri.memorieOcupata() + caractere.memorieOcupata();
+    }
+};
+
+// Pool de șiruri internate: fiecare valoare distinctă e stocată o singură dată și primește un id mic.
+// Tabela de dispersie reține doar id-urile; cheile sunt citite din coloana de șiruri.
+class PoolSiruri {
+private:
+    struct Dispersie {
+        using is_transparent = void;
+        const ColoanaSiruri* valori;
+        std::size_t operator()(std::string_view sir) const noexcept { return std::hash<std::string_view>{}(sir); }
+        std::size_t operator()(std::uint32_t id) const noexcept { return (*this)((*valori)[id]); }
+    };
+
+    struct Egalitate {
+        using is_transparent = void;
+        const ColoanaSiruri* valori;
+        bool operator()(std::uint32_t a, std::uint32_t b) const noexcept { return a == b; }
+        bool operator()(std::string_view a, std::uint32_t b) const noexcept { return a == (*valori)[b]; }
+        bool operator()(std::uint32_t a, std::string_view b) const noexcept { return (*valori)[a] == b; }
+    };
+
+    ColoanaSiruri valori;
+    std::unordered_set<std::uint32_t, Dispersie, Egalitate> iduri;
+
+    void reindexeaza();
+
+public:
+    PoolSiruri() : iduri(0, Dispersie{&valori}, Egalitate{&valori}) {}
+
+    // Funcțiile de dispersie rețin adresa coloanei, deci pool-ul nu se copiază și nu se mută
+    PoolSiruri(const PoolSiruri&) = delete;
+    PoolSiruri& operator=(const PoolSiruri&) = delete;
+
+    std::uint32_t interneaza(std::string_view sir);
+
+    // Nu inserează; folosit la filtre, unde o valoare necunoscută înseamnă zero rezultate
+    [[nodiscard]] const std::uint32_t* cauta(std::string_view sir) const {
+        auto it = iduri.find(sir);
+        return it != iduri.end() ? &*it : nullptr;
+    }
+
+    [[nodiscard]] std::string_view operator[](std::uint32_t id) const { return valori[id]; }
+
+    [[nodiscard]] std::size_t size() const { return valori.size(); }
+
+    [[nodiscard]] const ColoanaSiruri& getValori() const { return valori; }
+
+    // Valorile vin mapate din snapshot; tabela de dispersie (de obicei mică) se reconstruiește
+    void mapeaza(std::span<const std::uint64_t> inceputuri, std::span<const char> caractere,
+                 const std::shared_ptr<const void>& proprietar = {});
+
+    [[nodiscard]] std::size_t memorieOcupata() const;
+};
+
+#endif //OOP_COLOANA_SIRURI_H
@@ -0,0 +1,55 @@
+#ifndef OOP_DATA_ZI_H
+#define OOP_DATA_ZI_H
+
+#include <compare>
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <string_view>
+
+// Dată calendaristică compactă (4 octeți): numărul de zile de la 1970-01-01.
+// Se parsează o singură dată la intrare, apoi toate calculele sunt aritmetică pe întregi.
+class DataZi {
+private:
+    std::int32_t zile;
+
+public:
+    constexpr DataZi() : zile(0) {}
+    constexpr explicit DataZi(std::int32_t zile) : zile(zile) {}
+
+    // Algoritmul days_from_civil (H. Hinnant), valid pentru calendarul gregorian proleptic
+    static constexpr DataZi dinCalendar(int an, unsigned luna, unsigned zi) {
+        an -= luna <= 2;
+        const int era = (an >= 0 ? an : an - 399) / 400;
+        const auto anInEra = static_cast<unsigned>(an - era * 400);
+        const unsigned ziInAn = (153 * (luna > 2 ? luna - 3 : luna + 9) + 2) / 5 + zi - 1;
+        const unsigned ziInEra = anInEra * 365 + anInEra / 4 - anInEra / 100 + ziInAn;
+        return DataZi(era * 146097 + static_cast<int>(ziInEra) - 719468);
+    }
+
+    // Parser strict YYYY-MM-DD, fără locale și fără mktime; întoarce nullopt pentru date invalide
+    static std::optional<DataZi> parseaza(std::string_view text);
+
+    // Ca parseaza, dar aruncă ImprumutException pentru date invalide
+    static DataZi parseazaSauArunca(std::string_view text);
+
+    [[nodiscard]] constexpr std::int32_t getZile() const { return zile; }
+
+    // Luna calendaristică, ca an * 12 + (luna - 1): lunile consecutive au indexuri consecutive
+    [[nodiscard]] std::int32_t getIndexLuna() const;
+
+    // Scrie exact 10 caractere YYYY-MM-DD în `destinatie`
+    void scrie(char* destinatie) const;
+
+    [[nodiscard]] std::string toString() const;
+
+    constexpr DataZi operator+(std::int32_t numarZile) const { return DataZi(zile + numarZile); }
+    constexpr std::int32_t operator-(DataZi alta) const { return zile - alta.zile; }
+
+    constexpr auto operator<=>(const DataZi&) const = default;
+};
+
+std::ostream& operator<<(std::ostream& os, DataZi data);
+
+#endif //OOP_DATA_ZI_H
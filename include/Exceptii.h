@@ -0,0 +1,32 @@
+#ifndef OOP_EXCEPTII_H
+#define OOP_EXCEPTII_H
+
+#include <stdexcept>
+#include <string>
+
+// ------------------- EXCEPȚII -------------------
+class ImprumutException : public std::runtime_error {
+public:
+    explicit ImprumutException(const std::string& mesaj) : std::runtime_error(mesaj) {}
+};
+
+// Erori la citirea sau scrierea snapshot-urilor și a jurnalului
+class PersistentaException : public std::runtime_error {
+public:
+    explicit PersistentaException(const std::string& mesaj) : std::runtime_error(mesaj) {}
+};
+
+// Erori care opresc un import întreg (fișier lipsă, antet fără coloanele necesare);
+// rândurile invalide nu aruncă, sunt raportate
+class ImportException : public std::runtime_error {
+public:
+    explicit ImportException(const std::string& mesaj) : std::runtime_error(mesaj) {}
+};
+
+// Erori care opresc modul server (socket indisponibil, adresă ocupată)
+class ServerException : public std::runtime_error {
+public:
+    explicit ServerException(const std::string& mesaj) : std::runtime_error(mesaj) {}
+};
+
+#endif //OOP_EXCEPTII_H
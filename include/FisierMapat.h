@@ -0,0 +1,27 @@
+#ifndef OOP_FISIER_MAPAT_H
+#define OOP_FISIER_MAPAT_H
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+
+// Fișier mapat read-only în memorie (mmap). Pe Windows fișierul este citit într-un buffer,
+// ca snapshot-ul să poată fi înlocuit cât timp catalogul încă îl folosește.
+class FisierMapat {
+private:
+    const std::byte* date = nullptr;
+    std::size_t dimensiune = 0;
+    std::unique_ptr<std::byte[]> buffer;
+
+public:
+    explicit FisierMapat(const std::string& cale);
+    ~FisierMapat();
+
+    FisierMapat(const FisierMapat&) = delete;
+    FisierMapat& operator=(const FisierMapat&) = delete;
+
+    [[nodiscard]] std::span<const std::byte> continut() const { return {date, dimensiune}; }
+};
+
+#endif //OOP_FISIER_MAPAT_H
@@ -0,0 +1,196 @@
+#ifndef OOP_FORMATARE_H
+#define OOP_FORMATARE_H
+
+#include "CatalogCarti.h"
+#include "DataZi.h"
+#include "Utilizator.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Ieșire cu bloc propriu: textul se acumulează în memorie și ajunge în destinație doar când blocul
+// se umple sau la goleste(), nu la fiecare linie ca la endl. Numerele sunt scrise cu to_chars
+class IesireBufferata {
+private:
+    std::ostream* flux = nullptr;
+    std::string* sir = nullptr;
+    std::vector<char> bloc;
+    std::size_t folosit = 0;
+
+    void trimiteBloc();
+
+public:
+    static constexpr std::size_t dimensiuneImplicita = 64 * 1024;
+
+    explicit IesireBufferata(std::ostream& destinatie, std::size_t dimensiuneBloc = dimensiuneImplicita);
+
+    // Destinație în memorie, furnizată de apelant
+    explicit IesireBufferata(std::string& destinatie, std::size_t dimensiuneBloc = dimensiuneImplicita);
+
+    IesireBufferata(const IesireBufferata&) = delete;
+    IesireBufferata& operator=(const IesireBufferata&) = delete;
+
+    ~IesireBufferata();
+
+    void scrie(std::string_view text);
+    void scrieCaracter(char c);
+    void scrieIntreg(std::int64_t valoare);
+    // Ca operator<< implicit al ostream: 6 cifre semnificative
+    void scrieReal(double valoare);
+    void scrieData(DataZi data);
+
+    // Trimite blocul curent și golește fluxul destinație
+    void goleste();
+};
+
+enum class FormatListare {
+    Text, // aceleași linii ca afisare()
+    Csv,  // aceleași coloane ca la import, deci exportul se poate reimporta
+    Json  // un tablou cu câte un obiect pe linie
+};
+
+// nullopt pentru nume necunoscute; acceptă "text", "csv", "json"
+std::optional<FormatListare> formatListareDinNume(std::string_view nume);
+
+// Formatator pentru listări: o listă începe cu inceput*(), primește elemente de același fel
+// și se încheie cu sfarsitLista()
+class Formatator {
+public:
+    static std::unique_ptr<Formatator> creeaza(FormatListare format);
+
+    virtual void inceputCarti(IesireBufferata& iesire) = 0;
+    virtual void carte(IesireBufferata& iesire, const CarteView& carte) = 0;
+
+    virtual void inceputUtilizatori(IesireBufferata& iesire) = 0;
+    virtual void utilizator(IesireBufferata& iesire, const Utilizator& utilizator) = 0;
+
+    virtual void inceputIstoric(IesireBufferata& iesire, const Utilizator& utilizator) = 0;
+    virtual void intrareIstoric(IesireBufferata& iesire, const Utilizator& utilizator, const IstoricImprumut& imprumut,
+                                const CatalogCarti& catalog) = 0;
+
+    virtual void sfarsitLista(IesireBufferata& iesire) = 0;
+
+    virtual ~Formatator() = default;
+};
+
+class FormatatorText : public Formatator {
+public:
+    void inceputCarti(IesireBufferata&) override {}
+    void carte(IesireBufferata& iesire, const CarteView& carte) override;
+    void inceputUtilizatori(IesireBufferata&) override {}
+    void utilizator(IesireBufferata& iesire, const Utilizator& utilizator) override;
+    void inceputIstoric(IesireBufferata& iesire, const Utilizator& utilizator) override;
+    void intrareIstoric(IesireBufferata& iesire, const Utilizator& utilizator, const IstoricImprumut& imprumut,
+                        const CatalogCarti& catalog) override;
+    void sfarsitLista(IesireBufferata&) override {}
+};
+
+class FormatatorCsv : public Formatator {
+public:
+    void inceputCarti(IesireBufferata& iesire) override;
+    void carte(IesireBufferata& iesire, const CarteView& carte) override;
+    void inceputUtilizatori(IesireBufferata& iesire) override;
+    void utilizator(IesireBufferata& iesire, const Utilizator& utilizator) override;
+    void inceputIstoric(IesireBufferata& iesire, const Utilizator& utilizator) override;
+    void intrareIstoric(IesireBufferata& iesire, const Utilizator& utilizator, const IstoricImprumut& imprumut,
+                        const CatalogCarti& catalog) override;
+    void sfarsitLista(IesireBufferata&) override {}
+};
+
+class FormatatorJson : public Formatator {
+private:
+    bool primul = true;
+
+    void inceputObiect(IesireBufferata& iesire);
+
+public:
+    void inceputCarti(IesireBufferata& iesire) override;
+    void carte(IesireBufferata& iesire, const CarteView& carte) override;
+    void inceputUtilizatori(IesireBufferata& iesire) override;
+    void utilizator(IesireBufferata& iesire, const Utilizator& utilizator) override;
+    void inceputIstoric(IesireBufferata& iesire, const Utilizator& utilizator) override;
+    void intrareIstoric(IesireBufferata& iesire, const Utilizator& utilizator, const IstoricImprumut& imprumut,
+                        const CatalogCarti& catalog) override;
+    void sfarsitLista(IesireBufferata& iesire) override;
+};
+
+// Listare pe bucăți: fiecare apel al lui scrieBucata() formatează următoarele rânduri și golește
+// ieșirea, deci apelantul poate intercala alte lucruri (paginare, o cerere nouă) între bucăți
+class CursorListare {
+private:
+    std::size_t pozitie = 0;
+    std::size_t total;
+    bool deschis = false;
+
+protected:
+    Formatator& formatator;
+    IesireBufferata& iesire;
+
+    virtual void deschide() = 0;
+    virtual void scrieElement(std::size_t index) = 0;
+
+public:
+    CursorListare(Formatator& formatator, IesireBufferata& iesire, std::size_t total)
+        : total(total), formatator(formatator), iesire(iesire) {}
+
+    // Cel mult `numarRanduri` rânduri; false după ce lista a fost încheiată
+    bool scrieBucata(std::size_t numarRanduri);
+
+    // Tot ce a rămas, în bucăți de `numarRanduri`
+    void scrieTot(std::size_t numarRanduri = 4096);
+
+    [[nodiscard]] std::size_t getPozitie() const { return pozitie; }
+
+    virtual ~CursorListare() = default;
+};
+
+// Cărțile dintr-o versiune a catalogului, în ordinea id-urilor; versiunea e ținută cât trăiește
+// cursorul, deci adăugările din alte fire nu îl opresc și nu apar în export
+class CursorCatalog : public CursorListare {
+private:
+    std::shared_ptr<const VersiuneCatalog> versiune;
+
+    void deschide() override { formatator.inceputCarti(iesire); }
+    void scrieElement(std::size_t index) override { formatator.carte(iesire, (*versiune)[static_cast<IdCarte>(index)]); }
+
+public:
+    CursorCatalog(std::shared_ptr<const VersiuneCatalog> versiune, Formatator& formatator, IesireBufferata& iesire)
+        : CursorListare(formatator, iesire, versiune->size()), versiune(std::move(versiune)) {}
+};
+
+// Istoricul unui utilizator, cronologic, sau doar pozițiile [inceput, sfarsit) din el (vezi
+// IstoricImprumuturi::pozitie). Blocurile sunt decomprimate câte o pagină odată; nu se adaugă
+// împrumuturi noi cât timp cursorul e folosit
+class CursorIstoric : public CursorListare {
+private:
+    static constexpr std::size_t dimensiunePagina = 1024;
+
+    const Utilizator& utilizator;
+    const CatalogCarti& catalog;
+    std::size_t inceput;
+    std::vector<IstoricImprumut> pagina;
+    std::size_t inceputPagina = 0;
+
+    void deschide() override { formatator.inceputIstoric(iesire, utilizator); }
+    void scrieElement(std::size_t index) override;
+
+public:
+    CursorIstoric(const Utilizator& utilizator, const CatalogCarti& catalog, Formatator& formatator, IesireBufferata& iesire)
+        : CursorIstoric(utilizator, catalog, formatator, iesire, 0, utilizator.getIstoric().numar()) {}
+
+    CursorIstoric(const Utilizator& utilizator, const CatalogCarti& catalog, Formatator& formatator, IesireBufferata& iesire,
+                  std::size_t inceput, std::size_t sfarsit)
+        : CursorListare(formatator, iesire, sfarsit - inceput), utilizator(utilizator), catalog(catalog), inceput(inceput) {}
+};
+
+// Lista completă de utilizatori, o singură bucată (sunt puțini față de cărți și istoric)
+void scrieUtilizatori(std::span<const std::shared_ptr<Utilizator>> utilizatori, Formatator& formatator, IesireBufferata& iesire);
+
+#endif //OOP_FORMATARE_H
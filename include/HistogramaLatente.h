@@ -0,0 +1,41 @@
+#ifndef OOP_HISTOGRAMA_LATENTE_H
+#define OOP_HISTOGRAMA_LATENTE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Histogramă de latențe în nanosecunde, cu găleți log-liniare: fiecare putere a lui 2 e împărțită
+// în 16 găleți egale, deci percentilele au o eroare relativă de cel mult 1/16, de la 1 ns la ore.
+// Înregistrarea e un singur fetch_add relaxat, fără blocare, din oricâte fire.
+class HistogramaLatente {
+public:
+    static constexpr unsigned subgaleti = 16;
+    static constexpr std::size_t numarGaleti = 64 * subgaleti;
+
+private:
+    std::array<std::atomic<std::uint64_t>, numarGaleti> galeti{};
+    std::atomic<std::uint64_t> numar{0};
+    std::atomic<std::uint64_t> suma{0};
+    std::atomic<std::uint64_t> maxim{0};
+
+    static std::size_t galeata(std::uint64_t nanosecunde);
+    static std::uint64_t limitaSuperioara(std::size_t galeata);
+
+public:
+    void inregistreaza(std::uint64_t nanosecunde);
+
+    // Cea mai mică valoare sub care se află fracțiunea `p` (0..1) din înregistrări, rotunjită în sus la găleată
+    [[nodiscard]] std::uint64_t percentila(double p) const;
+
+    [[nodiscard]] std::uint64_t getNumar() const { return numar.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t getMaxim() const { return maxim.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t getSuma() const { return suma.load(std::memory_order_relaxed); }
+    [[nodiscard]] double medie() const;
+
+    // Câte înregistrări sunt cel mult `limita`; exact pentru puteri ale lui 2, care cad pe marginea de sus a unei găleți
+    [[nodiscard]] std::uint64_t numarCelMult(std::uint64_t limita) const;
+};
+
+#endif //OOP_HISTOGRAMA_LATENTE_H
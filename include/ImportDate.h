@@ -0,0 +1,72 @@
+#ifndef OOP_IMPORT_DATE_H
+#define OOP_IMPORT_DATE_H
+
+#include "Biblioteca.h"
+#include "Imprumut.h"
+#include "Utilizator.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+enum class FormatImport {
+    Csv,  // prima linie e antetul cu numele coloanelor
+    Jsonl // un obiect JSON plat pe fiecare linie
+};
+
+struct RandInvalid {
+    std::size_t linie; // numerotare de la 1, antetul CSV inclus
+    std::string motiv;
+};
+
+struct RaportImport {
+    // Doar primele erori sunt reținute cu mesaj; restul sunt doar numărate
+    static constexpr std::size_t maximEroriRetinute = 1000;
+
+    std::size_t randuriCitite = 0;
+    std::size_t randuriImportate = 0;
+    std::size_t randuriInvalide = 0;
+    std::vector<RandInvalid> erori;
+    double secunde = 0;
+
+    void adaugaEroare(std::size_t linie, std::string motiv);
+
+    [[nodiscard]] double randuriPeSecunda() const {
+        return secunde > 0 ? static_cast<double>(randuriCitite) / secunde : 0;
+    }
+
+    // Sumarul și cel mult `maximErori` rânduri invalide
+    void afisare(std::size_t maximErori = 10) const;
+};
+
+// Import masiv din fișiere CSV sau JSONL. Fișierul se citește în blocuri mari; liniile unui bloc sunt
+// parsate în paralel direct în buffer (câmpurile sunt view-uri, ghilimelele și escape-urile se rezolvă
+// pe loc), apoi rândurile valide se adaugă în ordinea din fișier.
+// Coloane:
+//   carti:       tip (Fizica/Digitala), titlu, autor, anPublicare, numarPagini, stareFizica, dimensiuneFisier, format
+//   utilizatori: tip (Student/Profesor), nume, email, facultateDepartament
+//   imprumuturi: email, titlu, dataImprumut, dataReturnare (YYYY-MM-DD)
+// Un rând invalid este trecut în raport și importul continuă; doar erorile de fișier aruncă ImportException.
+class ImportDate {
+private:
+    unsigned numarFire;
+    std::size_t dimensiuneBloc;
+
+public:
+    explicit ImportDate(unsigned numarFire = 0, std::size_t dimensiuneBloc = std::size_t{8} << 20);
+
+    // .jsonl / .json înseamnă JSONL, orice altceva CSV
+    static FormatImport detecteazaFormat(const std::string& cale);
+
+    RaportImport importaCarti(const std::string& cale, BibliotecaSingleton& biblioteca) const;
+
+    RaportImport importaUtilizatori(const std::string& cale, std::vector<std::shared_ptr<Utilizator>>& utilizatori) const;
+
+    // Utilizatorii și cărțile trebuie să existe deja; rândurile peste limita utilizatorului
+    // sau fără exemplar disponibil sunt raportate ca erori
+    RaportImport importaImprumuturi(const std::string& cale, BibliotecaSingleton& biblioteca,
+                                    std::vector<std::shared_ptr<ImprumutAbstract>>& imprumuturi) const;
+};
+
+#endif //OOP_IMPORT_DATE_H
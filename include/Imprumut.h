@@ -0,0 +1,147 @@
+#ifndef OOP_IMPRUMUT_H
+#define OOP_IMPRUMUT_H
+
+#include "AlocatorIduri.h"
+#include "Analitice.h"
+#include "Carte.h"
+#include "CatalogCarti.h"
+#include "DataZi.h"
+#include "Inventar.h"
+#include "Metrici.h"
+#include "PoliticaPenalitati.h"
+#include "Utilizator.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Identificatorul unui împrumut; 0 înseamnă "id nou" la creare
+using IdImprumut = std::uint64_t;
+
+// Clasă abstractă: ImprumutAbstract
+class ImprumutAbstract {
+protected:
+    IdImprumut idImprumut;
+    DataZi dataImprumut;
+    DataZi dataReturnare;
+    Utilizator& utilizator;
+    CarteView carte; // handle spre rândul din catalog, nu o copie a cărții
+    // Copiate la creare, ca motorul de penalități să nu mai facă apeluri virtuale: tipul cărții și
+    // tariful din tabelul de penalități pentru tipul cărții × starea ei × tipul utilizatorului
+    TipCarte tipCarte;
+    double penalitateZi;
+    // Cât s-a trecut deja în contul utilizatorului pentru acest împrumut; motorul de penalități,
+    // planificatorul și meniul îl pot actualiza din fire diferite
+    std::atomic<double> penalitateAplicata{0};
+    std::uint8_t exemplar = Inventar::faraExemplar; // exemplarul luat de pe raft, pentru cărțile fizice
+    std::atomic<bool> returnat{false};
+
+    static AlocatorIduri alocatorIduri;
+
+public:
+    // Sigur de apelat din mai multe fire: id-ul, contorul și istoricul utilizatorului suportă creări concurente
+    ImprumutAbstract(IdImprumut id, DataZi imprumut, DataZi returnare, const CarteView& carte, Utilizator& utilizator)
+        : idImprumut(id), dataImprumut(imprumut), dataReturnare(returnare), utilizator(utilizator), carte(carte),
+          tipCarte(carte.getTip()), penalitateZi(carte.calculeazaPenalitate(utilizator.getTip())) {
+        metrici.imprumuturiCreate.adauga();
+        analitice.imprumutCreat(carte.getId(), utilizator, imprumut);
+        utilizator.adaugaImprumut(IstoricImprumut(carte.getId(), imprumut, returnare)); // Adaugarea în istoric
+    }
+
+    // Fără contenție între fire; id-urile sunt unice, dar crescătoare doar în cadrul aceluiași fir
+    static IdImprumut genereazaID() {
+        return alocatorIduri.genereaza();
+    }
+
+    // După încărcarea unor împrumuturi salvate, id-urile noi continuă după cel mai mare id existent
+    static void avanseazaContorID(IdImprumut id) {
+        alocatorIduri.avanseazaDupa(id);
+    }
+
+    // Suma contoarelor pe fire: sigur și când împrumuturile sunt create în paralel
+    static std::uint64_t getNumarTotalImprumuturi() {
+        return metrici.imprumuturiCreate.valoare();
+    }
+
+    [[nodiscard]] IdImprumut getId() const { return idImprumut; }
+    [[nodiscard]] IdCarte getIdCarte() const { return carte.getId(); }
+    [[nodiscard]] CarteView getCarte() const { return carte; }
+    [[nodiscard]] DataZi getDataImprumut() const { return dataImprumut; }
+    [[nodiscard]] DataZi getDataReturnare() const { return dataReturnare; }
+    [[nodiscard]] TipCarte getTipCarte() const { return tipCarte; }
+    [[nodiscard]] double getPenalitateZi() const { return penalitateZi; }
+    [[nodiscard]] double getPenalitateAplicata() const { return penalitateAplicata.load(std::memory_order_relaxed); }
+    [[nodiscard]] Utilizator& getUtilizator() const { return utilizator; }
+    [[nodiscard]] std::uint8_t getExemplar() const { return exemplar; }
+    [[nodiscard]] bool esteReturnat() const { return returnat.load(std::memory_order_acquire); }
+
+    void seteazaExemplar(std::uint8_t numar) { exemplar = numar; }
+
+    // true doar pentru primul apel, ca o returnare dublă să nu elibereze de două ori exemplarul
+    bool marcheazaReturnat() { return !returnat.exchange(true, std::memory_order_acq_rel); }
+
+    // Doar calculează; nu modifică nimic, deci poate rula în paralel. Aceeași regulă pentru
+    // toate tipurile de împrumut, diferă doar tariful copiat la creare
+    double calculeazaPenalitate(DataZi returnare) const {
+        MASOARA_LATENTA(metrici.calculPenalitate);
+        return TabelPenalitati::curent().penalitate(returnare - dataImprumut, penalitateZi);
+    }
+
+    // Trece în contul utilizatorului doar diferența față de ce s-a aplicat deja pentru acest împrumut;
+    // aplicat de două ori cu aceeași valoare nu taxează de două ori. Schimbul e atomic, deci la aplicări
+    // concurente diferențele se însumează exact până la ultima valoare scrisă
+    void aplicaPenalitate(double penalitate) {
+        const double anterioara = penalitateAplicata.exchange(penalitate, std::memory_order_relaxed);
+        if (penalitate != anterioara) {
+            utilizator.adaugaPenalitate(penalitate - anterioara);
+        }
+    }
+
+    // La încărcare: penalitatea e deja inclusă în soldul salvat al utilizatorului
+    void restaureazaPenalitateAplicata(double penalitate) {
+        penalitateAplicata.store(penalitate, std::memory_order_relaxed);
+    }
+
+    virtual ~ImprumutAbstract() = default;
+};
+
+// Clasă derivată: ImprumutCarteFizica
+class ImprumutCarteFizica : public ImprumutAbstract {
+public:
+    ImprumutCarteFizica(DataZi imprumut, DataZi returnare, const CarteView& carte, Utilizator& utilizator,
+                        IdImprumut id = genereazaID())
+        : ImprumutAbstract(id, imprumut, returnare, carte, utilizator) {}
+
+    void afisare() const;
+};
+
+// Clasă derivată: ImprumutCarteDigitala
+class ImprumutCarteDigitala : public ImprumutAbstract {
+public:
+    ImprumutCarteDigitala(DataZi imprumut, DataZi returnare, const CarteView& carte, Utilizator& utilizator,
+                          IdImprumut id = genereazaID())
+        : ImprumutAbstract(id, imprumut, returnare, carte, utilizator) {}
+
+    void afisare() const;
+};
+
+// Design Pattern: Factory for creating loans
+// Alege clasa concretă după tipul cărții din catalog; folosit de meniu și la refacerea din jurnal.
+// Împrumuturile (obiect + bloc de control shared_ptr) vin din pool-uri dedicate, nu din heap-ul general
+class ImprumutFactory {
+public:
+    // nullptr pentru cărțile care nu se pot împrumuta (nici fizice, nici digitale).
+    // id 0 înseamnă un id nou; un id dat (la refacere) avansează contorul după el
+    static std::shared_ptr<ImprumutAbstract> creareImprumut(const CarteView& carte, Utilizator& utilizator,
+                                                            DataZi imprumut, DataZi returnare, IdImprumut id = 0);
+};
+
+// Lista de împrumuturi e ținută ordonată după id, ca căutarea să fie binară. Id-urile create pe fire
+// diferite nu vin în ordine, deci adăugarea caută locul de la coadă; de obicei e chiar la final
+void adaugaImprumut(std::vector<std::shared_ptr<ImprumutAbstract>>& imprumuturi, std::shared_ptr<ImprumutAbstract> imprumut);
+
+// nullptr dacă id-ul lipsește
+ImprumutAbstract* cautaImprumut(const std::vector<std::shared_ptr<ImprumutAbstract>>& imprumuturi, IdImprumut id);
+
+#endif //OOP_IMPRUMUT_H
@@ -0,0 +1,87 @@
+#ifndef OOP_INDEX_TEXT_H
+#define OOP_INDEX_TEXT_H
+
+#include "Carte.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class CatalogCarti;
+
+struct RezultatText {
+    IdCarte id;
+    float scor;
+};
+
+// Index inversat pe cuvintele din titlu și autor. Cuvintele sunt normalizate (litere mici,
+// fără diacritice: "Ştefan", "ștefan" și "stefan" sunt același cuvânt), iar fiecare cuvânt are o
+// listă de cărți comprimată: diferența față de id-ul anterior și frecvența, ca varint.
+// Lista e împărțită în blocuri de câte 128 de cărți; fiecare bloc își ține primul id (pentru salt)
+// și o limită superioară a scorului, ca blocurile care nu pot intra în top-k să nu fie decodate.
+class IndexText {
+public:
+    static constexpr std::size_t dimensiuneBloc = 128;
+
+    struct Bloc {
+        IdCarte primul;
+        std::uint32_t offset;        // în octeții listei
+        std::uint16_t frecventaMaxima;
+        std::uint16_t lungimeMinima; // cuvinte în titlu + autor
+    };
+
+    struct ListaPostari {
+        std::vector<std::uint8_t> octeti;
+        std::vector<Bloc> blocuri;
+        IdCarte ultimul = 0;
+        std::uint32_t numar = 0;
+        std::uint16_t frecventaMaxima = 0; // pe toată lista
+        std::uint16_t lungimeMinima = UINT16_MAX;
+    };
+
+private:
+    struct Dispersie {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view sir) const { return std::hash<std::string_view>{}(sir); }
+    };
+
+    const CatalogCarti& catalog;
+    std::size_t indexate = 0;
+    std::unordered_map<std::string, std::uint32_t, Dispersie, std::equal_to<>> termeni;
+    std::vector<ListaPostari> liste;     // după id-ul termenului
+    std::vector<std::uint16_t> lungimi;  // după id-ul cărții
+    std::uint64_t lungimeTotala = 0;
+
+    void adaugaCarte(IdCarte id);
+
+public:
+    // Parametrii BM25
+    static constexpr float k1 = 1.2f;
+    static constexpr float b = 0.75f;
+
+    explicit IndexText(const CatalogCarti& catalog) : catalog(catalog) {}
+
+    IndexText(const IndexText&) = delete;
+    IndexText& operator=(const IndexText&) = delete;
+
+    // Cuvintele normalizate din text, în ordine, cu repetiții
+    static std::vector<std::string> cuvinte(std::string_view text);
+
+    // Indexează cărțile adăugate în catalog de la ultimul apel
+    void actualizeaza();
+
+    // După ce catalogul a fost înlocuit (încărcare din snapshot)
+    void reseteaza();
+
+    // Cele mai bune `k` cărți care conțin toate cuvintele din `text`, după BM25, descrescător.
+    // Lista celui mai rar cuvânt conduce căutarea; celelalte liste sunt avansate prin salturi de bloc
+    [[nodiscard]] std::vector<RezultatText> cauta(std::string_view text, std::size_t k) const;
+
+    [[nodiscard]] std::size_t numarTermeni() const { return liste.size(); }
+    [[nodiscard]] std::size_t memorieOcupata() const;
+};
+
+#endif //OOP_INDEX_TEXT_H
@@ -0,0 +1,113 @@
+#ifndef OOP_INDEX_TITLURI_H
+#define OOP_INDEX_TITLURI_H
+
+#include "Carte.h"
+#include "Coloana.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <set>
+#include <string_view>
+#include <vector>
+
+class CatalogCarti;
+class CititorSnapshot;
+class ScriitorSnapshot;
+
+// Rezultatul unei căutări în index: id-ul cărții în catalog și tipul ei concret
+struct IntrareTitlu {
+    IdCarte id;
+    TipCarte tip;
+};
+
+// Index pe titluri. Nu copiază titlurile: reține doar id-uri și le citește din catalog.
+// Potrivirea exactă folosește o tabelă cu adresare deschisă, iar ordinea alfabetică o secvență
+// sortată plus un tampon mic pentru cărțile adăugate de la ultima compactare.
+// Ambele structuri sunt coloane plate, deci se salvează și se mapează din snapshot așa cum sunt.
+// Intervalele și paginile se citesc direct din ordinea întreținută, fără vreo sortare la cerere.
+class IndexTitluri {
+public:
+    struct Slot {
+        IdCarte id;
+        std::uint32_t amprenta;
+    };
+
+private:
+    static constexpr IdCarte slotLiber = ~IdCarte{0};
+
+    // Compară (titlu, id), ca la titluri egale ordinea să fie cea de adăugare
+    struct ComparatorTitlu {
+        using is_transparent = void;
+        const CatalogCarti* catalog;
+        bool operator()(IdCarte a, IdCarte b) const;
+        bool operator()(IdCarte a, std::string_view b) const;
+        bool operator()(std::string_view a, IdCarte b) const;
+    };
+
+    const CatalogCarti& catalog;
+    Coloana<Slot> sloturi;
+    std::size_t ocupate = 0;
+    Coloana<IdCarte> ordonate;
+    std::set<IdCarte, ComparatorTitlu> tampon;
+    std::vector<IdCarte> loturi; // adăugate prin adaugaLot, încă neordonate
+
+    // FNV-1a pe 32 de biți: stabilă între compilatoare, ca tabela să poată fi mapată din snapshot
+    static std::uint32_t amprenta(std::string_view titlu);
+
+    void insereazaExact(IdCarte id, std::uint32_t amprentaTitlu);
+    void redimensioneaza(std::size_t numarSloturi);
+
+    // Interclasează secvența sortată și tamponul de la pozițiile date, cât timp titlurile respectă `inInterval`
+    template <typename Conditie>
+    std::vector<IntrareTitlu> parcurge(const IdCarte* itOrdonate, std::set<IdCarte, ComparatorTitlu>::const_iterator itTampon,
+                                       std::size_t limita, Conditie inInterval) const;
+
+public:
+    explicit IndexTitluri(const CatalogCarti& catalog)
+        : catalog(catalog), tampon(ComparatorTitlu{&catalog}) {}
+
+    IndexTitluri(const IndexTitluri&) = delete;
+    IndexTitluri& operator=(const IndexTitluri&) = delete;
+
+    // Cartea `id` trebuie să fie deja în catalog
+    void adauga(IdCarte id);
+
+    // Cărțile [primul, sfarsit), adăugate în catalog dintr-o dată (import). Intră imediat în
+    // potrivirea exactă, dar în ordinea alfabetică abia la compacteaza(): loturile succesive se
+    // sortează și se interclasează o singură dată, nu carte cu carte
+    void adaugaLot(IdCarte primul, IdCarte sfarsit);
+
+    // Reconstruiește indexul pentru tot catalogul
+    void reconstruieste();
+
+    // Mută tamponul și loturile în secvența sortată
+    void compacteaza();
+
+    // Prima carte adăugată cu titlul dat, la fel ca vechea căutare liniară
+    [[nodiscard]] std::optional<IntrareTitlu> cauta(std::string_view titlu) const;
+
+    // Cel mult `limita` cărți al căror titlu începe cu `prefix`, în ordine alfabetică
+    [[nodiscard]] std::vector<IntrareTitlu> cautaPrefix(std::string_view prefix, std::size_t limita) const;
+
+    // Cel mult `limita` cărți cu titlul în [dela, panaLa), în ordine alfabetică; panaLa gol = fără capăt
+    [[nodiscard]] std::vector<IntrareTitlu> cautaInterval(std::string_view dela, std::string_view panaLa, std::size_t limita) const;
+
+    // Următoarele `marime` cărți cu titlul strict după `titlu` (gol = de la început)
+    [[nodiscard]] std::vector<IntrareTitlu> paginaDupa(std::string_view titlu, std::size_t marime) const;
+
+    // Pagina care urmează după cartea `ultima`, ultima de pe pagina anterioară. Spre deosebire de
+    // varianta cu titlu, nu sare peste cărțile cu același titlu rămase pe pagina următoare
+    [[nodiscard]] std::vector<IntrareTitlu> paginaDupa(IdCarte ultima, std::size_t marime) const;
+
+    void rezerva(std::size_t numar);
+
+    [[nodiscard]] std::size_t size() const { return ordonate.size() + tampon.size() + loturi.size(); }
+
+    // Salvează indexul compactat; apelantul compactează înainte
+    void salveaza(ScriitorSnapshot& snapshot) const;
+
+    void incarca(const CititorSnapshot& snapshot);
+};
+
+#endif //OOP_INDEX_TITLURI_H
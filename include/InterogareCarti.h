@@ -0,0 +1,89 @@
+#ifndef OOP_INTEROGARE_CARTI_H
+#define OOP_INTEROGARE_CARTI_H
+
+#include "Carte.h"
+#include "MultimeBiti.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+class CatalogCarti;
+
+enum class OrdonareCarti {
+    Id, // ordinea adăugării
+    Titlu,
+    AnPublicare,
+    Autor
+};
+
+// Interogare pe catalog: toate filtrele date trebuie îndeplinite (ȘI); cele lipsă nu filtrează.
+// stareFizica implică o carte fizică, format una digitală
+struct Interogare {
+    std::optional<std::string> autor;
+    std::optional<int> anMinim;
+    std::optional<int> anMaxim;
+    std::optional<TipCarte> tip;
+    std::optional<std::string> stareFizica;
+    std::optional<std::string> format;
+
+    OrdonareCarti ordonare = OrdonareCarti::Id;
+    bool descrescator = false;
+    std::size_t deplasament = 0;
+    std::size_t limita = std::numeric_limits<std::size_t>::max();
+};
+
+// Indexul de la care a pornit execuția; restul filtrelor sunt verificate pe candidații lui
+enum class SursaInterogare {
+    Nimic,      // un filtru nu se potrivește cu nimic din catalog (autor sau stare necunoscută)
+    Catalog,    // fără filtre: tot catalogul
+    Autor,      // lista de cărți a autorului
+    Ani,        // intervalul de ani
+    MultimiBiti // intersecția bitmap-urilor de tip și stare/format
+};
+
+struct RezultatInterogare {
+    std::vector<IdCarte> carti; // pagina cerută, în ordinea cerută
+    std::size_t total = 0;      // câte cărți îndeplinesc filtrele, înainte de deplasament și limită
+    SursaInterogare sursa = SursaInterogare::Nimic;
+};
+
+// Indexuri secundare pe catalog: lista de cărți a fiecărui autor, cărțile pe ani și bitmap-uri
+// pentru tipul cărții și pentru fiecare valoare de stare fizică / format (vocabular mic: buna, uzata, PDF...).
+// Nu ține titluri sau alte șiruri; se actualizează incremental cu cărțile adăugate de la ultima interogare
+class IndexCatalog {
+private:
+    const CatalogCarti& catalog;
+    std::size_t indexate = 0;
+
+    std::vector<std::vector<IdCarte>> cartiAutor;      // după id-ul intern al autorului
+    std::map<std::int32_t, std::vector<IdCarte>> cartiAn;
+    std::array<MultimeBiti, 3> cartiTip;                // după TipCarte
+    std::vector<MultimeBiti> cartiDetaliu;             // după id-ul intern al stării / formatului
+
+public:
+    explicit IndexCatalog(const CatalogCarti& catalog) : catalog(catalog) {}
+
+    IndexCatalog(const IndexCatalog&) = delete;
+    IndexCatalog& operator=(const IndexCatalog&) = delete;
+
+    // Indexează cărțile adăugate în catalog de la ultimul apel
+    void actualizeaza();
+
+    // După ce catalogul a fost înlocuit (încărcare din snapshot)
+    void reseteaza();
+
+    // Pornește de la indexul cu cei mai puțini candidați și verifică restul filtrelor pe coloane;
+    // când bitmap-urile sunt cele mai selective, le intersectează întâi pe toate.
+    // Apelantul face actualizeaza() înainte, dacă între timp s-au adăugat cărți
+    [[nodiscard]] RezultatInterogare executa(const Interogare& interogare) const;
+
+    [[nodiscard]] std::size_t memorieOcupata() const;
+};
+
+#endif //OOP_INTEROGARE_CARTI_H
@@ -0,0 +1,106 @@
+#ifndef OOP_INVENTAR_H
+#define OOP_INVENTAR_H
+
+#include "Carte.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+class CatalogCarti;
+class Utilizator;
+
+// Exemplarele fiecărei cărți fizice și cine le are. Pentru fiecare carte, un cuvânt de 64 de biți
+// ține exemplarele aflate pe raft: împrumutul ia bitul cel mai de jos printr-un CAS, returnarea
+// îl pune la loc, deci ambele sunt în timp constant și fără blocare, chiar pe aceeași carte.
+// Stările cărților stau în segmente care nu se mută niciodată, ca firele care împrumută
+// să nu vadă realocări când catalogul crește. Indexul invers exemplar -> utilizator
+// e împărțit în shard-uri, fiecare cu propriul mutex, ca registrul de utilizatori.
+class Inventar {
+public:
+    static constexpr unsigned maximExemplare = 64;
+    // Exemplarul unui împrumut digital: nu ocupă nimic din inventar
+    static constexpr std::uint8_t faraExemplar = 0xFF;
+    static constexpr std::size_t numarSharduri = 64;
+
+private:
+    struct StareCarte {
+        std::atomic<std::uint64_t> libere{0}; // bitul i: exemplarul i e pe raft
+        std::atomic<std::uint8_t> exemplare{0};
+        TipCarte tip = TipCarte::Generica;    // copiat din catalog, ca împrumutul să nu citească din coloane
+    };
+
+    static constexpr unsigned bitiSegment = 16;
+    static constexpr std::size_t cartiPeSegment = std::size_t{1} << bitiSegment;
+    static constexpr std::size_t numarSegmente = (std::size_t{1} << 32) >> bitiSegment;
+
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::unordered_map<std::uint64_t, Utilizator*> detinatori; // (carte, exemplar) -> utilizator
+    };
+
+    const CatalogCarti& catalog;
+    std::mutex mutexScriere; // actualizeaza și seteazaExemplare, între ele
+    std::atomic<std::size_t> indexate{0};
+    std::unique_ptr<std::unique_ptr<StareCarte[]>[]> segmente;
+    mutable std::array<Shard, numarSharduri> sharduri;
+
+    static std::uint64_t cheie(IdCarte id, std::uint8_t exemplar) {
+        return std::uint64_t{id} << 8 | exemplar;
+    }
+
+    Shard& shard(std::uint64_t cheie) const {
+        return sharduri[(cheie * 0x9E3779B97F4A7C15ULL) >> 58 & (numarSharduri - 1)];
+    }
+
+    // Doar pentru id-uri deja publicate prin `indexate`
+    StareCarte& stare(IdCarte id) const { return segmente[id >> bitiSegment][id & (cartiPeSegment - 1)]; }
+
+    StareCarte& stareIndexata(IdCarte id) const;
+
+    void seteazaDetinator(IdCarte id, std::uint8_t exemplar, Utilizator* utilizator);
+
+public:
+    explicit Inventar(const CatalogCarti& catalog);
+
+    Inventar(const Inventar&) = delete;
+    Inventar& operator=(const Inventar&) = delete;
+
+    // Cărțile adăugate în catalog de la ultimul apel: cele fizice primesc un exemplar
+    void actualizeaza();
+
+    // După încărcarea catalogului dintr-un snapshot; `exemplare` e gol pentru snapshot-uri fără inventar.
+    // Nu poate rula în paralel cu împrumuturi
+    void incarca(std::span<const std::uint8_t> exemplare);
+
+    // Adaugă exemplare sau scoate exemplare aflate pe raft; ImprumutException pentru cărți nefizice,
+    // peste maximExemplare sau dacă exemplarele scoase sunt împrumutate
+    void seteazaExemplare(IdCarte id, unsigned numar);
+
+    // Ocupă un loc din limita utilizatorului și ia un exemplar de pe raft. Întoarce exemplarul,
+    // faraExemplar pentru cărțile digitale; ImprumutException dacă limita e atinsă sau nu e niciun exemplar
+    std::uint8_t imprumuta(IdCarte id, Utilizator& utilizator);
+
+    // Exemplarul revine pe raft, iar utilizatorul își recapătă locul din limită
+    void returneaza(IdCarte id, std::uint8_t exemplar, Utilizator& utilizator);
+
+    // Refacerea unui împrumut activ salvat, fără verificarea limitei (era respectată la creare)
+    void restaureaza(IdCarte id, std::uint8_t exemplar, Utilizator& utilizator);
+
+    [[nodiscard]] unsigned exemplare(IdCarte id) const;
+    [[nodiscard]] unsigned disponibile(IdCarte id) const;
+
+    // Cine are exemplarul; nullptr dacă e pe raft
+    [[nodiscard]] Utilizator* detinator(IdCarte id, std::uint8_t exemplar) const;
+
+    // Numărul de exemplare pentru fiecare carte, în ordinea id-urilor (secțiunea din snapshot)
+    [[nodiscard]] std::vector<std::uint8_t> exemplarePerCarte() const;
+};
+
+#endif //OOP_INVENTAR_H
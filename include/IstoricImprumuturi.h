@@ -0,0 +1,112 @@
+#ifndef OOP_ISTORIC_IMPRUMUTURI_H
+#define OOP_ISTORIC_IMPRUMUTURI_H
+
+#include "Carte.h"
+#include "DataZi.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+// 12 octeți, fără șiruri: titlul se citește din catalog la afișare
+class IstoricImprumut {
+public:
+    IdCarte idCarte;
+    DataZi dataImprumut;
+    DataZi dataReturnare;
+
+    IstoricImprumut(IdCarte idCarte, DataZi imprumut, DataZi returnare)
+        : idCarte(idCarte), dataImprumut(imprumut), dataReturnare(returnare) {}
+};
+
+// Fișier temporar comun tuturor istoricelor, în care ajung blocurile reci. Nu e persistență:
+// istoricul se reface la încărcare din împrumuturi, iar fișierul e golit la deschidere și șters la final
+class ArhivaIstoric {
+private:
+    std::string cale;
+    mutable std::mutex mutexFisier;
+    mutable std::fstream fisier;
+    std::uint64_t lungime = 0;
+
+public:
+    explicit ArhivaIstoric(std::string cale);
+    ~ArhivaIstoric();
+
+    ArhivaIstoric(const ArhivaIstoric&) = delete;
+    ArhivaIstoric& operator=(const ArhivaIstoric&) = delete;
+
+    // Adaugă octeții la sfârșit și întoarce poziția lor
+    std::uint64_t scrie(std::span<const std::uint8_t> octeti);
+    [[nodiscard]] std::vector<std::uint8_t> citeste(std::uint64_t pozitie, std::uint32_t numarOcteti) const;
+
+    [[nodiscard]] std::uint64_t getLungime() const;
+};
+
+// Istoricul unui utilizator, ordonat după data împrumutului, în blocuri coloanare comprimate:
+// datele ca diferențe față de precedenta, durata împrumutului și diferența id-urilor de carte,
+// toate varint, de obicei 3-5 octeți pe împrumut în loc de 12. Ultimele împrumuturi stau necomprimate
+// într-o coadă până se adună un bloc; cu o arhivă setată, doar ultimele `blocuriCalde` blocuri rămân
+// în memorie. Interogările pe interval și "ultimele N" caută binar în metadatele blocurilor și
+// decomprimă doar blocurile atinse.
+//
+// Un împrumut cu data mai veche decât blocurile sigilate (introdus târziu) e inserat în blocul lui,
+// care e recomprimat; e rar și costă un singur bloc.
+class IstoricImprumuturi {
+public:
+    static constexpr std::size_t dimensiuneBloc = 128;
+    static constexpr std::size_t blocuriCalde = 2;
+
+private:
+    struct Bloc {
+        DataZi prima;
+        DataZi ultima;
+        std::uint32_t numar;
+        std::size_t inceput;              // poziția primului împrumut în tot istoricul
+        std::vector<std::uint8_t> octeti; // gol dacă blocul e în arhivă
+        std::uint64_t pozitieArhiva = 0;
+        std::uint32_t lungimeArhiva = 0;
+    };
+
+    std::vector<Bloc> blocuri;            // intervale de date care nu se suprapun, în ordine
+    std::vector<IstoricImprumut> coada;   // după ultimul bloc, sortată
+    std::size_t primulCald = 0;           // blocurile dinaintea lui sunt în arhivă
+
+    static std::shared_ptr<ArhivaIstoric> arhiva;
+
+    [[nodiscard]] std::size_t numarInBlocuri() const;
+    void decomprima(const Bloc& bloc, std::vector<IstoricImprumut>& rezultat) const;
+    void comprima(Bloc& bloc, std::span<const IstoricImprumut> intrari, bool inArhiva);
+    void sigileaza();
+    void insereazaInBloc(std::size_t index, const IstoricImprumut& imprumut);
+
+public:
+    // Se apelează o dată, la pornire; fără arhivă toate blocurile rămân în memorie
+    static void folosesteArhiva(std::shared_ptr<ArhivaIstoric> arhivaNoua) { arhiva = std::move(arhivaNoua); }
+
+    void adauga(const IstoricImprumut& imprumut);
+
+    [[nodiscard]] std::size_t numar() const { return numarInBlocuri() + coada.size(); }
+    [[nodiscard]] bool empty() const { return numar() == 0; }
+
+    // Câte împrumuturi au data de împrumut strict înainte de `data`, adică poziția primului de la `data` încolo
+    [[nodiscard]] std::size_t pozitie(DataZi data) const;
+
+    // Cel mult `cate` împrumuturi de la poziția `inceput`, în ordine cronologică, adăugate la `rezultat`
+    void citeste(std::size_t inceput, std::size_t cate, std::vector<IstoricImprumut>& rezultat) const;
+
+    // Împrumuturile cu data de împrumut în [de, pana], în ordine cronologică
+    [[nodiscard]] std::vector<IstoricImprumut> intre(DataZi de, DataZi pana) const;
+
+    // Ultimele `cate` împrumuturi, în ordine cronologică
+    [[nodiscard]] std::vector<IstoricImprumut> ultimele(std::size_t cate) const;
+
+    // Memoria ocupată de istoric, fără blocurile din arhivă
+    [[nodiscard]] std::size_t octetiInMemorie() const;
+};
+
+#endif //OOP_ISTORIC_IMPRUMUTURI_H
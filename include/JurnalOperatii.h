@@ -0,0 +1,132 @@
+#ifndef OOP_JURNAL_OPERATII_H
+#define OOP_JURNAL_OPERATII_H
+
+#include "Exceptii.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Valorile sunt scrise în jurnal, deci nu se renumerotează; 3 și 5 au fost împrumuturile cu id pe 32 de biți
+enum class TipOperatie : std::uint8_t {
+    CarteAdaugata = 1,
+    UtilizatorAdaugat = 2,
+    PenalitatiAplicate = 4,
+    ExemplareSetate = 6,
+    ImprumutCreat = 7,
+    ImprumutReturnat = 8,
+    IntarzieriAvansate = 9 // ceasul planificatorului de întârzieri, urmat de acumularea penalităților
+};
+
+struct Operatie {
+    std::uint64_t secventa;
+    TipOperatie tip;
+    std::string continut;
+};
+
+// Conținutul unei operații: valori trivial copiabile și șiruri prefixate cu lungimea
+class ScriitorOperatie {
+private:
+    std::string octeti;
+
+public:
+    template <typename T>
+    ScriitorOperatie& scrie(T valoare) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        octeti.append(reinterpret_cast<const char*>(&valoare), sizeof(T));
+        return *this;
+    }
+
+    ScriitorOperatie& scrieSir(std::string_view sir) {
+        scrie(static_cast<std::uint32_t>(sir.size()));
+        octeti.append(sir);
+        return *this;
+    }
+
+    [[nodiscard]] std::string_view continut() const { return octeti; }
+};
+
+class CititorOperatie {
+private:
+    std::string_view octeti;
+
+    void verifica(std::size_t necesar) const {
+        if (necesar > octeti.size()) {
+            throw PersistentaException("Operatie din jurnal trunchiata");
+        }
+    }
+
+public:
+    explicit CititorOperatie(std::string_view octeti) : octeti(octeti) {}
+
+    template <typename T>
+    T citeste() {
+        static_assert(std::is_trivially_copyable_v<T>);
+        verifica(sizeof(T));
+        T valoare;
+        std::memcpy(&valoare, octeti.data(), sizeof(T));
+        octeti.remove_prefix(sizeof(T));
+        return valoare;
+    }
+
+    std::string citesteSir() {
+        const auto lungime = citeste<std::uint32_t>();
+        verifica(lungime);
+        std::string sir(octeti.substr(0, lungime));
+        octeti.remove_prefix(lungime);
+        return sir;
+    }
+};
+
+// Jurnal append-only al operațiilor, pentru refacere: o operație e scrisă după ce a reușit în memorie
+// (abia atunci se știe că e validă și ce id a primit), dar înainte de a fi confirmată. Un crash între
+// cele două pierde doar operații neconfirmate. Fiecare înregistrare are antet cu lungime,
+// CRC32 și număr de secvență; la deschidere, o ultimă înregistrare scrisă pe jumătate (crash în
+// timpul scrierii) este tăiată, iar jurnalul continuă după ultima înregistrare validă.
+class JurnalOperatii {
+private:
+    std::string cale;
+    std::FILE* fisier = nullptr;
+    std::uint64_t secventa = 0;
+    bool inLot = false;
+    std::vector<Operatie> recuperate;
+
+public:
+    explicit JurnalOperatii(std::string cale);
+    ~JurnalOperatii();
+
+    JurnalOperatii(const JurnalOperatii&) = delete;
+    JurnalOperatii& operator=(const JurnalOperatii&) = delete;
+
+    // Operațiile valide găsite la deschidere, în ordine; golite după preluare
+    std::vector<Operatie> preiaRecuperate() { return std::move(recuperate); }
+
+    // Adaugă o operație și golește bufferul în sistemul de operare; întoarce secvența ei.
+    // Într-un lot, bufferul e golit o singură dată, la terminaLot()
+    std::uint64_t scrie(TipOperatie tip, std::string_view continut);
+
+    void incepeLot() { inLot = true; }
+    void terminaLot();
+
+    // Numerele de secvență nu scad niciodată, nici după golirea jurnalului
+    void continuaDupa(std::uint64_t secventaMinima) {
+        if (secventaMinima > secventa) {
+            secventa = secventaMinima;
+        }
+    }
+
+    [[nodiscard]] std::uint64_t getSecventa() const { return secventa; }
+
+    // Forțează scrierea pe disc (fsync)
+    void sincronizeaza();
+
+    // Șterge tot conținutul, după ce un snapshot a preluat operațiile
+    void goleste();
+};
+
+#endif //OOP_JURNAL_OPERATII_H
@@ -0,0 +1,123 @@
+#ifndef OOP_METRICI_H
+#define OOP_METRICI_H
+
+#include "HistogramaLatente.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string_view>
+
+// Instrumentarea căilor fierbinți: contoare și histograme de latență, exportate în format Prometheus.
+// Cu -DBIBLIOTECA_FARA_METRICI (opțiunea CMake BIBLIOTECA_METRICI=OFF) măsurătorile dispar complet
+// din cod; contorul de împrumuturi rămâne, e parte din starea programului.
+#ifdef BIBLIOTECA_FARA_METRICI
+#define BIBLIOTECA_METRICI 0
+#else
+#define BIBLIOTECA_METRICI 1
+#endif
+
+// Contor fără contenție: fiecare fir scrie în propria linie de cache, citirea adună liniile
+class ContorSharduit {
+public:
+    static constexpr std::size_t numarSharduri = 16;
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<std::uint64_t> valoare{0};
+    };
+
+    std::array<Shard, numarSharduri> sharduri{};
+
+public:
+    // Indexul firului curent, dat la prima folosire, pe rând; peste 16 fire, shard-urile se împart
+    static std::size_t indexFir() {
+        static std::atomic<std::size_t> urmatorul{0};
+        thread_local const std::size_t index = urmatorul.fetch_add(1, std::memory_order_relaxed) % numarSharduri;
+        return index;
+    }
+
+    // Întoarce valoarea anterioară a shard-ului firului curent
+    std::uint64_t adauga(std::uint64_t numar = 1) {
+        return sharduri[indexFir()].valoare.fetch_add(numar, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t valoare() const;
+};
+
+// Numărul de apeluri ale unei operații și latența lor. Pentru operațiile de zeci de nanosecunde,
+// două citiri ale ceasului ar costa mai mult decât operația: se cronometrează doar un apel din
+// 2^pasEsantionare, pe fir, iar numărul de apeluri rămâne exact
+class MetricaLatenta {
+public:
+    static constexpr std::size_t sharduriHistograma = 4;
+
+private:
+    std::string_view nume;
+    std::string_view descriere;
+    std::uint64_t mascaEsantionare;
+    ContorSharduit apeluri;
+    std::array<HistogramaLatente, sharduriHistograma> histograme{};
+
+public:
+    constexpr MetricaLatenta(std::string_view nume, std::string_view descriere, unsigned pasEsantionare)
+        : nume(nume), descriere(descriere), mascaEsantionare((std::uint64_t{1} << pasEsantionare) - 1) {}
+
+    // Numără apelul; true dacă trebuie și cronometrat
+    bool esantioneaza() { return (apeluri.adauga() & mascaEsantionare) == 0; }
+
+    void inregistreaza(std::uint64_t nanosecunde) {
+        histograme[ContorSharduit::indexFir() % sharduriHistograma].inregistreaza(nanosecunde);
+    }
+
+    void scriePrometheus(std::ostream& iesire) const;
+};
+
+// Cronometrează blocul în care e declarat, dacă apelul e eșantionat
+class CronometruMetrica {
+private:
+    MetricaLatenta* metrica;
+    std::chrono::steady_clock::time_point inceput;
+
+public:
+    explicit CronometruMetrica(MetricaLatenta& metricaMasurata)
+        : metrica(metricaMasurata.esantioneaza() ? &metricaMasurata : nullptr) {
+        if (metrica) {
+            inceput = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~CronometruMetrica() {
+        if (metrica) {
+            const auto durata = std::chrono::steady_clock::now() - inceput;
+            metrica->inregistreaza(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(durata).count()));
+        }
+    }
+
+    CronometruMetrica(const CronometruMetrica&) = delete;
+    CronometruMetrica& operator=(const CronometruMetrica&) = delete;
+};
+
+#if BIBLIOTECA_METRICI
+#define MASOARA_LATENTA(metrica) const CronometruMetrica cronometruMetrica(metrica)
+#else
+#define MASOARA_LATENTA(metrica) static_cast<void>(0)
+#endif
+
+struct MetriciBiblioteca {
+    ContorSharduit imprumuturiCreate;
+    MetricaLatenta adaugaCarte{"biblioteca_adauga_carte", "Adaugarea unei carti in catalog si indexuri", 0};
+    MetricaLatenta cautareTitlu{"biblioteca_cautare_titlu", "Cautarea exacta dupa titlu (inclusiv la imprumut)", 4};
+    MetricaLatenta cautareUtilizator{"biblioteca_cautare_utilizator", "Cautarea unui utilizator dupa email", 4};
+    MetricaLatenta calculPenalitate{"biblioteca_calcul_penalitate", "Penalitatea unui imprumut la o data", 6};
+};
+
+extern MetriciBiblioteca metrici;
+
+// Toate metricile, în formatul text al Prometheus (version 0.0.4)
+void scrieMetriciPrometheus(std::ostream& iesire);
+
+#endif //OOP_METRICI_H
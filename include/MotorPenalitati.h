@@ -0,0 +1,39 @@
+#ifndef OOP_MOTOR_PENALITATI_H
+#define OOP_MOTOR_PENALITATI_H
+
+#include "DataZi.h"
+#include "Imprumut.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Rezultatul unei rulări "penalități la data D"
+struct RezultatPenalitati {
+    DataZi data;
+    std::vector<double> penalitatePerImprumut; // aliniat cu vectorul de împrumuturi primit; la cele returnate, cea deja aplicată
+    std::vector<Utilizator*> utilizatori;      // cei cu penalitate, în ordinea primei apariții, deci determinist
+    std::vector<double> totalPerUtilizator;    // aliniat cu `utilizatori`
+    double total = 0;
+    std::size_t imprumuturiIntarziate = 0; // ca și totalurile, doar împrumuturile nereturnate
+};
+
+// Calculează în lot penalitățile tuturor împrumuturilor la o dată dată: blocuri de împrumuturi
+// sunt distribuite pe fire, grupate pe tip de carte în coloane și calculate fără apeluri virtuale.
+// Împrumuturile returnate nu mai sunt taxate (ca în PlanificatorIntarzieri::acumuleazaPenalitati)
+class MotorPenalitati {
+private:
+    unsigned numarFire;
+
+public:
+    // 0 = câte fire are mașina; 1 = totul pe firul apelant, de exemplu dintr-un fir al unui pool
+    explicit MotorPenalitati(unsigned numarFire = 0);
+
+    // Nu modifică nici împrumuturile, nici utilizatorii
+    [[nodiscard]] RezultatPenalitati calculeaza(const std::vector<std::shared_ptr<ImprumutAbstract>>& imprumuturi, DataZi data) const;
+
+    // Trece rezultatul în conturile utilizatorilor; idempotent pentru aceeași dată
+    static void aplica(const std::vector<std::shared_ptr<ImprumutAbstract>>& imprumuturi, const RezultatPenalitati& rezultat);
+};
+
+#endif //OOP_MOTOR_PENALITATI_H
@@ -0,0 +1,77 @@
+#ifndef OOP_MULTIME_BITI_H
+#define OOP_MULTIME_BITI_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Mulțime de id-uri ca bitmap: un bit pe id, în cuvinte de 64 de biți.
+// Intersecția e o buclă simplă peste cuvinte, pe care compilatorul o vectorizează
+class MultimeBiti {
+private:
+    std::vector<std::uint64_t> cuvinte; // crește doar până la cel mai mare id setat
+    std::size_t numar = 0;
+
+public:
+    MultimeBiti() = default;
+
+    // Toate id-urile din [0, numarBiti)
+    static MultimeBiti plina(std::size_t numarBiti) {
+        MultimeBiti rezultat;
+        rezultat.cuvinte.assign((numarBiti + 63) / 64, ~std::uint64_t{0});
+        if (numarBiti % 64) {
+            rezultat.cuvinte.back() = (std::uint64_t{1} << (numarBiti % 64)) - 1;
+        }
+        rezultat.numar = numarBiti;
+        return rezultat;
+    }
+
+    void seteaza(std::size_t id) {
+        const std::size_t cuvant = id / 64;
+        if (cuvant >= cuvinte.size()) {
+            cuvinte.resize(std::max(cuvant + 1, cuvinte.size() * 2), 0);
+        }
+        const std::uint64_t masca = std::uint64_t{1} << (id % 64);
+        numar += !(cuvinte[cuvant] & masca);
+        cuvinte[cuvant] |= masca;
+    }
+
+    [[nodiscard]] bool contine(std::size_t id) const {
+        const std::size_t cuvant = id / 64;
+        return cuvant < cuvinte.size() && (cuvinte[cuvant] >> (id % 64) & 1);
+    }
+
+    [[nodiscard]] std::size_t size() const { return numar; }
+    [[nodiscard]] bool empty() const { return numar == 0; }
+
+    // *this = *this ∩ alta
+    void intersecteaza(const MultimeBiti& alta) {
+        const std::size_t comune = std::min(cuvinte.size(), alta.cuvinte.size());
+        std::uint64_t* a = cuvinte.data();
+        const std::uint64_t* b = alta.cuvinte.data();
+        for (std::size_t i = 0; i < comune; ++i) {
+            a[i] &= b[i];
+        }
+        cuvinte.resize(comune);
+        numar = 0;
+        for (const std::uint64_t cuvant : cuvinte) {
+            numar += static_cast<std::size_t>(std::popcount(cuvant));
+        }
+    }
+
+    // Apelează f(id) pentru fiecare id, crescător
+    template <typename F>
+    void pentruFiecare(F&& f) const {
+        for (std::size_t i = 0; i < cuvinte.size(); ++i) {
+            for (std::uint64_t cuvant = cuvinte[i]; cuvant; cuvant &= cuvant - 1) {
+                f(i * 64 + static_cast<std::size_t>(std::countr_zero(cuvant)));
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t memorieOcupata() const { return cuvinte.capacity() * sizeof(std::uint64_t); }
+};
+
+#endif //OOP_MULTIME_BITI_H
@@ -0,0 +1,63 @@
+#ifndef OOP_PERSISTENTA_H
+#define OOP_PERSISTENTA_H
+
+#include "Biblioteca.h"
+#include "DataZi.h"
+#include "FisierMapat.h"
+#include "Imprumut.h"
+#include "JurnalOperatii.h"
+#include "Utilizator.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Persistența stării bibliotecii într-un director: snapshot.bin (binar, mapat la pornire) și
+// jurnal.wal (operațiile de după ultimul snapshot). La pornire se încarcă snapshot-ul și se reaplică
+// jurnalul; un snapshot nou preia tot și golește jurnalul.
+class Persistenta {
+private:
+    std::string director;
+    std::string caleSnapshot;
+    JurnalOperatii jurnal;
+    // Coloanele catalogului indică în acest fișier până la prima modificare
+    std::shared_ptr<const FisierMapat> snapshotMapat;
+
+    // Întoarce secvența de jurnal inclusă în snapshot
+    std::uint64_t incarcaSnapshot(BibliotecaSingleton& biblioteca, std::vector<std::shared_ptr<Utilizator>>& utilizatori,
+                                   std::vector<std::shared_ptr<ImprumutAbstract>>& imprumuturi);
+
+    static void reaplica(const Operatie& operatie, BibliotecaSingleton& biblioteca,
+                         std::vector<std::shared_ptr<Utilizator>>& utilizatori,
+                         std::vector<std::shared_ptr<ImprumutAbstract>>& imprumuturi);
+
+public:
+    explicit Persistenta(const std::string& director);
+
+    [[nodiscard]] const std::string& getDirector() const { return director; }
+
+    // Reface starea de la ultima rulare; întoarce numărul de operații reaplicate din jurnal
+    std::size_t recupereaza(BibliotecaSingleton& biblioteca, std::vector<std::shared_ptr<Utilizator>>& utilizatori,
+                            std::vector<std::shared_ptr<ImprumutAbstract>>& imprumuturi);
+
+    // Jurnalizarea operațiilor, apelată după ce operația a reușit în memorie și înainte de confirmarea ei
+    // (mesajul din meniu, răspunsul serverului după terminaLot)
+    void carteAdaugata(const CarteView& carte);
+    void utilizatorAdaugat(const Utilizator& utilizator);
+    void imprumutCreat(const ImprumutAbstract& imprumut);
+    void imprumutReturnat(const ImprumutAbstract& imprumut);
+    void exemplareSetate(IdCarte id, unsigned numar);
+    void penalitatiAplicate(DataZi data);
+    void intarzieriAvansate(DataZi data);
+
+    // Operațiile dintre cele două apeluri ajung în sistemul de operare împreună, la terminaLot()
+    void incepeLot() { jurnal.incepeLot(); }
+    void terminaLot() { jurnal.terminaLot(); }
+
+    // Scrie un snapshot nou (fișier temporar + rename, deci atomic) și golește jurnalul
+    void salveaza(BibliotecaSingleton& biblioteca, const std::vector<std::shared_ptr<Utilizator>>& utilizatori,
+                  const std::vector<std::shared_ptr<ImprumutAbstract>>& imprumuturi);
+};
+
+#endif //OOP_PERSISTENTA_H
@@ -0,0 +1,105 @@
+#ifndef OOP_PLANIFICATOR_INTARZIERI_H
+#define OOP_PLANIFICATOR_INTARZIERI_H
+
+#include "DataZi.h"
+#include "Imprumut.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+// Împrumuturile care au devenit întârziate la o avansare a ceasului, în ordinea zilei de expirare
+struct LotIntarzieri {
+    DataZi data;
+    std::vector<std::shared_ptr<ImprumutAbstract>> imprumuturi;
+};
+
+// Penalitățile trecute în conturi la o dată, doar pentru împrumuturile întârziate și nereturnate
+struct AcumularePenalitati {
+    DataZi data;
+    double total = 0;
+    std::size_t imprumuturi = 0;
+};
+
+// Împrumuturile deschise, indexate după prima zi de întârziere (data împrumutului + perioada de
+// grație + 1), într-o roată de timp ierarhică: 3 niveluri de câte 64 de sloturi, de 1, 64 și 4096
+// de zile, plus un heap pentru expirările de peste ~700 de ani. Un slot de nivel 0 ține exact
+// împrumuturile unei zile; când ceasul intră într-un nou interval de 64 (4096) de zile, slotul
+// lui de pe nivelul de deasupra e coborât. O mască de 64 de biți pe nivel arată sloturile ocupate,
+// deci zilele goale sunt sărite: avansarea costă cât împrumuturile care expiră, plus un pas
+// la fiecare 64 de zile, indiferent câte împrumuturi sunt deschise.
+//
+// Returnarea nu scoate nimic din roată: împrumuturile returnate sunt ignorate când le vine ziua.
+// Cele expirate trec în lista celor întârziate, pentru acumularea penalităților, până sunt returnate.
+// Ceasul e salvat în snapshot, cu împrumuturile expirate încă neraportate: după o repornire,
+// împrumuturile deja raportate trec direct în lista celor întârziate, fără a fi raportate din nou.
+class PlanificatorIntarzieri {
+public:
+    static constexpr unsigned bitiNivel = 6;
+    static constexpr std::size_t sloturiPeNivel = std::size_t{1} << bitiNivel;
+    static constexpr std::size_t numarNiveluri = 3;
+
+private:
+    struct Intrare {
+        std::int32_t expirare;
+        std::shared_ptr<ImprumutAbstract> imprumut;
+    };
+
+    // Comparatorul heap-ului: cea mai apropiată expirare în vârf
+    static bool maiTarziu(const Intrare& a, const Intrare& b) { return a.expirare > b.expirare; }
+
+    mutable std::mutex mutexRoata;
+    std::int32_t baza; // prima zi încă neprocesată
+    std::array<std::array<std::vector<Intrare>, sloturiPeNivel>, numarNiveluri> sloturi;
+    std::array<std::uint64_t, numarNiveluri> ocupate{};
+    std::vector<Intrare> departe;      // heap după expirare, pentru ce nu încape pe niveluri
+    std::vector<Intrare> expirateDeja; // adăugate cu expirarea înaintea bazei
+    std::vector<std::shared_ptr<ImprumutAbstract>> intarziate;
+    std::vector<IdImprumut> neraportateRestaurate; // ordonate; din snapshot, până la următoarea avansare
+    std::size_t programate = 0;
+
+    void plaseaza(Intrare intrare);
+    void coboara(std::size_t nivel, std::size_t slot);
+    void coboaraLaInceputDeBloc(); // baza tocmai a intrat într-un nou interval de 64 de zile
+
+public:
+    explicit PlanificatorIntarzieri(DataZi inceput = DataZi());
+
+    PlanificatorIntarzieri(const PlanificatorIntarzieri&) = delete;
+    PlanificatorIntarzieri& operator=(const PlanificatorIntarzieri&) = delete;
+
+    // Perioada de grație e citită din tabelul de penalități activ, la adăugare
+    void adauga(std::shared_ptr<ImprumutAbstract> imprumut);
+
+    // La încărcarea unui snapshot, înainte de restaureaza: ultima zi procesată și împrumuturile
+    // expirate dar încă neraportate (vezi getNeraportate). ImprumutException dacă roata nu e goală
+    void restaureazaCeas(DataZi ultimaZi, std::span<const IdImprumut> neraportate);
+
+    // Ca adauga, pentru un împrumut din snapshot: unul expirat înaintea ceasului și deja raportat
+    // trece direct în lista celor întârziate
+    void restaureaza(std::shared_ptr<ImprumutAbstract> imprumut);
+
+    // Mută ceasul la `data` și întoarce exact împrumuturile nereturnate care au devenit întârziate
+    // de la avansarea anterioară. ImprumutException dacă `data` e înaintea ceasului
+    LotIntarzieri avanseaza(DataZi data);
+
+    // Trece în conturi penalitățile la data ceasului, doar pentru împrumuturile întârziate;
+    // scoate din listă pe cele returnate între timp
+    AcumularePenalitati acumuleazaPenalitati();
+
+    // Ultima zi procesată
+    [[nodiscard]] DataZi getData() const;
+
+    // Împrumuturile nereturnate adăugate cu expirarea înaintea ceasului, de raportat la următoarea avansare
+    [[nodiscard]] std::vector<IdImprumut> getNeraportate() const;
+
+    // Împrumuturi încă în roată, inclusiv cele returnate dar neajunse la expirare
+    [[nodiscard]] std::size_t numarProgramate() const;
+    [[nodiscard]] std::size_t numarIntarziate() const;
+};
+
+#endif //OOP_PLANIFICATOR_INTARZIERI_H
@@ -0,0 +1,124 @@
+#ifndef OOP_POLITICA_PENALITATI_H
+#define OOP_POLITICA_PENALITATI_H
+
+#include "Carte.h"
+#include "Utilizator.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Regulile implicite, ca tipuri rezolvate la compilare: tariful pe zi al fiecărui tip de carte...
+template <TipCarte Tip>
+struct PoliticaCarte;
+
+template <>
+struct PoliticaCarte<TipCarte::Generica> {
+    static constexpr double rata(StareCarte) { return 5; } // Penalitate standard
+};
+
+template <>
+struct PoliticaCarte<TipCarte::Fizica> {
+    static constexpr double rata(StareCarte stare) { return stare == StareCarte::Uzata ? 20 : 10; }
+};
+
+template <>
+struct PoliticaCarte<TipCarte::Digitala> {
+    static constexpr double rata(StareCarte) { return 5; } // Penalitate fixă pentru cărțile digitale
+};
+
+// ...un factor pe tipul de utilizator (azi același pentru toți)...
+template <TipUtilizator Tip>
+struct PoliticaUtilizator {
+    static constexpr double factor = 1;
+};
+
+// ...și formula întârzierii, aceeași pentru toate împrumuturile
+struct PoliticaIntarziere {
+    static constexpr std::int32_t zileGratie = 14;
+
+    static constexpr double penalitate(std::int32_t zileImprumut, double rataZi, std::int32_t gratie) {
+        const std::int32_t intarziere = zileImprumut - gratie;
+        return intarziere > 0 ? intarziere * rataZi : 0.0;
+    }
+};
+
+// Tariful pe zi pentru fiecare tip de carte × stare × tip de utilizator, plus perioada de grație.
+// Tabelul implicit e construit la compilare din politicile de mai sus; la pornire poate fi înlocuit
+// de un fișier de reguli, înainte de primul împrumut. Fiecare împrumut își copiază tariful la creare,
+// deci bucla de penalități nu mai consultă nici tabelul, nici șiruri, nici metode virtuale.
+class TabelPenalitati {
+public:
+    static constexpr std::size_t numarTipuriCarte = 3;
+    static constexpr std::size_t numarStari = 2;
+    static constexpr std::size_t numarTipuriUtilizator = 2;
+
+private:
+    std::array<double, numarTipuriCarte * numarStari * numarTipuriUtilizator> rate{};
+    std::int32_t zileGratie = PoliticaIntarziere::zileGratie;
+
+    static TabelPenalitati activ;
+
+    static constexpr std::size_t index(TipCarte tip, StareCarte stare, TipUtilizator utilizator) {
+        return (static_cast<std::size_t>(tip) * numarStari + static_cast<std::size_t>(stare)) * numarTipuriUtilizator
+               + static_cast<std::size_t>(utilizator);
+    }
+
+    template <TipCarte Tip, TipUtilizator Utilizator>
+    constexpr void completeaza() {
+        for (const auto stare : {StareCarte::Buna, StareCarte::Uzata}) {
+            rate[index(Tip, stare, Utilizator)] = PoliticaCarte<Tip>::rata(stare) * PoliticaUtilizator<Utilizator>::factor;
+        }
+    }
+
+    template <TipCarte Tip>
+    constexpr void completeazaCarte() {
+        completeaza<Tip, TipUtilizator::Student>();
+        completeaza<Tip, TipUtilizator::Profesor>();
+    }
+
+public:
+    static constexpr TabelPenalitati implicit() {
+        TabelPenalitati tabel;
+        tabel.completeazaCarte<TipCarte::Generica>();
+        tabel.completeazaCarte<TipCarte::Fizica>();
+        tabel.completeazaCarte<TipCarte::Digitala>();
+        return tabel;
+    }
+
+    // Fișier text, o regulă pe linie, aplicate în ordine peste tabelul implicit:
+    //   gratie 14
+    //   Fizica uzata Student 20
+    //   Digitala * * 5.5
+    // "*" înseamnă orice valoare; liniile goale și cele care încep cu '#' sunt ignorate.
+    // ImportException cu numărul liniei pentru orice regulă invalidă
+    static TabelPenalitati incarca(const std::string& cale);
+
+    // Tabelul folosit de împrumuturile noi; implicit până la foloseste()
+    static const TabelPenalitati& curent() { return activ; }
+    static void foloseste(const TabelPenalitati& tabel) { activ = tabel; }
+
+    [[nodiscard]] constexpr double rata(TipCarte tip, StareCarte stare, TipUtilizator utilizator) const {
+        return rate[index(tip, stare, utilizator)];
+    }
+
+    constexpr void seteazaRata(TipCarte tip, StareCarte stare, TipUtilizator utilizator, double rata) {
+        rate[index(tip, stare, utilizator)] = rata;
+    }
+
+    [[nodiscard]] constexpr std::int32_t getZileGratie() const { return zileGratie; }
+    constexpr void seteazaZileGratie(std::int32_t zile) { zileGratie = zile; }
+
+    [[nodiscard]] constexpr double penalitate(std::int32_t zileImprumut, double rataZi) const {
+        return PoliticaIntarziere::penalitate(zileImprumut, rataZi, zileGratie);
+    }
+};
+
+inline constexpr TabelPenalitati penalitatiImplicite = TabelPenalitati::implicit();
+
+static_assert(penalitatiImplicite.rata(TipCarte::Fizica, StareCarte::Uzata, TipUtilizator::Profesor) == 20);
+static_assert(penalitatiImplicite.rata(TipCarte::Digitala, StareCarte::Buna, TipUtilizator::Student) == 5);
+static_assert(penalitatiImplicite.penalitate(20, 10) == 60);
+
+#endif //OOP_POLITICA_PENALITATI_H
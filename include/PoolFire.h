@@ -0,0 +1,51 @@
+#ifndef OOP_POOL_FIRE_H
+#define OOP_POOL_FIRE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Pool de fire cu furt de sarcini: fiecare fir are coada lui. Sarcinile trimise dintr-un fir al pool-ului
+// intră în coada acelui fir și sunt luate de la capătul cel mai nou (încă în cache), iar un fir fără
+// lucru fură de la capătul cel mai vechi al altei cozi. Sarcinile venite din afară sunt împărțite
+// pe rând între cozi. Firele fără nimic de furat dorm pe o variabilă de condiție.
+class PoolFire {
+private:
+    struct alignas(64) Coada {
+        std::mutex mutex;
+        std::deque<std::function<void()>> sarcini;
+    };
+
+    std::vector<std::unique_ptr<Coada>> cozi;
+    std::vector<std::thread> fire;
+    std::atomic<std::size_t> urmatoareaCoada{0};
+    std::atomic<std::size_t> inAsteptare{0};
+    std::mutex mutexSomn;
+    std::condition_variable somn;
+    bool oprit = false;
+
+    bool iaSarcina(std::size_t index, std::function<void()>& sarcina);
+    void lucreaza(std::size_t index);
+
+public:
+    // 0 = câte fire are mașina
+    explicit PoolFire(unsigned numarFire = 0);
+
+    // Execută tot ce a rămas în cozi, apoi oprește firele
+    ~PoolFire();
+
+    PoolFire(const PoolFire&) = delete;
+    PoolFire& operator=(const PoolFire&) = delete;
+
+    void trimite(std::function<void()> sarcina);
+
+    [[nodiscard]] unsigned getNumarFire() const { return static_cast<unsigned>(fire.size()); }
+};
+
+#endif //OOP_POOL_FIRE_H
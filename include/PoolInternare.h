@@ -0,0 +1,43 @@
+#ifndef OOP_POOL_INTERNARE_H
+#define OOP_POOL_INTERNARE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Pool de șiruri internate pentru câmpurile cu puține valori distincte (facultăți, departamente,
+// formate): obiectul reține doar id-ul, iar două valori se compară ca întregi.
+// Spre deosebire de PoolSiruri, e sigur între fire și referințele întoarse rămân valide cât trăiește
+// pool-ul: valorile stau într-un deque, care nu mută elementele la adăugare.
+class PoolInternare {
+private:
+    mutable std::shared_mutex mutex;
+    std::deque<std::string> valori;
+    std::unordered_map<std::string_view, std::uint32_t> iduri; // cheile sunt view-uri spre valori
+
+public:
+    PoolInternare() = default;
+    PoolInternare(const PoolInternare&) = delete;
+    PoolInternare& operator=(const PoolInternare&) = delete;
+
+    // Id-ul valorii, adăugată la prima apariție; o valoare deja cunoscută cere doar blocarea partajată
+    std::uint32_t interneaza(std::string_view sir);
+
+    [[nodiscard]] const std::string& operator[](std::uint32_t id) const {
+        const std::shared_lock blocare(mutex);
+        return valori[id];
+    }
+
+    [[nodiscard]] std::size_t size() const {
+        const std::shared_lock blocare(mutex);
+        return valori.size();
+    }
+
+    [[nodiscard]] std::size_t memorieOcupata() const;
+};
+
+#endif //OOP_POOL_INTERNARE_H
@@ -0,0 +1,143 @@
+#ifndef OOP_POOL_OBIECTE_H
+#define OOP_POOL_OBIECTE_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// Pool de sloturi de dimensiune fixă: memoria vine în blocuri mari, iar sloturile eliberate
+// intră într-o listă și sunt refolosite. Câte un pool pentru fiecare pereche (dimensiune, aliniere),
+// deci obiectele de același tip stau împreună în aceleași blocuri.
+// Fiecare fir ține propria listă de sloturi libere și schimbă cu lista comună, sub mutex, câte un
+// lot de sloturiPeLot; alocările și eliberările obișnuite nu blochează. Cache-ul unui fir nu are
+// destructor, ca eliberările de după ieșirea din main să rămână valide: un fir care se termină
+// lasă nefolosite cel mult 2 * sloturiPeLot sloturi.
+template <std::size_t Dimensiune, std::size_t Aliniere>
+class PoolObiecte {
+private:
+    union Slot {
+        Slot* urmator;
+        alignas(Aliniere) std::byte date[Dimensiune];
+    };
+
+    static constexpr std::size_t sloturiPeBloc = (std::size_t{64} << 10) / sizeof(Slot) + 1;
+    static constexpr std::size_t sloturiPeLot = 64;
+
+    struct CacheFir {
+        Slot* liber = nullptr;
+        std::size_t numar = 0;
+    };
+
+    static inline thread_local CacheFir cacheFir;
+
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Slot[]>> blocuri;
+    Slot* liber = nullptr;
+
+    PoolObiecte() = default;
+
+    void iaLot(CacheFir& cache) {
+        const std::lock_guard<std::mutex> blocare(mutex);
+        for (std::size_t i = 0; i < sloturiPeLot; ++i) {
+            if (!liber) {
+                blocuri.push_back(std::make_unique<Slot[]>(sloturiPeBloc));
+                Slot* bloc = blocuri.back().get();
+                for (std::size_t j = 0; j + 1 < sloturiPeBloc; ++j) {
+                    bloc[j].urmator = &bloc[j + 1];
+                }
+                bloc[sloturiPeBloc - 1].urmator = nullptr;
+                liber = bloc;
+            }
+            Slot* slot = liber;
+            liber = slot->urmator;
+            slot->urmator = cache.liber;
+            cache.liber = slot;
+        }
+        cache.numar += sloturiPeLot;
+    }
+
+    void daLot(CacheFir& cache) {
+        Slot* primul = cache.liber;
+        Slot* ultimul = primul;
+        for (std::size_t i = 1; i < sloturiPeLot; ++i) {
+            ultimul = ultimul->urmator;
+        }
+        cache.liber = ultimul->urmator;
+        cache.numar -= sloturiPeLot;
+        const std::lock_guard<std::mutex> blocare(mutex);
+        ultimul->urmator = liber;
+        liber = primul;
+    }
+
+public:
+    PoolObiecte(const PoolObiecte&) = delete;
+    PoolObiecte& operator=(const PoolObiecte&) = delete;
+
+    // Nu este distrus niciodată: obiecte din pool pot fi eliberate și după ieșirea din main
+    static PoolObiecte& getInstance() {
+        static auto* instance = new PoolObiecte;
+        return *instance;
+    }
+
+    void* aloca() {
+        CacheFir& cache = cacheFir;
+        if (!cache.liber) {
+            iaLot(cache);
+        }
+        Slot* slot = cache.liber;
+        cache.liber = slot->urmator;
+        --cache.numar;
+        return slot->date;
+    }
+
+    // Slotul poate veni de la alt fir; intră în cache-ul firului care îl eliberează
+    void elibereaza(void* adresa) {
+        CacheFir& cache = cacheFir;
+        auto* slot = reinterpret_cast<Slot*>(adresa);
+        slot->urmator = cache.liber;
+        cache.liber = slot;
+        if (++cache.numar == 2 * sloturiPeLot) {
+            daLot(cache);
+        }
+    }
+
+    [[nodiscard]] std::size_t memorieOcupata() {
+        const std::lock_guard<std::mutex> blocare(mutex);
+        return blocuri.size() * sloturiPeBloc * sizeof(Slot);
+    }
+};
+
+// Alocator STL peste PoolObiecte, pentru std::allocate_shared: obiectul și blocul de control
+// ajung într-un singur slot din pool-ul dimensiunii lor. Cererile de mai multe elemente merg la new.
+template <typename T>
+class AlocatorPool {
+public:
+    using value_type = T;
+
+    AlocatorPool() = default;
+
+    template <typename U>
+    AlocatorPool(const AlocatorPool<U>&) noexcept {}
+
+    T* allocate(std::size_t numar) {
+        if (numar != 1) {
+            return static_cast<T*>(::operator new(numar * sizeof(T), std::align_val_t{alignof(T)}));
+        }
+        return static_cast<T*>(PoolObiecte<sizeof(T), alignof(T)>::getInstance().aloca());
+    }
+
+    void deallocate(T* adresa, std::size_t numar) noexcept {
+        if (numar != 1) {
+            ::operator delete(adresa, std::align_val_t{alignof(T)});
+            return;
+        }
+        PoolObiecte<sizeof(T), alignof(T)>::getInstance().elibereaza(adresa);
+    }
+
+    template <typename U>
+    bool operator==(const AlocatorPool<U>&) const noexcept { return true; }
+};
+
+#endif //OOP_POOL_OBIECTE_H
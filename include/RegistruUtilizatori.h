@@ -0,0 +1,68 @@
+#ifndef OOP_REGISTRU_UTILIZATORI_H
+#define OOP_REGISTRU_UTILIZATORI_H
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+class Utilizator;
+
+// Registru de utilizatori după email, împărțit în shard-uri după dispersia emailului.
+// Cheile sunt view-uri spre emailul reținut chiar în obiectul Utilizator, deci emailul nu se copiază.
+// Fiecare shard are propriul shared_mutex: citirile rulează în paralel între ele, iar scrierile
+// blochează doar shard-ul lor. La căutare emailul este dispersat o singură dată: aceeași valoare
+// alege shard-ul și bucket-ul.
+class RegistruUtilizatori {
+public:
+    static constexpr std::size_t numarSharduri = 64;
+
+private:
+    // Email împreună cu dispersia deja calculată, folosit la căutarea eterogenă
+    struct CheieDispersata {
+        std::string_view email;
+        std::size_t dispersie;
+    };
+
+    struct DispersieEmail {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view email) const noexcept { return std::hash<std::string_view>{}(email); }
+        std::size_t operator()(const CheieDispersata& cheie) const noexcept { return cheie.dispersie; }
+    };
+
+    struct EgalitateEmail {
+        using is_transparent = void;
+        bool operator()(std::string_view a, std::string_view b) const noexcept { return a == b; }
+        bool operator()(const CheieDispersata& a, std::string_view b) const noexcept { return a.email == b; }
+        bool operator()(std::string_view a, const CheieDispersata& b) const noexcept { return a == b.email; }
+    };
+
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string_view, std::shared_ptr<Utilizator>, DispersieEmail, EgalitateEmail> utilizatori;
+    };
+
+    std::array<Shard, numarSharduri> sharduri;
+
+    static CheieDispersata cheie(std::string_view email) {
+        return {email, DispersieEmail{}(email)};
+    }
+
+    // Biții de sus aleg shard-ul, cei de jos rămân pentru bucket-urile din interiorul shard-ului
+    Shard& shard(const CheieDispersata& cheie) { return sharduri[cheie.dispersie >> 58 & (numarSharduri - 1)]; }
+    const Shard& shard(const CheieDispersata& cheie) const { return sharduri[cheie.dispersie >> 58 & (numarSharduri - 1)]; }
+
+public:
+    [[nodiscard]] std::shared_ptr<Utilizator> cauta(std::string_view email) const;
+
+    // Inserează doar dacă emailul nu există deja; întoarce false altfel
+    bool adauga(std::shared_ptr<Utilizator> utilizator);
+
+    bool sterge(std::string_view email);
+
+    [[nodiscard]] std::size_t size() const;
+};
+
+#endif //OOP_REGISTRU_UTILIZATORI_H
@@ -0,0 +1,129 @@
+#ifndef OOP_SERVER_COMENZI_H
+#define OOP_SERVER_COMENZI_H
+
+#include "Biblioteca.h"
+#include "HistogramaLatente.h"
+#include "Imprumut.h"
+#include "PoolFire.h"
+#include "Utilizator.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class Persistenta;
+
+enum class TipComanda : std::uint8_t {
+    AdaugaUtilizator,
+    AdaugaCarte,
+    Imprumuta,
+    Returneaza,
+    SeteazaExemplare,
+    AplicaPenalitati,
+    AvanseazaIntarzieri,
+    CautaCarte,
+    CautaPrefix,
+    CautaText,
+    CautaUtilizator,
+    Penalitati,
+    ExportaMetrici,
+    ExportaCarti,
+    TopCarti,
+    Statistici,
+    Opreste,
+    Necunoscuta
+};
+
+inline constexpr std::size_t numarTipuriComanda = static_cast<std::size_t>(TipComanda::Necunoscuta) + 1;
+
+// Modul server: comenzi pe câte o linie, câmpuri separate prin tab, de exemplu
+//   imprumut<TAB>ana@exemplu.ro<TAB>Ion<TAB>2024-03-01<TAB>2024-03-15
+// Fiecare comandă primește exact o linie de răspuns, "OK[<TAB>câmpuri]" sau "EROARE<TAB>mesaj",
+// în ordinea comenzilor din aceeași conexiune. Comenzile care scriu fișiere (metrici, exportCarti)
+// primesc un nume relativ, rezolvat în subdirectorul "exporturi" al directorului de date.
+//
+// Citirile rulează pe un pool cu furt de sarcini, în paralel între ele, sub un shared_mutex.
+// Scrierile intră într-o coadă golită de un singur fir: tot ce s-a adunat se aplică sub o singură
+// blocare exclusivă, iar jurnalul e golit o dată pe lot, înainte de răspunsuri (dacă golirea eșuează,
+// lotul ajunge pe disc printr-un snapshot; răspunsurile rămân rezultatul fiecărei operații). O citire care urmează
+// unei scrieri încă neaplicate din aceeași conexiune intră în aceeași coadă, după ea, ca să o vadă.
+// Exportul catalogului nu ia deloc blocarea: fixează ultima versiune publicată (VersiuneCatalog)
+// și o scrie cât timp scrierile continuă, fără să le întârzie.
+class ServerComenzi {
+public:
+    class Conexiune;
+
+private:
+    struct Cerere {
+        TipComanda tip;
+        std::vector<std::string> campuri; // fără numele comenzii
+        std::shared_ptr<Conexiune> conexiune;
+        std::uint64_t pozitie;            // în conexiune, pentru ordinea răspunsurilor
+        std::chrono::steady_clock::time_point primire;
+    };
+
+    BibliotecaSingleton& biblioteca;
+    std::vector<std::shared_ptr<Utilizator>>& utilizatori;
+    std::vector<std::shared_ptr<ImprumutAbstract>>& imprumuturi;
+    Persistenta* persistenta;
+
+    std::shared_mutex mutexStare;
+
+    std::mutex mutexScrieri;
+    std::vector<Cerere> scrieri;
+    std::uint64_t scrieriPrimite = 0;
+    bool scriitorActiv = false;
+    std::atomic<std::uint64_t> scrieriAplicate{0};
+
+    std::array<HistogramaLatente, numarTipuriComanda> latente;
+
+    std::atomic<bool> oprit{false};
+    std::mutex mutexSocketuri;
+    int socketAscultare = -1;
+    std::set<int> socketuriDeschise;
+
+    // Ultimul membru: distrus primul, deci sarcinile rămase se termină cât restul e încă valid
+    PoolFire pool;
+
+    void proceseazaLinie(const std::shared_ptr<Conexiune>& conexiune, std::string_view linie);
+    std::uint64_t adaugaScriere(Cerere cerere);
+    void aplicaScrieri();
+    void termina(const Cerere& cerere, std::string raspuns);
+    void opreste();
+
+    std::string executa(const Cerere& cerere);
+    std::string executaScriere(const Cerere& cerere);
+    std::string executaCitire(const Cerere& cerere);
+
+    void servesteConexiune(int socket);
+
+public:
+    ServerComenzi(BibliotecaSingleton& biblioteca, std::vector<std::shared_ptr<Utilizator>>& utilizatori,
+                  std::vector<std::shared_ptr<ImprumutAbstract>>& imprumuturi, Persistenta* persistenta,
+                  unsigned numarFire = 0);
+
+    ServerComenzi(const ServerComenzi&) = delete;
+    ServerComenzi& operator=(const ServerComenzi&) = delete;
+
+    // Comenzi din `intrare` până la sfârșit sau "opreste"; întoarce după ce toate au primit răspuns
+    void servesteFlux(std::istream& intrare, std::ostream& iesire);
+
+    // Unix socket la `cale`, câte un fir de citire pe conexiune; până la comanda "opreste".
+    // Indisponibil pe Windows
+    void servesteSocket(const std::string& cale);
+
+    // Pe fiecare comandă: număr, medie și percentile în microsecunde
+    void scrieStatistici(std::ostream& iesire) const;
+};
+
+#endif //OOP_SERVER_COMENZI_H
@@ -0,0 +1,135 @@
+#ifndef OOP_SNAPSHOT_H
+#define OOP_SNAPSHOT_H
+
+#include "Coloana.h"
+#include "Exceptii.h"
+#include "FisierMapat.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+// Secțiunile unui snapshot binar; fiecare este un tablou de valori trivial copiabile
+enum class Sectiune : std::uint32_t {
+    CartiTip = 1,
+    CartiAn,
+    CartiPagini,
+    CartiDimensiune,
+    CartiAutor,
+    CartiDetaliu,
+    TitluriInceputuri,
+    TitluriCaractere,
+    AutoriInceputuri,
+    AutoriCaractere,
+    DetaliiInceputuri,
+    DetaliiCaractere,
+    IndexSloturi,
+    IndexOrdonate,
+    IndexOcupate,
+    CartiExemplare,
+    UtilizatoriTip = 32,
+    UtilizatoriPenalizari,
+    UtilizatoriSiruriInceputuri,
+    UtilizatoriSiruriCaractere,
+    Imprumuturi = 48,
+    IntarzieriCeas = 64,   // ultima zi procesată de planificatorul de întârzieri
+    IntarzieriNeraportate  // id-urile împrumuturilor expirate, încă neraportate
+};
+
+// Format: antet, secțiuni aliniate la 64 de octeți, apoi tabelul de secțiuni.
+// Valorile sunt scrise în ordinea nativă a octeților (little-endian pe platformele suportate).
+// Orice schimbare a secțiunilor sau a rândurilor lor crește versiunea: un fișier vechi e respins,
+// nu citit greșit (2: exemplare și starea împrumuturilor; 3: id-ul pe 64 de biți în rândul împrumutului;
+// 4: ceasul planificatorului de întârzieri)
+struct AntetSnapshot {
+    static constexpr char magicAsteptat[8] = {'B', 'I', 'B', 'S', 'N', 'A', 'P', '\0'};
+    static constexpr std::uint32_t versiuneCurenta = 4;
+
+    char magic[8];
+    std::uint32_t versiune;
+    std::uint32_t numarSectiuni;
+    std::uint64_t offsetTabel;
+    std::uint64_t secventaJurnal; // ultima operație din jurnal inclusă în snapshot
+    std::uint8_t rezervat[32];
+};
+static_assert(sizeof(AntetSnapshot) == 64);
+
+struct IntrareSectiune {
+    Sectiune id;
+    std::uint32_t rezervat;
+    std::uint64_t offset;
+    std::uint64_t dimensiune;
+};
+
+class ScriitorSnapshot {
+private:
+    std::FILE* fisier;
+    std::string cale;
+    std::vector<IntrareSectiune> tabel;
+    std::uint64_t pozitie = sizeof(AntetSnapshot);
+
+    void scrieOcteti(const void* date, std::size_t dimensiune);
+
+public:
+    explicit ScriitorSnapshot(const std::string& cale);
+    ~ScriitorSnapshot();
+
+    ScriitorSnapshot(const ScriitorSnapshot&) = delete;
+    ScriitorSnapshot& operator=(const ScriitorSnapshot&) = delete;
+
+    void scrieSectiune(Sectiune id, const void* date, std::size_t dimensiune);
+
+    template <typename T>
+    void scrieSectiune(Sectiune id, std::span<const T> valori) {
+        scrieSectiune(id, valori.data(), valori.size_bytes());
+    }
+
+    template <typename T>
+    void scrieSectiune(Sectiune id, const Coloana<T>& coloana) {
+        scrieSectiune(id, coloana.span());
+    }
+
+    // Scrie tabelul și antetul și face fsync; fără apel, fișierul rămâne invalid
+    void finalizeaza(std::uint64_t secventaJurnal);
+};
+
+class CititorSnapshot {
+private:
+    std::shared_ptr<const FisierMapat> fisier;
+    const AntetSnapshot* antet = nullptr;
+    std::span<const IntrareSectiune> tabel;
+
+    [[nodiscard]] std::span<const std::byte> octeti(Sectiune id) const;
+
+public:
+    explicit CititorSnapshot(const std::string& cale);
+
+    [[nodiscard]] std::uint64_t getSecventaJurnal() const { return antet->secventaJurnal; }
+
+    // Ține fișierul mapat în viață cât timp coloanele îl folosesc
+    [[nodiscard]] const std::shared_ptr<const FisierMapat>& getFisier() const { return fisier; }
+
+    [[nodiscard]] bool areSectiune(Sectiune id) const;
+
+    // Secțiunea ca tablou de T, direct din memoria mapată
+    template <typename T>
+    [[nodiscard]] std::span<const T> sectiune(Sectiune id) const {
+        const auto date = octeti(id);
+        if (date.size() % sizeof(T) != 0) {
+            throw PersistentaException("Sectiune de dimensiune invalida in snapshot");
+        }
+        // Secțiunile sunt aliniate la 64 de octeți, iar baza mapării e aliniată la pagină
+        return {reinterpret_cast<const T*>(date.data()), date.size() / sizeof(T)};
+    }
+
+    template <typename T>
+    void mapeaza(Sectiune id, Coloana<T>& coloana) const {
+        coloana.mapeaza(sectiune<T>(id), fisier);
+    }
+};
+
+#endif //OOP_SNAPSHOT_H
@@ -0,0 +1,171 @@
+#ifndef OOP_UTILIZATOR_H
+#define OOP_UTILIZATOR_H
+
+#include "Carte.h"
+#include "DataZi.h"
+#include "IstoricImprumuturi.h"
+#include "Metrici.h"
+#include "PoolInternare.h"
+#include "RegistruUtilizatori.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+class CatalogCarti;
+
+// Tipul concret al unui utilizator; indice în tabelul de penalități
+enum class TipUtilizator : std::uint8_t {
+    Student,
+    Profesor
+};
+
+constexpr std::string_view numeTipUtilizator(TipUtilizator tip) {
+    return tip == TipUtilizator::Student ? "Student" : "Profesor";
+}
+
+// Textul de la intrare, mapat o singură dată, la ingestie; nullopt pentru un tip necunoscut
+constexpr std::optional<TipUtilizator> tipUtilizatorDinText(std::string_view tip) {
+    if (tip == "Student") {
+        return TipUtilizator::Student;
+    }
+    if (tip == "Profesor") {
+        return TipUtilizator::Profesor;
+    }
+    return std::nullopt;
+}
+
+// Clasă abstractă: Utilizator
+class Utilizator {
+protected:
+    std::string nume;
+    std::string email;
+    TipUtilizator tipUtilizator;
+    std::uint32_t idFacultateDepartament; // internat: mii de utilizatori împart câteva facultăți
+    std::atomic<double> penalizari; // penalitățile aceluiași utilizator pot fi aplicate din fire diferite
+    IstoricImprumuturi istoriculImprumuturilor;
+    std::mutex mutexIstoric; // împrumuturile aceluiași utilizator pot fi create din fire diferite
+    std::atomic<int> imprumuturiActive{0}; // comparat direct cu limita, fără a parcurge istoricul
+    static RegistruUtilizatori registruUtilizatori;
+    static PoolInternare facultatiDepartamente;
+
+public:
+    Utilizator(std::string nume, std::string email, TipUtilizator tipUtilizator, std::string_view facultateDepartament)
+        : nume(std::move(nume)), email(std::move(email)), tipUtilizator(tipUtilizator),
+          idFacultateDepartament(facultatiDepartamente.interneaza(facultateDepartament)), penalizari(0) {} // Inițializare penalități
+
+    // Un singur obiect canonic per email: copiile ar împărți istoricul și penalitățile în două
+    Utilizator(const Utilizator&) = delete;
+    Utilizator& operator=(const Utilizator&) = delete;
+
+    // Metodă pentru a adăuga penalități; trecută și în totalurile pe tip de utilizator (vezi Analitice.h)
+    virtual void adaugaPenalitate(double suma);
+
+    // Metodă pentru a obține penalitățile
+    double getPenalizari() const {
+        return penalizari.load(std::memory_order_relaxed);
+    }
+
+    // Inclusiv facultatea sau departamentul, prin FormatatorText
+    virtual void afisare() const;
+
+    const std::string& getEmail() const { return email; }
+    const std::string& getNume() const { return nume; }
+    std::string_view getTipUtilizator() const { return numeTipUtilizator(tipUtilizator); }
+    [[nodiscard]] TipUtilizator getTip() const { return tipUtilizator; }
+
+    // Facultatea pentru studenți, departamentul pentru profesori
+    const std::string& getFacultateDepartament() const { return facultatiDepartamente[idFacultateDepartament]; }
+
+    // Același id înseamnă aceeași facultate sau același departament, fără comparație de șiruri
+    [[nodiscard]] std::uint32_t getIdFacultateDepartament() const { return idFacultateDepartament; }
+
+    // Numele după id-ul intern, pentru rapoartele care rețin doar id-ul
+    static const std::string& numeFacultateDepartament(std::uint32_t id) { return facultatiDepartamente[id]; }
+
+    virtual int limitaImprumuturi() const = 0;
+
+    // Ocupă un loc din limită; false, fără efect, dacă limita e atinsă.
+    // CAS în loc de fetch_add, ca două împrumuturi simultane să nu treacă amândouă peste limită
+    bool rezervaImprumut() {
+        const int limita = limitaImprumuturi();
+        int active = imprumuturiActive.load(std::memory_order_relaxed);
+        do {
+            if (active >= limita) {
+                return false;
+            }
+        } while (!imprumuturiActive.compare_exchange_weak(active, active + 1, std::memory_order_relaxed));
+        return true;
+    }
+
+    void elibereazaImprumut() {
+        imprumuturiActive.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // La refacerea unui împrumut activ salvat
+    void restaureazaImprumut() {
+        imprumuturiActive.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] int getImprumuturiActive() const { return imprumuturiActive.load(std::memory_order_relaxed); }
+
+    static std::shared_ptr<Utilizator> cautaUtilizator(std::string_view email) {
+        MASOARA_LATENTA(metrici.cautareUtilizator);
+        return registruUtilizatori.cauta(email);
+    }
+
+    // Acces la registru pentru firele care adaugă sau șterg utilizatori
+    static RegistruUtilizatori& getRegistru() {
+        return registruUtilizatori;
+    }
+
+    void adaugaImprumut(const IstoricImprumut& imprumut) {
+        const std::lock_guard<std::mutex> blocare(mutexIstoric);
+        istoriculImprumuturilor.adauga(imprumut);
+    }
+
+    [[nodiscard]] const IstoricImprumuturi& getIstoric() const { return istoriculImprumuturilor; }
+
+    // Metodă pentru a afișa istoricul împrumuturilor
+    void afiseazaIstoriculImprumuturilor(const CatalogCarti& catalog) const;
+
+    virtual ~Utilizator() = default;
+};
+
+// Clasă derivată: Student
+class Student : public Utilizator {
+public:
+    Student(std::string nume, std::string email, std::string_view facultate)
+        : Utilizator(std::move(nume), std::move(email), TipUtilizator::Student, facultate) {}
+
+    int limitaImprumuturi() const override {
+        return 5;
+    }
+};
+
+// Clasă derivată: Profesor
+class Profesor : public Utilizator {
+public:
+    Profesor(std::string nume, std::string email, std::string_view departament)
+        : Utilizator(std::move(nume), std::move(email), TipUtilizator::Profesor, departament) {}
+
+    int limitaImprumuturi() const override {
+        return 10;
+    }
+};
+
+// Design Pattern: Factory for creating users
+// Creează obiectul o singură dată, îl înregistrează și întoarce un handle spre același obiect
+class UtilizatorFactory {
+public:
+    static std::shared_ptr<Utilizator> creareUtilizator(TipUtilizator tip, std::string nume, std::string email, std::string_view facultateDepartament);
+
+    // Tipul dat ca text ("Student"/"Profesor"); ImprumutException pentru orice altă valoare
+    static std::shared_ptr<Utilizator> creareUtilizator(std::string_view tip, std::string nume, std::string email, std::string_view facultateDepartament);
+};
+
+#endif //OOP_UTILIZATOR_H
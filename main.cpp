@@ -1,395 +1,32 @@
+#include "Analitice.h"
+#include "Biblioteca.h"
+#include "Carte.h"
+#include "DataZi.h"
+#include "Exceptii.h"
+#include "Formatare.h"
+#include "Imprumut.h"
+#include "ImportDate.h"
+#include "Metrici.h"
+#include "MotorPenalitati.h"
+#include "Persistenta.h"
+#include "PoliticaPenalitati.h"
+#include "ServerComenzi.h"
+#include "Utilizator.h"
+
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <vector>
-#include <unordered_map>
-#include <algorithm>
 #include <memory>
+#include <optional>
 #include <exception>
-#include <stdexcept>
-#include <chrono>
-#include <iomanip>
+#include <utility>
 
 using namespace std;
 
-// ------------------- EXCEPȚII -------------------
-class ImprumutException : public runtime_error {
-public:
-    explicit ImprumutException(const string& mesaj) : runtime_error(mesaj) {}
-};
-
-// ------------------- CLASE ȘI IERARHII -------------------
-
-// Penalitate (interfață abstractă)
-class Penalitate {
-public:
-    virtual double calculeazaPenalitate() const = 0; // Elimină parametrul
-    virtual ~Penalitate() = default;
-};
-
-// Clasa de bază: Carte
-class Carte : public Penalitate {
-protected:
-    string titlu;
-    string autor;
-    int anPublicare;
-
-public:
-    Carte() : titlu(""), autor(""), anPublicare(0) {}
-
-    Carte(const string& titlu, const string& autor, int anPublicare)
-        : titlu(titlu), autor(autor), anPublicare(anPublicare) {}
-
-    virtual void afisare() const {
-        cout << "Titlu: " << titlu << ", Autor: " << autor << ", An publicare: " << anPublicare << endl;
-    }
-
-    [[nodiscard]] string getTitlu() const { return titlu; }
-
-    double calculeazaPenalitate() const override {
-        return 5; // Penalitate standard
-    }
-};
-
-// Clasă derivată: CarteFizica
-class CarteFizica : public Carte {
-private:
-    int numarPagini;
-    string stareFizica; // "buna", "uzata"
-
-public:
-    CarteFizica(const string& titlu, const string& autor, int anPublicare, int numarPagini, const string& stareFizica)
-        : Carte(titlu, autor, anPublicare), numarPagini(numarPagini), stareFizica(stareFizica) {}
-
-    void afisare() const override {
-        Carte::afisare();
-        cout << "Numar pagini: " << numarPagini << ", Stare fizica: " << stareFizica << endl;
-    }
-
-    double calculeazaPenalitate() const override {
-        double penalitate = 10 * 1.0;
-        if (stareFizica == "uzata") {
-            penalitate += 10;
-        }
-        return penalitate;
-    }
-};
-
-// Clasă derivată: CarteDigitala
-class CarteDigitala : public Carte {
-private:
-    float dimensiuneFisier; // MB
-    string format;          // PDF, EPUB
-
-public:
-    CarteDigitala(const string& titlu, const string& autor, int anPublicare, float dimensiuneFisier, const string& format)
-        : Carte(titlu, autor, anPublicare), dimensiuneFisier(dimensiuneFisier), format(format) {}
-
-    void afisare() const override {
-        Carte::afisare();
-        cout << "Dimensiune fisier: " << dimensiuneFisier << " MB, Format: " << format << endl;
-    }
-
-    double calculeazaPenalitate() const override {
-        return 5.0; // Penalitate fixă pentru cărțile digitale
-    }
-};
-
-class IstoricImprumut {
-public:
-    string titluCarte;
-    string dataImprumut;
-    string dataReturnare;
-
-    IstoricImprumut(const string& titlu, const string& imprumut, const string& returnare)
-        : titluCarte(titlu), dataImprumut(imprumut), dataReturnare(returnare) {}
-};
-
-// Clasă abstractă: Utilizator
-class Utilizator {
-protected:
-    string nume;
-    string email;
-    string tipUtilizator;
-    double penalizari; // Nou câmp pentru penalități
-    vector<IstoricImprumut> istoriculImprumuturilor;
-    static unordered_map<string, shared_ptr<Utilizator>> registruUtilizatori;
-
-public:
-    Utilizator(const string& nume, const string& email, const string& tipUtilizator)
-        : nume(nume), email(email), tipUtilizator(tipUtilizator), penalizari(0) {} // Inițializare penalități
-
-    // Metodă pentru a adăuga penalități
-    virtual void adaugaPenalitate(double suma) {
-        penalizari += suma;
-    }
-
-    // Metodă pentru a obține penalitățile
-    double getPenalizari() const {
-        return penalizari;
-    }
-
-    virtual void afisare() const {
-        cout << "Nume: " << nume << ", Email: " << email << ", Tip utilizator: " << tipUtilizator
-             << ", Penalitati: " << penalizari << " RON" << endl; // Afișează penalitățile
-    }
-    string getEmail() const { return email; }
-
-    virtual int limitaImprumuturi() const = 0;
-
-    static shared_ptr<Utilizator> cautaUtilizator(const string& email) {
-        if (registruUtilizatori.find(email) != registruUtilizatori.end()) {
-            return registruUtilizatori[email];
-        }
-        return nullptr;
-    }
-    void adaugaImprumut(const IstoricImprumut& imprumut) {
-        istoriculImprumuturilor.push_back(imprumut);
-    }
-
-    // Metodă pentru a afișa istoricul împrumuturilor
-    void afiseazaIstoriculImprumuturilor() const {
-        cout << "Istoricul imprumuturilor pentru " << nume << ":\n";
-        for (const auto& imprumut : istoriculImprumuturilor) {
-            cout << "Titlu: " << imprumut.titluCarte
-                 << ", Data imprumut: " << imprumut.dataImprumut
-                 << ", Data returnare: " << imprumut.dataReturnare << endl;
-        }
-    }
-
-    virtual ~Utilizator() = default;
-};
-
-unordered_map<string, shared_ptr<Utilizator>> Utilizator::registruUtilizatori;
-
-// Clasă derivată: Student
-class Student : public Utilizator {
-private:
-    string facultate;
-
-public:
-    Student(const string& nume, const string& email, const string& facultate)
-        : Utilizator(nume, email, "Student"), facultate(facultate) {
-        registruUtilizatori[email] = make_shared<Student>(*this);
-    }
-
-    void afisare() const override {
-        Utilizator::afisare();
-        cout << "Facultate: " << facultate << endl;
-    }
-
-    int limitaImprumuturi() const override {
-        return 5;
-    }
-};
-
-// Clasă derivată: Profesor
-class Profesor : public Utilizator {
-private:
-    string departament;
-
-public:
-    Profesor(const string& nume, const string& email, const string& departament)
-        : Utilizator(nume, email, "Profesor"), departament(departament) {
-        registruUtilizatori[email] = make_shared<Profesor>(*this);
-    }
-
-    void afisare() const override {
-        Utilizator::afisare();
-        cout << "Departament: " << departament << endl;
-    }
-
-    int limitaImprumuturi() const override {
-        return 10;
-    }
-};
-
-// Clasă abstractă: ImprumutAbstract
-class ImprumutAbstract {
-protected:
-    int idImprumut;
-    string dataImprumut;
-    string dataReturnare;
-
-    static int contorID;
-    static int numarTotalImprumuturi;
-
-public:
-    ImprumutAbstract(int id, const string& imprumut, const string& returnare)
-        : idImprumut(id), dataImprumut(imprumut), dataReturnare(returnare) {
-        ++numarTotalImprumuturi;
-    }
-
-    static int genereazaID() {
-        return ++contorID;
-    }
-
-    static int getNumarTotalImprumuturi() {
-        return numarTotalImprumuturi;
-    }
-
-    virtual double calculeazaPenalitate(const string& returnare) const = 0;
-
-    virtual ~ImprumutAbstract() = default;
-};
-
-int ImprumutAbstract::contorID = 0;
-int ImprumutAbstract::numarTotalImprumuturi = 0;
-
-// Clasă derivată: ImprumutCarteFizica
-class ImprumutCarteFizica : public ImprumutAbstract {
-private:
-    CarteFizica carte;
-    Utilizator& utilizator;
-
-public:
-    ImprumutCarteFizica(const string& imprumut, const string& returnare, const CarteFizica& carte, Utilizator& utilizator)
-        : ImprumutAbstract(genereazaID(), imprumut, returnare), carte(carte), utilizator(utilizator) {
-        utilizator.adaugaImprumut(IstoricImprumut(carte.getTitlu(), imprumut, returnare)); // Adaugarea în istoric
-    }
-    double calculeazaPenalitate(const string& returnare) const override {
-        // Conversie string -> data
-        tm dataImprumutTM = {}, dataReturnareTM = {};
-        istringstream ssImprumut(dataImprumut);
-        istringstream ssReturnare(returnare);
-        ssImprumut >> get_time(&dataImprumutTM, "%Y-%m-%d");
-        ssReturnare >> get_time(&dataReturnareTM, "%Y-%m-%d");
-
-        auto imprumutDate = chrono::system_clock::from_time_t(mktime(&dataImprumutTM));
-        auto returnareDate = chrono::system_clock::from_time_t(mktime(&dataReturnareTM));
-
-        // Calculăm diferența în zile
-        auto diff = chrono::duration_cast<chrono::hours>(returnareDate - imprumutDate).count() / 24;
-
-        // Verificăm numărul de zile de întârziere față de perioada standard
-        if (diff > 14) {
-            double penalitate = (diff - 14) * carte.calculeazaPenalitate(); // Calcul penalitate
-            utilizator.adaugaPenalitate(penalitate); // Aplica penalitatea utilizatorului
-            return penalitate;
-        }
-        return 0; // Nu se aplică penalitate dacă întârzierea este <= 14 zile
-    }
-
-    void afisare() const {
-        cout << "ID Imprumut: " << idImprumut << ", Data imprumut: " << dataImprumut
-             << ", Data returnare: " << dataReturnare << endl;
-        cout << "Carte: ";
-        carte.afisare();
-        cout << "Utilizator: ";
-        utilizator.afisare();
-    }
-};
-
-// Clasă derivată: ImprumutCarteDigitala
-class ImprumutCarteDigitala : public ImprumutAbstract {
-private:
-    CarteDigitala carte;
-    Utilizator& utilizator;
-
-public:
-    ImprumutCarteDigitala(const string& imprumut, const string& returnare, const CarteDigitala& carte, Utilizator& utilizator)
-        : ImprumutAbstract(genereazaID(), imprumut, returnare), carte(carte), utilizator(utilizator) {
-        utilizator.adaugaImprumut(IstoricImprumut(carte.getTitlu(), imprumut, returnare)); // Adaugarea în istoric
-    }
-    double calculeazaPenalitate(const string& returnare) const override {
-        // Conversie string -> data
-        tm dataImprumutTM = {}, dataReturnareTM = {};
-        istringstream ssImprumut(dataImprumut);
-        istringstream ssReturnare(returnare);
-        ssImprumut >> get_time(&dataImprumutTM, "%Y-%m-%d");
-        ssReturnare >> get_time(&dataReturnareTM, "%Y-%m-%d");
-
-        auto imprumutDate = chrono::system_clock::from_time_t(mktime(&dataImprumutTM));
-        auto returnareDate = chrono::system_clock::from_time_t(mktime(&dataReturnareTM));
-
-        auto diff = chrono::duration_cast<chrono::hours>(returnareDate - imprumutDate).count() / 24;
-
-        if (diff > 14) {
-            return (diff - 14) * carte.calculeazaPenalitate(); // Penalitate pentru fiecare zi de întârziere
-        }
-        return 0;
-    }
-
-    void afisare() const {
-        cout << "ID Imprumut: " << idImprumut << ", Data imprumut: " << dataImprumut
-             << ", Data returnare: " << dataReturnare << endl;
-        cout << "Carte: ";
-        carte.afisare();
-        cout << "Utilizator: ";
-        utilizator.afisare();
-    }
-};
-
-// ------------------- TEMPLATE ȘI STL -------------------
-template <typename T>
-class Biblioteca {
-private:
-    vector<T> colectie;
-
-public:
-    void adauga(const T& element) {
-        colectie.push_back(element);
-    }
-
-    const vector<T>& getCarti() const {
-        return colectie;
-    }
-
-    void afisare() const {
-        for (const auto& elem : colectie) {
-            elem->afisare(); // Afișare carte
-            cout << endl;
-        }
-    }
-
-    void sorteaza() {
-        sort(colectie.begin(), colectie.end(), [](const T& a, const T& b) {
-            return a->getTitlu() < b->getTitlu(); // Sortare
-        });
-    }
-};
-
-// Design Pattern: Singleton for Library
-class BibliotecaSingleton {
-private:
-    Biblioteca<shared_ptr<Carte>> biblioteca;
-
-    BibliotecaSingleton() {}
-
-public:
-    BibliotecaSingleton(const BibliotecaSingleton&) = delete;
-    BibliotecaSingleton& operator=(const BibliotecaSingleton&) = delete;
-
-    static BibliotecaSingleton& getInstance() {
-        static BibliotecaSingleton instance;
-        return instance;
-    }
-
-    const vector<shared_ptr<Carte>>& getCarti() const {
-        return biblioteca.getCarti();
-    }
-
-    void adaugaCarte(const shared_ptr<Carte>& carte) {
-        biblioteca.adauga(carte);
-    }
-
-    void afisareCarti() const {
-        biblioteca.afisare();
-    }
-};
-
-// Design Pattern: Factory for creating users
-class UtilizatorFactory {
-public:
-    static shared_ptr<Utilizator> creareUtilizator(const string& tip, const string& nume, const string& email, const string& facultateDepartament) {
-        if (tip == "Student") {
-            return make_shared<Student>(nume, email, facultateDepartament);
-        } else if (tip == "Profesor") {
-            return make_shared<Profesor>(nume, email, facultateDepartament);
-        }
-        throw ImprumutException("Tip de utilizator necunoscut!");
-    }
-};
-
 // ------------------- MENIU INTERACTIV -------------------
 void afiseazaMeniu() {
     cout << "\n=== MENIU INTERACTIV ===\n";
@@ -401,16 +38,179 @@ void afiseazaMeniu() {
     cout << "6. Afiseaza numar total de imprumuturi\n";
     cout << "7. Afiseaza penalitatile utilizatorilor\n"; // Opțiune existentă
     cout << "8. Vezi istoricul imprumuturilor unui utilizator\n"; // Noua opțiune
+    cout << "9. Cauta carti dupa inceputul titlului\n";
+    cout << "10. Cauta carti dupa autor\n";
+    cout << "11. Calculeaza penalitatile tuturor imprumuturilor la o data\n";
+    cout << "12. Salveaza starea bibliotecii (snapshot)\n";
+    cout << "13. Import masiv din fisier CSV/JSONL\n";
+    cout << "14. Rasfoieste catalogul in ordine alfabetica\n";
+    cout << "15. Exporta carti/utilizatori/istoric (text/csv/json)\n";
+    cout << "16. Cautare avansata (autor, ani, tip, stare/format)\n";
+    cout << "17. Cauta dupa cuvinte din titlu sau autor\n";
+    cout << "18. Returneaza o carte\n";
+    cout << "19. Seteaza numarul de exemplare ale unei carti\n";
+    cout << "20. Vezi exemplarele unei carti si cine le are\n";
+    cout << "21. Istoricul unui utilizator intre doua date\n";
+    cout << "22. Ultimele imprumuturi ale unui utilizator\n";
+    cout << "23. Exporta metricile (format Prometheus)\n";
+    cout << "24. Avanseaza data: imprumuturile devenite intarziate si penalitatile lor\n";
+    cout << "25. Statistici: top carti, facultati pe luni, penalitati pe tip, cititori distincti\n";
     cout << "0. Iesire\n";
     cout << "Alege o optiune: ";
 }
 
-int main() {
+// Import masiv după tipul dat ("carti", "utilizatori", "imprumuturi"); false pentru un tip necunoscut
+bool importaFisier(const string& tip, const string& cale, BibliotecaSingleton& biblioteca,
+                   vector<shared_ptr<Utilizator>>& utilizatori, vector<shared_ptr<ImprumutAbstract>>& imprumuturi) {
+    const ImportDate import;
+    RaportImport raport;
+    if (tip == "carti") {
+        raport = import.importaCarti(cale, biblioteca);
+    } else if (tip == "utilizatori") {
+        raport = import.importaUtilizatori(cale, utilizatori);
+    } else if (tip == "imprumuturi") {
+        raport = import.importaImprumuturi(cale, biblioteca, imprumuturi);
+    } else {
+        cout << "Tip de import necunoscut! (carti/utilizatori/imprumuturi)\n";
+        return false;
+    }
+    raport.afisare();
+    return true;
+}
+
+// Export în fișier ("carti", "utilizatori" sau "istoric" pentru utilizatorul `email`), în format text/csv/json.
+// Cărțile și istoricul sunt scrise pe bucăți, deci memoria nu crește cu mărimea listei
+bool exportaFisier(const string& tip, const string& numeFormat, const string& cale, const BibliotecaSingleton& biblioteca,
+                   const vector<shared_ptr<Utilizator>>& utilizatori, const string& email = "") {
+    const auto format = formatListareDinNume(numeFormat);
+    if (!format) {
+        cout << "Format necunoscut! (text/csv/json)\n";
+        return false;
+    }
+    shared_ptr<Utilizator> utilizator;
+    if (tip == "istoric" && !(utilizator = Utilizator::cautaUtilizator(email))) {
+        cout << "Utilizatorul nu a fost gasit!\n";
+        return false;
+    }
+    if (tip != "carti" && tip != "utilizatori" && tip != "istoric") {
+        cout << "Tip de export necunoscut! (carti/utilizatori/istoric)\n";
+        return false;
+    }
+
+    ofstream fisier(cale, ios::binary);
+    if (!fisier) {
+        cout << "Fisierul " << cale << " nu poate fi scris!\n";
+        return false;
+    }
+    const auto formatator = Formatator::creeaza(*format);
+    IesireBufferata iesire(fisier, 1 << 20);
+    if (tip == "carti") {
+        CursorCatalog(biblioteca.getVersiuneCatalog(), *formatator, iesire).scrieTot(64 * 1024);
+    } else if (tip == "utilizatori") {
+        scrieUtilizatori(utilizatori, *formatator, iesire);
+    } else {
+        CursorIstoric(*utilizator, biblioteca.getCarti(), *formatator, iesire).scrieTot(64 * 1024);
+    }
+    if (!fisier) {
+        cout << "Eroare la scrierea in " << cale << "!\n";
+        return false;
+    }
+    cout << "Export salvat in " << cale << endl;
+    return true;
+}
+
+// Un câmp opțional al căutării avansate: linia goală înseamnă fără filtru
+optional<string> citesteFiltru(const string& mesaj) {
+    cout << mesaj;
+    string valoare;
+    getline(cin, valoare);
+    return valoare.empty() ? nullopt : optional(valoare);
+}
+
+// Textul care nu e în întregime un număr de tipul cerut (sau care iese din domeniul lui) nu e filtru
+template <typename T = int>
+optional<T> citesteFiltruIntreg(const string& mesaj) {
+    const auto valoare = citesteFiltru(mesaj);
+    T numar = 0;
+    if (!valoare) {
+        return nullopt;
+    }
+    const char* sfarsit = valoare->data() + valoare->size();
+    if (const auto [urmator, eroare] = from_chars(valoare->data(), sfarsit, numar); eroare != errc{} || urmator != sfarsit) {
+        return nullopt;
+    }
+    return numar;
+}
+
+// Argument opțional: directorul de date. Fără el programul nu citește și nu scrie nimic pe disc.
+// Dacă directorul conține penalitati.txt, tarifele de penalizare sunt citite de acolo (vezi TabelPenalitati).
+// Import fără meniu: oop <director> import <tip> <fisier> [<tip> <fisier> ...], apoi snapshot.
+// Export fără meniu: oop <director> export <carti|utilizatori> <text|csv|json> <fisier>.
+// Server fără meniu: oop <director> server [<socket>]; fără socket, comenzile vin pe stdin.
+int main(int argc, char* argv[]) {
     try {
         auto& biblioteca = BibliotecaSingleton::getInstance();
         vector<shared_ptr<Utilizator>> utilizatori;
         vector<shared_ptr<ImprumutAbstract>> imprumuturi;
 
+        unique_ptr<Persistenta> persistenta;
+        if (argc > 1) {
+            persistenta = make_unique<Persistenta>(argv[1]);
+            // Blocurile reci de istoric ies din memorie; fișierul e refăcut la fiecare pornire
+            IstoricImprumuturi::folosesteArhiva(make_shared<ArhivaIstoric>((filesystem::path(argv[1]) / "istoric.tmp").string()));
+            // Tarifele de penalizare pot fi schimbate fără recompilare; se aplică și împrumuturilor refăcute
+            const auto caleReguli = filesystem::path(argv[1]) / "penalitati.txt";
+            if (filesystem::exists(caleReguli)) {
+                TabelPenalitati::foloseste(TabelPenalitati::incarca(caleReguli.string()));
+            }
+            const auto reaplicate = persistenta->recupereaza(biblioteca, utilizatori, imprumuturi);
+            // În modul server stdout e rezervat răspunsurilor
+            const bool server = argc > 2 && string(argv[2]) == "server";
+            (server ? cerr : cout) << "Stare incarcata din " << argv[1] << ": " << biblioteca.getCarti().size() << " carti, "
+                 << utilizatori.size() << " utilizatori, " << imprumuturi.size() << " imprumuturi ("
+                 << reaplicate << " operatii din jurnal)\n";
+        }
+
+        if (argc > 2 && string(argv[2]) == "import") {
+            if (argc % 2 != 1) {
+                cout << "Utilizare: " << argv[0] << " <director> import <tip> <fisier> [<tip> <fisier> ...]\n";
+                return 1;
+            }
+            for (int i = 3; i + 1 < argc; i += 2) {
+                cout << "Import " << argv[i] << " din " << argv[i + 1] << endl;
+                if (!importaFisier(argv[i], argv[i + 1], biblioteca, utilizatori, imprumuturi)) {
+                    return 1;
+                }
+            }
+            // Importul nu trece prin jurnal: starea nouă ajunge pe disc direct ca snapshot
+            persistenta->salveaza(biblioteca, utilizatori, imprumuturi);
+            cout << "Stare salvata cu succes!\n";
+            return 0;
+        }
+
+        if (argc > 2 && string(argv[2]) == "export") {
+            if (argc != 6) {
+                cout << "Utilizare: " << argv[0] << " <director> export <carti|utilizatori> <text|csv|json> <fisier>\n";
+                return 1;
+            }
+            return exportaFisier(argv[3], argv[4], argv[5], biblioteca, utilizatori) ? 0 : 1;
+        }
+
+        if (argc > 2 && string(argv[2]) == "server") {
+            if (argc > 4) {
+                cout << "Utilizare: " << argv[0] << " <director> server [<socket>]\n";
+                return 1;
+            }
+            ServerComenzi server(biblioteca, utilizatori, imprumuturi, persistenta.get());
+            if (argc == 4) {
+                server.servesteSocket(argv[3]);
+            } else {
+                server.servesteFlux(cin, cout);
+            }
+            server.scrieStatistici(cerr);
+            return 0;
+        }
+
         int optiune = -1;
         while (optiune != 0) {
             afiseazaMeniu();
@@ -436,8 +236,11 @@ int main() {
                     getline(cin, facultateDepartament);
 
                     try {
-                        auto utilizator = UtilizatorFactory::creareUtilizator(tipUtilizator, nume, email, facultateDepartament);
+                        auto utilizator = UtilizatorFactory::creareUtilizator(tipUtilizator, std::move(nume), std::move(email), facultateDepartament);
                         utilizatori.push_back(utilizator);
+                        if (persistenta) {
+                            persistenta->utilizatorAdaugat(*utilizator);
+                        }
                         cout << "Utilizator adaugat cu succes!\n";
                     } catch (const ImprumutException& ex) {
                         cout << "Eroare: " << ex.what() << endl;
@@ -473,7 +276,10 @@ int main() {
                         getline(cin, stareFizica);
 
                         auto carte = make_shared<CarteFizica>(titlu, autor, anPublicare, numarPagini, stareFizica);
-                        biblioteca.adaugaCarte(carte);
+                        const IdCarte id = biblioteca.adaugaCarte(carte);
+                        if (persistenta) {
+                            persistenta->carteAdaugata(biblioteca.getCarte(id));
+                        }
                     } else if (tipCarte == "Digitala") {
                         cout << "Dimensiune fisier (MB): ";
                         float dimensiuneFisier;
@@ -485,7 +291,10 @@ int main() {
                         getline(cin, format);
 
                         auto carte = make_shared<CarteDigitala>(titlu, autor, anPublicare, dimensiuneFisier, format);
-                        biblioteca.adaugaCarte(carte);
+                        const IdCarte id = biblioteca.adaugaCarte(carte);
+                        if (persistenta) {
+                            persistenta->carteAdaugata(biblioteca.getCarte(id));
+                        }
                     } else {
                         cout << "Tip carte necunoscut!\n";
                     }
@@ -509,33 +318,36 @@ int main() {
                     getline(cin, titluCarte);
 
                     cout << "Data imprumut (YYYY-MM-DD): ";
-                    string dataImprumut;
-                    getline(cin, dataImprumut);
+                    string textImprumut;
+                    getline(cin, textImprumut);
 
                     cout << "Data returnare (YYYY-MM-DD): ";
-                    string dataReturnare;
-                    getline(cin, dataReturnare);
-
-                    // Căutare carte
-                    const auto& carti = biblioteca.getCarti(); // Obține colecția de cărți
-                    bool carteGasita = false;
-                    for (const auto& carte : carti) {
-                        if (carte->getTitlu() == titluCarte) {
-                            // Creare împrumut
-                            if (auto carteFizica = dynamic_pointer_cast<CarteFizica>(carte)) {
-                                imprumuturi.push_back(make_shared<ImprumutCarteFizica>(dataImprumut, dataReturnare, *carteFizica, *utilizator));
-                                carteGasita = true;
-                            } else if (auto carteDigitala = dynamic_pointer_cast<CarteDigitala>(carte)) {
-                                imprumuturi.push_back(make_shared<ImprumutCarteDigitala>(dataImprumut, dataReturnare, *carteDigitala, *utilizator));
-                                carteGasita = true;
-                            }
-                            break;
-                        }
+                    string textReturnare;
+                    getline(cin, textReturnare);
+
+                    // Datele se parsează o singură dată, aici; împrumutul păstrează doar zilele
+                    const auto dataImprumut = DataZi::parseaza(textImprumut);
+                    const auto dataReturnare = DataZi::parseaza(textReturnare);
+                    if (!dataImprumut || !dataReturnare) {
+                        cout << "Data invalida! Formatul este YYYY-MM-DD.\n";
+                        break;
                     }
-                    if (carteGasita) {
-                        cout << "Imprumut creat cu succes!\n";
-                    } else {
+
+                    // Căutare carte prin indexul de titluri; limita și exemplarele sunt verificate de inventar
+                    const auto intrare = biblioteca.cautaCarte(titluCarte);
+                    if (!intrare) {
                         cout << "Carte nu a fost gasita!\n";
+                        break;
+                    }
+                    try {
+                        auto imprumut = biblioteca.imprumuta(intrare->id, *utilizator, *dataImprumut, *dataReturnare);
+                        if (persistenta) {
+                            persistenta->imprumutCreat(*imprumut);
+                        }
+                        cout << "Imprumut creat cu succes! ID imprumut: " << imprumut->getId() << endl;
+                        adaugaImprumut(imprumuturi, std::move(imprumut));
+                    } catch (const ImprumutException& ex) {
+                        cout << "Eroare: " << ex.what() << endl;
                     }
                     break;
                 }
@@ -574,7 +386,379 @@ int main() {
                         break;
                     }
 
-                    utilizator->afiseazaIstoriculImprumuturilor(); // Afișează istoricul împrumuturilor
+                    utilizator->afiseazaIstoriculImprumuturilor(biblioteca.getCarti()); // Afișează istoricul împrumuturilor
+                    break;
+                }
+                case 9: {
+                    cout << "Inceputul titlului: ";
+                    string prefix;
+                    getline(cin, prefix);
+
+                    const auto rezultate = biblioteca.cautaDupaPrefix(prefix, 20);
+                    if (rezultate.empty()) {
+                        cout << "Nu a fost gasita nicio carte!\n";
+                    }
+                    for (const auto& intrare : rezultate) {
+                        biblioteca.getCarte(intrare.id).afisare();
+                    }
+                    break;
+                }
+                case 10: {
+                    cout << "Autor: ";
+                    string autor;
+                    getline(cin, autor);
+
+                    Interogare interogare;
+                    interogare.autor = autor;
+                    const auto rezultate = biblioteca.interogheaza(interogare).carti;
+                    if (rezultate.empty()) {
+                        cout << "Nu a fost gasita nicio carte!\n";
+                    }
+                    for (const auto id : rezultate) {
+                        biblioteca.getCarte(id).afisare();
+                    }
+                    break;
+                }
+                case 11: {
+                    cout << "Data calculului (YYYY-MM-DD): ";
+                    string textData;
+                    getline(cin, textData);
+
+                    const auto data = DataZi::parseaza(textData);
+                    if (!data) {
+                        cout << "Data invalida! Formatul este YYYY-MM-DD.\n";
+                        break;
+                    }
+
+                    // Recalcularea la aceeași dată nu dublează penalitățile deja aplicate
+                    const MotorPenalitati motor;
+                    const auto rezultat = motor.calculeaza(imprumuturi, *data);
+                    MotorPenalitati::aplica(imprumuturi, rezultat);
+                    if (persistenta) {
+                        persistenta->penalitatiAplicate(*data);
+                    }
+                    cout << "Imprumuturi intarziate: " << rezultat.imprumuturiIntarziate
+                         << ", Total penalitati: " << rezultat.total << " RON\n";
+                    break;
+                }
+                case 12: {
+                    if (!persistenta) {
+                        cout << "Persistenta nu este activa! Porneste programul cu un director de date.\n";
+                        break;
+                    }
+                    try {
+                        persistenta->salveaza(biblioteca, utilizatori, imprumuturi);
+                        cout << "Stare salvata cu succes!\n";
+                    } catch (const PersistentaException& ex) {
+                        cout << "Eroare: " << ex.what() << endl;
+                    }
+                    break;
+                }
+                case 13: {
+                    cout << "Tip import (carti/utilizatori/imprumuturi): ";
+                    string tip;
+                    getline(cin, tip);
+
+                    cout << "Fisier (.csv sau .jsonl): ";
+                    string cale;
+                    getline(cin, cale);
+
+                    try {
+                        if (importaFisier(tip, cale, biblioteca, utilizatori, imprumuturi) && persistenta) {
+                            // Importul nu trece prin jurnal, deci starea e salvată imediat ca snapshot
+                            persistenta->salveaza(biblioteca, utilizatori, imprumuturi);
+                            cout << "Stare salvata cu succes!\n";
+                        }
+                    } catch (const ImportException& ex) {
+                        cout << "Eroare: " << ex.what() << endl;
+                    } catch (const PersistentaException& ex) {
+                        cout << "Eroare: " << ex.what() << endl;
+                    }
+                    break;
+                }
+                case 14: {
+                    cout << "Incepe dupa titlul (gol pentru inceputul catalogului): ";
+                    string titlu;
+                    getline(cin, titlu);
+
+                    // Pagini de câte 50, citite direct din indexul ordonat; cursorul e ultima carte afișată
+                    auto pagina = biblioteca.paginaDupa(titlu, 50);
+                    while (!pagina.empty()) {
+                        for (const auto& intrare : pagina) {
+                            biblioteca.getCarte(intrare.id).afisare();
+                        }
+                        cout << "Pagina urmatoare? (d/n): ";
+                        string raspuns;
+                        getline(cin, raspuns);
+                        if (raspuns != "d") {
+                            break;
+                        }
+                        pagina = biblioteca.paginaDupa(pagina.back().id, 50);
+                    }
+                    if (pagina.empty()) {
+                        cout << "Nu mai sunt carti!\n";
+                    }
+                    break;
+                }
+                case 15: {
+                    cout << "Ce se exporta (carti/utilizatori/istoric): ";
+                    string tip;
+                    getline(cin, tip);
+
+                    string email;
+                    if (tip == "istoric") {
+                        cout << "Email utilizator: ";
+                        getline(cin, email);
+                    }
+
+                    cout << "Format (text/csv/json): ";
+                    string format;
+                    getline(cin, format);
+
+                    cout << "Fisier: ";
+                    string cale;
+                    getline(cin, cale);
+
+                    exportaFisier(tip, format, cale, biblioteca, utilizatori, email);
+                    break;
+                }
+                case 16: {
+                    Interogare interogare;
+                    interogare.autor = citesteFiltru("Autor (gol pentru oricare): ");
+                    interogare.anMinim = citesteFiltruIntreg("Publicata din anul (gol pentru oricare): ");
+                    interogare.anMaxim = citesteFiltruIntreg("Publicata pana in anul (gol pentru oricare): ");
+                    if (const auto tip = citesteFiltru("Tip carte (Fizica/Digitala, gol pentru oricare): ")) {
+                        interogare.tip = *tip == "Digitala" ? TipCarte::Digitala : TipCarte::Fizica;
+                    }
+                    if (interogare.tip != TipCarte::Digitala) {
+                        interogare.stareFizica = citesteFiltru("Stare fizica (gol pentru oricare): ");
+                    }
+                    if (interogare.tip != TipCarte::Fizica) {
+                        interogare.format = citesteFiltru("Format (gol pentru oricare): ");
+                    }
+                    const auto ordonare = citesteFiltru("Ordonare (titlu/an/autor, gol pentru ordinea adaugarii): ");
+                    if (ordonare == "titlu") {
+                        interogare.ordonare = OrdonareCarti::Titlu;
+                    } else if (ordonare == "an") {
+                        interogare.ordonare = OrdonareCarti::AnPublicare;
+                    } else if (ordonare == "autor") {
+                        interogare.ordonare = OrdonareCarti::Autor;
+                    }
+                    interogare.limita = 20;
+                    interogare.deplasament = static_cast<size_t>(max(0, citesteFiltruIntreg("Sari peste primele (gol pentru 0): ").value_or(0)));
+
+                    const auto rezultat = biblioteca.interogheaza(interogare);
+                    cout << "Carti gasite: " << rezultat.total << endl;
+                    for (const auto id : rezultat.carti) {
+                        biblioteca.getCarte(id).afisare();
+                    }
+                    break;
+                }
+                case 17: {
+                    cout << "Cuvinte cautate: ";
+                    string text;
+                    getline(cin, text);
+
+                    const auto rezultate = biblioteca.cautaText(text, 20);
+                    if (rezultate.empty()) {
+                        cout << "Nu a fost gasita nicio carte!\n";
+                    }
+                    for (const auto& rezultat : rezultate) {
+                        biblioteca.getCarte(rezultat.id).afisare();
+                    }
+                    break;
+                }
+                case 18: {
+                    const auto id = citesteFiltruIntreg<IdImprumut>("ID imprumut: ");
+                    auto* imprumut = id ? cautaImprumut(imprumuturi, *id) : nullptr;
+                    if (!imprumut) {
+                        cout << "Imprumutul nu a fost gasit!\n";
+                        break;
+                    }
+                    if (!biblioteca.returneaza(*imprumut)) {
+                        cout << "Imprumutul a fost deja returnat!\n";
+                        break;
+                    }
+                    if (persistenta) {
+                        persistenta->imprumutReturnat(*imprumut);
+                    }
+                    cout << "Carte returnata cu succes!\n";
+                    break;
+                }
+                case 19: {
+                    cout << "Titlu carte: ";
+                    string titluCarte;
+                    getline(cin, titluCarte);
+
+                    const auto intrare = biblioteca.cautaCarte(titluCarte);
+                    const auto numar = citesteFiltruIntreg("Numar exemplare: ");
+                    if (!intrare || !numar || *numar < 0) {
+                        cout << "Carte sau numar invalid!\n";
+                        break;
+                    }
+                    try {
+                        biblioteca.seteazaExemplare(intrare->id, static_cast<unsigned>(*numar));
+                        if (persistenta) {
+                            persistenta->exemplareSetate(intrare->id, static_cast<unsigned>(*numar));
+                        }
+                        cout << "Exemplare actualizate!\n";
+                    } catch (const ImprumutException& ex) {
+                        cout << "Eroare: " << ex.what() << endl;
+                    }
+                    break;
+                }
+                case 20: {
+                    cout << "Titlu carte: ";
+                    string titluCarte;
+                    getline(cin, titluCarte);
+
+                    const auto intrare = biblioteca.cautaCarte(titluCarte);
+                    if (!intrare) {
+                        cout << "Carte nu a fost gasita!\n";
+                        break;
+                    }
+                    if (biblioteca.getCarte(intrare->id).getTip() != TipCarte::Fizica) {
+                        cout << "Doar cartile fizice au exemplare!\n";
+                        break;
+                    }
+                    const auto& inventar = biblioteca.getInventar();
+                    const unsigned exemplare = inventar.exemplare(intrare->id);
+                    cout << "Exemplare: " << exemplare << ", disponibile: " << inventar.disponibile(intrare->id) << endl;
+                    for (unsigned i = 0; i < exemplare; ++i) {
+                        cout << "Exemplar " << i + 1 << ": ";
+                        if (const auto* detinator = inventar.detinator(intrare->id, static_cast<uint8_t>(i))) {
+                            cout << detinator->getNume() << " (" << detinator->getEmail() << ")\n";
+                        } else {
+                            cout << "pe raft\n";
+                        }
+                    }
+                    break;
+                }
+                case 21:
+                case 22: {
+                    cout << "Email utilizator: ";
+                    string emailUtilizator;
+                    getline(cin, emailUtilizator);
+
+                    auto utilizator = Utilizator::cautaUtilizator(emailUtilizator);
+                    if (!utilizator) {
+                        cout << "Utilizatorul nu a fost gasit!\n";
+                        break;
+                    }
+                    const auto& istoric = utilizator->getIstoric();
+
+                    // Doar pozițiile capetelor: blocurile din afara lor nu sunt decomprimate
+                    size_t inceput = 0;
+                    size_t sfarsit = istoric.numar();
+                    if (optiune == 21) {
+                        cout << "De la data (YYYY-MM-DD): ";
+                        string textDe;
+                        getline(cin, textDe);
+                        cout << "Pana la data (YYYY-MM-DD): ";
+                        string textPana;
+                        getline(cin, textPana);
+
+                        const auto de = DataZi::parseaza(textDe);
+                        const auto pana = DataZi::parseaza(textPana);
+                        if (!de || !pana || *pana < *de) {
+                            cout << "Interval invalid! Formatul este YYYY-MM-DD.\n";
+                            break;
+                        }
+                        inceput = istoric.pozitie(*de);
+                        sfarsit = istoric.pozitie(*pana + 1);
+                    } else {
+                        const auto numar = citesteFiltruIntreg("Cate imprumuturi: ");
+                        if (!numar || *numar < 0) {
+                            cout << "Numar invalid!\n";
+                            break;
+                        }
+                        inceput = sfarsit - min(sfarsit, static_cast<size_t>(*numar));
+                    }
+
+                    IesireBufferata iesire(cout);
+                    FormatatorText formatator;
+                    CursorIstoric(*utilizator, biblioteca.getCarti(), formatator, iesire, inceput, sfarsit).scrieTot();
+                    cout << "Imprumuturi afisate: " << sfarsit - inceput << " din " << istoric.numar() << endl;
+                    break;
+                }
+                case 23: {
+                    cout << "Fisier: ";
+                    string cale;
+                    getline(cin, cale);
+
+                    ofstream fisier(cale);
+                    scrieMetriciPrometheus(fisier);
+                    if (!fisier) {
+                        cout << "Fisierul " << cale << " nu poate fi scris!\n";
+                        break;
+                    }
+                    cout << "Metrici salvate in " << cale << endl;
+                    break;
+                }
+                case 24: {
+                    auto& intarzieri = biblioteca.getIntarzieri();
+                    cout << "Data curenta a planificatorului: " << intarzieri.getData().toString() << "\n";
+                    cout << "Noua data (YYYY-MM-DD): ";
+                    string textData;
+                    getline(cin, textData);
+
+                    const auto data = DataZi::parseaza(textData);
+                    if (!data) {
+                        cout << "Data invalida! Formatul este YYYY-MM-DD.\n";
+                        break;
+                    }
+
+                    try {
+                        // Doar împrumuturile care expiră până la data nouă, nu toată lista
+                        const auto lot = intarzieri.avanseaza(*data);
+                        const auto acumulare = intarzieri.acumuleazaPenalitati();
+                        if (persistenta) {
+                            persistenta->intarzieriAvansate(*data);
+                        }
+                        for (const auto& imprumut : lot.imprumuturi) {
+                            cout << "Intarziat: #" << imprumut->getId() << " "
+                                 << imprumut->getUtilizator().getEmail() << " - "
+                                 << imprumut->getCarte().getTitlu() << "\n";
+                        }
+                        cout << "Imprumuturi devenite intarziate: " << lot.imprumuturi.size()
+                             << ", intarziate in total: " << acumulare.imprumuturi
+                             << ", Total penalitati: " << acumulare.total << " RON\n";
+                    } catch (const ImprumutException& ex) {
+                        cout << "Eroare: " << ex.what() << endl;
+                    }
+                    break;
+                }
+                case 25: {
+                    // Agregate ținute la zi la fiecare împrumut; nimic de aici nu parcurge împrumuturile
+                    cout << "Imprumuturi: " << analitice.numarImprumuturi()
+                         << ", cititori distincti (aprox.): " << analitice.cititoriDistincti() << "\n";
+
+                    cout << "Cele mai imprumutate carti:\n";
+                    const auto versiune = biblioteca.getVersiuneCatalog();
+                    size_t loc = 0;
+                    for (const auto& frecventa : analitice.topCarti(10)) {
+                        cout << ++loc << ". " << (*versiune)[frecventa.id].getTitlu() << " - " << frecventa.numar;
+                        if (frecventa.eroare > 0) {
+                            cout << " (cel putin " << frecventa.numar - frecventa.eroare << ")";
+                        }
+                        cout << "\n";
+                    }
+
+                    cout << "Imprumuturi pe luni si facultati/departamente:\n";
+                    optional<int32_t> lunaCurenta;
+                    for (const auto& rand : analitice.peFacultatiSiLuni()) {
+                        if (rand.luna != lunaCurenta) {
+                            lunaCurenta = rand.luna;
+                            const string luna = DataZi::dinCalendar(rand.luna / 12, static_cast<unsigned>(rand.luna % 12) + 1, 1).toString();
+                            cout << luna.substr(0, 7) << " (cititori distincti, aprox.: " << analitice.cititoriDistinctiLuna(rand.luna) << ")\n";
+                        }
+                        cout << "  " << Utilizator::numeFacultateDepartament(rand.idFacultateDepartament) << ": " << rand.numar << "\n";
+                    }
+
+                    cout << "Penalitati pe tip de utilizator:\n";
+                    for (const auto tip : {TipUtilizator::Student, TipUtilizator::Profesor}) {
+                        cout << numeTipUtilizator(tip) << ": " << analitice.penalitati(tip) << " RON\n";
+                    }
                     break;
                 }
                 case 0:
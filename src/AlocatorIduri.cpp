@@ -0,0 +1,34 @@
+#include "AlocatorIduri.h"
+
+using namespace std;
+
+namespace {
+
+atomic<uint64_t> urmatoareaInstanta{1};
+
+} // namespace
+
+thread_local AlocatorIduri::Bloc AlocatorIduri::blocFir;
+
+AlocatorIduri::AlocatorIduri() : instanta(urmatoareaInstanta.fetch_add(1, memory_order_relaxed)) {}
+
+uint64_t AlocatorIduri::rezervaBloc(Bloc& bloc) {
+    // Generația se citește înaintea rezervării: un avans concurent invalidează și blocul nou
+    bloc.generatie = generatie.load(memory_order_acquire);
+    bloc.instanta = instanta;
+    bloc.urmator = primulLiber.fetch_add(dimensiuneBloc, memory_order_relaxed);
+    bloc.sfarsit = bloc.urmator + dimensiuneBloc;
+    return bloc.urmator++;
+}
+
+void AlocatorIduri::avanseazaDupa(uint64_t id) {
+    uint64_t liber = primulLiber.load(memory_order_relaxed);
+    while (liber <= id) {
+        // Niciun bloc rezervat nu conține id: toate sunt sub vechiul primulLiber
+        if (primulLiber.compare_exchange_weak(liber, id + 1, memory_order_relaxed)) {
+            return;
+        }
+    }
+    // id e sub primulLiber, deci poate fi în blocul neconsumat al unui fir
+    generatie.fetch_add(1, memory_order_release);
+}
@@ -0,0 +1,283 @@
+#include "Analitice.h"
+#include "Utilizator.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <functional>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+using namespace std;
+
+AnaliticeImprumuturi analitice;
+
+static_assert(static_cast<size_t>(TipUtilizator::Profesor) + 1 == AnaliticeImprumuturi::numarTipuriUtilizator,
+              "Cate o suma de penalitati pentru fiecare tip de utilizator");
+
+namespace {
+
+constexpr unsigned precizieLuna = 10; // 1 KiB pe lună, eroare tipică ~3%
+
+// 2^-rang pentru toate rangurile posibile ale unui registru
+constexpr auto puteriInverse = [] {
+    array<double, 66> puteri{};
+    double putere = 1;
+    for (auto& valoare : puteri) {
+        valoare = putere;
+        putere /= 2;
+    }
+    return puteri;
+}();
+
+// splitmix64: std::hash poate fi slab în biții de sus, HyperLogLog are nevoie de toți 64
+uint64_t disperseaza(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+bool maiFrecventa(const FrecventaEstimata& a, const FrecventaEstimata& b) {
+    return a.numar != b.numar ? a.numar > b.numar : a.id < b.id;
+}
+
+} // namespace
+
+SchitaFrecvente::SchitaFrecvente(size_t capacitate) : capacitate(max<size_t>(capacitate, 1)) {
+    heap.reserve(this->capacitate);
+}
+
+void SchitaFrecvente::aseaza(size_t pozitie, const FrecventaEstimata& element) {
+    heap[pozitie] = element;
+    pozitii[element.id] = static_cast<uint32_t>(pozitie);
+}
+
+void SchitaFrecvente::urca(size_t pozitie, FrecventaEstimata element) {
+    while (pozitie > 0) {
+        const size_t parinte = (pozitie - 1) / 2;
+        if (heap[parinte].numar <= element.numar) {
+            break;
+        }
+        aseaza(pozitie, heap[parinte]);
+        pozitie = parinte;
+    }
+    aseaza(pozitie, element);
+}
+
+void SchitaFrecvente::coboara(size_t pozitie, FrecventaEstimata element) {
+    while (true) {
+        size_t copil = 2 * pozitie + 1;
+        if (copil >= heap.size()) {
+            break;
+        }
+        if (copil + 1 < heap.size() && heap[copil + 1].numar < heap[copil].numar) {
+            ++copil;
+        }
+        if (heap[copil].numar >= element.numar) {
+            break;
+        }
+        aseaza(pozitie, heap[copil]);
+        pozitie = copil;
+    }
+    aseaza(pozitie, element);
+}
+
+void SchitaFrecvente::adauga(IdCarte id) {
+    if (id >= pozitii.size()) {
+        pozitii.resize(max<size_t>(id + 1, 2 * pozitii.size()), faraPozitie);
+    }
+    if (const uint32_t pozitie = pozitii[id]; pozitie != faraPozitie) {
+        FrecventaEstimata element = heap[pozitie];
+        ++element.numar;
+        coboara(pozitie, element);
+        return;
+    }
+    if (heap.size() < capacitate) {
+        heap.emplace_back();
+        urca(heap.size() - 1, {id, 1, 0});
+        return;
+    }
+    // Cartea nouă preia contorul minim, cu tot cu numărul lui
+    const uint64_t minim = heap[0].numar;
+    pozitii[heap[0].id] = faraPozitie;
+    coboara(0, {id, minim + 1, minim});
+}
+
+vector<FrecventaEstimata> SchitaFrecvente::top(size_t k) const {
+    vector<FrecventaEstimata> rezultat(heap);
+    k = min(k, rezultat.size());
+    partial_sort(rezultat.begin(), rezultat.begin() + static_cast<ptrdiff_t>(k), rezultat.end(), maiFrecventa);
+    rezultat.resize(k);
+    return rezultat;
+}
+
+HyperLogLog::HyperLogLog(unsigned precizie)
+    : registre(size_t{1} << precizie, 0), precizie(precizie), sumaInverse(static_cast<double>(registre.size())),
+      registreNule(registre.size()) {}
+
+void HyperLogLog::adauga(uint64_t amprenta) {
+    const auto index = static_cast<size_t>(amprenta >> (64 - precizie));
+    // Poziția primului bit 1 din restul de 64 - precizie biți; bitul santinelă o limitează
+    const uint64_t rest = (amprenta << precizie) | (uint64_t{1} << (precizie - 1));
+    ridica(index, static_cast<uint8_t>(countl_zero(rest) + 1));
+}
+
+void HyperLogLog::ridica(size_t index, uint8_t rang) {
+    uint8_t& registru = registre[index];
+    if (rang > registru) {
+        registreNule -= registru == 0;
+        sumaInverse += puteriInverse[rang] - puteriInverse[registru];
+        registru = rang;
+    }
+}
+
+void HyperLogLog::combina(const HyperLogLog& alta) {
+    for (size_t i = 0; i < registre.size(); ++i) {
+        ridica(i, alta.registre[i]);
+    }
+}
+
+double HyperLogLog::estimeaza() const {
+    const auto m = static_cast<double>(registre.size());
+    const double alfa = 0.7213 / (1 + 1.079 / m);
+    const double estimare = alfa * m * m / sumaInverse;
+    // Corecția pentru cardinalități mici: numărarea liniară după registrele încă nule
+    if (estimare <= 2.5 * m && registreNule > 0) {
+        return m * log(m / static_cast<double>(registreNule));
+    }
+    return estimare;
+}
+
+void AnaliticeImprumuturi::imprumutCreat(IdCarte carte, const Utilizator& utilizator, DataZi data) {
+    // Emailul identifică utilizatorul (vezi RegistruUtilizatori) și, spre deosebire de adresa obiectului,
+    // nu poate fi refolosit de alt utilizator după ce primul e eliberat
+    const uint64_t amprenta = disperseaza(hash<string_view>{}(utilizator.getEmail()));
+    const int32_t luna = data.getIndexLuna();
+
+    auto& shard = sharduri[ContorSharduit::indexFir()];
+    unique_lock<mutex> blocare(shard.mutexShard);
+    auto cititoriLuna = shard.cititoriPeLuna.find(luna);
+    if (cititoriLuna == shard.cititoriPeLuna.end()) {
+        // Registrele unei luni noi sunt alocate în afara blocării
+        blocare.unlock();
+        HyperLogLog noua(precizieLuna);
+        blocare.lock();
+        cititoriLuna = shard.cititoriPeLuna.try_emplace(luna, std::move(noua)).first;
+    }
+    ++shard.imprumuturi;
+    shard.carti.adauga(carte);
+    ++shard.lunaFacultate[{luna, utilizator.getIdFacultateDepartament()}];
+    shard.cititori.adauga(amprenta);
+    cititoriLuna->second.adauga(amprenta);
+}
+
+void AnaliticeImprumuturi::penalitateAplicata(TipUtilizator tip, double suma) {
+    sumePenalitati[ContorSharduit::indexFir()].suma[static_cast<size_t>(tip)].fetch_add(suma, memory_order_relaxed);
+}
+
+vector<FrecventaEstimata> AnaliticeImprumuturi::topCarti(size_t k) const {
+    // numar = suma minimelor tuturor shard-urilor + (numar - minim) din shard-urile care țin cartea
+    unordered_map<IdCarte, FrecventaEstimata> combinate;
+    uint64_t sumaMinime = 0;
+    for (const auto& shard : sharduri) {
+        const lock_guard<mutex> blocare(shard.mutexShard);
+        const uint64_t minim = shard.carti.margineAbsente();
+        sumaMinime += minim;
+        for (const auto& contor : shard.carti.getContoare()) {
+            auto& combinat = combinate.try_emplace(contor.id, FrecventaEstimata{contor.id, 0, 0}).first->second;
+            combinat.numar += contor.numar - minim;
+            combinat.eroare += minim - contor.eroare; // eroarea e minimul de la preluare, deci cel mult minimul curent
+        }
+    }
+    vector<FrecventaEstimata> rezultat;
+    rezultat.reserve(combinate.size());
+    for (auto& [id, frecventa] : combinate) {
+        frecventa.numar += sumaMinime;
+        frecventa.eroare = sumaMinime - frecventa.eroare;
+        rezultat.push_back(frecventa);
+    }
+    k = min({k, rezultat.size(), capacitateTop});
+    partial_sort(rezultat.begin(), rezultat.begin() + static_cast<ptrdiff_t>(k), rezultat.end(), maiFrecventa);
+    rezultat.resize(k);
+    return rezultat;
+}
+
+vector<ImprumuturiFacultateLuna> AnaliticeImprumuturi::peFacultatiSiLuni() const {
+    const auto maiDevreme = [](const ImprumuturiFacultateLuna& a, const ImprumuturiFacultateLuna& b) {
+        return a.luna != b.luna ? a.luna < b.luna : a.idFacultateDepartament < b.idFacultateDepartament;
+    };
+    vector<ImprumuturiFacultateLuna> rezultat;
+    vector<ImprumuturiFacultateLuna> rand;
+    vector<ImprumuturiFacultateLuna> interclasate;
+    for (const auto& shard : sharduri) {
+        rand.clear();
+        {
+            const lock_guard<mutex> blocare(shard.mutexShard);
+            for (const auto& [cheie, numar] : shard.lunaFacultate) {
+                rand.push_back({cheie.second, cheie.first, numar});
+            }
+        }
+        if (rand.empty()) {
+            continue;
+        }
+        // Interclasare; aceeași lună și facultate din shard-uri diferite devin un singur rând
+        interclasate.clear();
+        interclasate.reserve(rezultat.size() + rand.size());
+        auto a = rezultat.begin();
+        auto b = rand.begin();
+        while (a != rezultat.end() || b != rand.end()) {
+            if (b == rand.end() || (a != rezultat.end() && maiDevreme(*a, *b))) {
+                interclasate.push_back(*a++);
+            } else if (a == rezultat.end() || maiDevreme(*b, *a)) {
+                interclasate.push_back(*b++);
+            } else {
+                interclasate.push_back({a->idFacultateDepartament, a->luna, a->numar + b->numar});
+                ++a;
+                ++b;
+            }
+        }
+        rezultat.swap(interclasate);
+    }
+    return rezultat;
+}
+
+double AnaliticeImprumuturi::penalitati(TipUtilizator tip) const {
+    double total = 0;
+    for (const auto& shard : sumePenalitati) {
+        total += shard.suma[static_cast<size_t>(tip)].load(memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t AnaliticeImprumuturi::cititoriDistincti() const {
+    HyperLogLog reuniune;
+    for (const auto& shard : sharduri) {
+        const lock_guard<mutex> blocare(shard.mutexShard);
+        reuniune.combina(shard.cititori);
+    }
+    return static_cast<uint64_t>(llround(reuniune.estimeaza()));
+}
+
+uint64_t AnaliticeImprumuturi::cititoriDistinctiLuna(int32_t luna) const {
+    HyperLogLog reuniune(precizieLuna);
+    bool gasita = false;
+    for (const auto& shard : sharduri) {
+        const lock_guard<mutex> blocare(shard.mutexShard);
+        if (const auto it = shard.cititoriPeLuna.find(luna); it != shard.cititoriPeLuna.end()) {
+            reuniune.combina(it->second);
+            gasita = true;
+        }
+    }
+    return gasita ? static_cast<uint64_t>(llround(reuniune.estimeaza())) : 0;
+}
+
+uint64_t AnaliticeImprumuturi::numarImprumuturi() const {
+    uint64_t total = 0;
+    for (const auto& shard : sharduri) {
+        const lock_guard<mutex> blocare(shard.mutexShard);
+        total += shard.imprumuturi;
+    }
+    return total;
+}
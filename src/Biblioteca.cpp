@@ -0,0 +1,99 @@
+#include "Biblioteca.h"
+#include "Formatare.h"
+#include "Metrici.h"
+#include "Snapshot.h"
+
+#include <iostream>
+
+using namespace std;
+
+IdCarte BibliotecaSingleton::adaugaCarte(const shared_ptr<Carte>& carte) {
+    MASOARA_LATENTA(metrici.adaugaCarte);
+    const IdCarte id = catalog.adauga(*carte);
+    catalog.publica();
+    indexTitluri.adauga(id);
+    indexText.actualizeaza();
+    inventar.actualizeaza();
+    return id;
+}
+
+IdCarte BibliotecaSingleton::adaugaCarti(span<const RandCarte> randuri) {
+    const auto primul = static_cast<IdCarte>(catalog.size());
+    for (const auto& rand : randuri) {
+        catalog.adauga(rand);
+    }
+    catalog.publica(); // lotul e văzut întreg sau deloc
+    indexTitluri.adaugaLot(primul, static_cast<IdCarte>(catalog.size()));
+    inventar.actualizeaza();
+    return primul;
+}
+
+shared_ptr<ImprumutAbstract> BibliotecaSingleton::imprumuta(IdCarte id, Utilizator& utilizator, DataZi imprumut,
+                                                            DataZi returnare, IdImprumut idImprumut) {
+    const uint8_t exemplar = inventar.imprumuta(id, utilizator);
+    shared_ptr<ImprumutAbstract> rezultat;
+    try {
+        rezultat = ImprumutFactory::creareImprumut(catalog[id], utilizator, imprumut, returnare, idImprumut);
+    } catch (...) {
+        inventar.returneaza(id, exemplar, utilizator);
+        throw;
+    }
+    rezultat->seteazaExemplar(exemplar);
+    intarzieri.adauga(rezultat);
+    return rezultat;
+}
+
+bool BibliotecaSingleton::returneaza(ImprumutAbstract& imprumut) {
+    if (!imprumut.marcheazaReturnat()) {
+        return false;
+    }
+    inventar.returneaza(imprumut.getIdCarte(), imprumut.getExemplar(), imprumut.getUtilizator());
+    return true;
+}
+
+void BibliotecaSingleton::restaureazaImprumut(const shared_ptr<ImprumutAbstract>& imprumut, uint8_t exemplar, bool returnat) {
+    imprumut->seteazaExemplar(exemplar);
+    if (returnat) {
+        imprumut->marcheazaReturnat();
+    } else {
+        inventar.restaureaza(imprumut->getIdCarte(), exemplar, imprumut->getUtilizator());
+        intarzieri.restaureaza(imprumut);
+    }
+}
+
+void BibliotecaSingleton::afisareCarti() const {
+    // Un singur flux bufferizat pentru tot catalogul, golit doar la granița de bloc
+    IesireBufferata iesire(cout);
+    FormatatorText formatator;
+    for (const auto carte : catalog) {
+        formatator.carte(iesire, carte); // Afișare carte
+        iesire.scrieCaracter('\n');
+    }
+}
+
+void BibliotecaSingleton::salveaza(ScriitorSnapshot& snapshot) {
+    indexTitluri.compacteaza();
+    catalog.salveaza(snapshot);
+    indexTitluri.salveaza(snapshot);
+    const auto exemplare = inventar.exemplarePerCarte();
+    snapshot.scrieSectiune(Sectiune::CartiExemplare, span<const uint8_t>(exemplare));
+    const int32_t ceas = intarzieri.getData().getZile();
+    snapshot.scrieSectiune(Sectiune::IntarzieriCeas, span<const int32_t>(&ceas, 1));
+    const auto neraportate = intarzieri.getNeraportate();
+    snapshot.scrieSectiune(Sectiune::IntarzieriNeraportate, span<const uint64_t>(neraportate));
+}
+
+void BibliotecaSingleton::incarca(const CititorSnapshot& snapshot) {
+    catalog.incarca(snapshot);
+    catalog.publica();
+    indexTitluri.incarca(snapshot);
+    indexCatalog.reseteaza();
+    indexText.reseteaza();
+    inventar.incarca(snapshot.sectiune<uint8_t>(Sectiune::CartiExemplare));
+    // Înaintea împrumuturilor, ca cele deja raportate să nu fie raportate din nou
+    const auto ceas = snapshot.sectiune<int32_t>(Sectiune::IntarzieriCeas);
+    if (ceas.size() != 1) {
+        throw PersistentaException("Ceasul intarzierilor lipseste din snapshot");
+    }
+    intarzieri.restaureazaCeas(DataZi(ceas[0]), snapshot.sectiune<uint64_t>(Sectiune::IntarzieriNeraportate));
+}
@@ -0,0 +1,34 @@
+#include "Carte.h"
+#include "PoliticaPenalitati.h"
+
+#include <iostream>
+
+using namespace std;
+
+PoolInternare CarteDigitala::formate;
+
+void Carte::afisare() const {
+    cout << "Titlu: " << titlu << ", Autor: " << autor << ", An publicare: " << anPublicare << '\n';
+}
+
+double Carte::calculeazaPenalitate() const {
+    return TabelPenalitati::curent().rata(TipCarte::Generica, StareCarte::Buna, TipUtilizator::Student);
+}
+
+double CarteFizica::calculeazaPenalitate() const {
+    return TabelPenalitati::curent().rata(TipCarte::Fizica, stare, TipUtilizator::Student);
+}
+
+double CarteDigitala::calculeazaPenalitate() const {
+    return TabelPenalitati::curent().rata(TipCarte::Digitala, StareCarte::Buna, TipUtilizator::Student);
+}
+
+void CarteFizica::afisare() const {
+    Carte::afisare();
+    cout << "Numar pagini: " << numarPagini << ", Stare fizica: " << getStareFizica() << '\n';
+}
+
+void CarteDigitala::afisare() const {
+    Carte::afisare();
+    cout << "Dimensiune fisier: " << dimensiuneFisier << " MB, Format: " << getFormat() << '\n';
+}
@@ -0,0 +1,237 @@
+#include "CatalogCarti.h"
+#include "Formatare.h"
+#include "PoliticaPenalitati.h"
+#include "Snapshot.h"
+
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+string_view CarteView::getTitlu() const { return vedere->titluri[id]; }
+
+string_view CarteView::getAutor() const { return vedere->autori[vedere->idAutor[id]]; }
+
+int CarteView::getAnPublicare() const { return vedere->anPublicare[id]; }
+
+TipCarte CarteView::getTip() const { return vedere->tipuri[id]; }
+
+int CarteView::getNumarPagini() const { return vedere->numarPagini[id]; }
+
+float CarteView::getDimensiuneFisier() const { return vedere->dimensiuneFisier[id]; }
+
+string_view CarteView::getStareFizica() const {
+    return getTip() == TipCarte::Fizica ? vedere->detalii[vedere->idDetaliu[id]] : string_view{};
+}
+
+string_view CarteView::getFormat() const {
+    return getTip() == TipCarte::Digitala ? vedere->detalii[vedere->idDetaliu[id]] : string_view{};
+}
+
+StareCarte CarteView::getStare() const {
+    return getTip() == TipCarte::Fizica && vedere->idDetaliu[id] == vedere->idDetaliuUzata ? StareCarte::Uzata : StareCarte::Buna;
+}
+
+double CarteView::calculeazaPenalitate(TipUtilizator utilizator) const {
+    return TabelPenalitati::curent().rata(getTip(), getStare(), utilizator);
+}
+
+void CarteView::afisare() const {
+    IesireBufferata iesire(cout);
+    FormatatorText().carte(iesire, *this);
+}
+
+shared_ptr<Carte> CarteView::materializeaza() const {
+    const string titlu(getTitlu());
+    const string autor(getAutor());
+    switch (getTip()) {
+        case TipCarte::Fizica:
+            return make_shared<CarteFizica>(titlu, autor, getAnPublicare(), getNumarPagini(), string(getStareFizica()));
+        case TipCarte::Digitala:
+            return make_shared<CarteDigitala>(titlu, autor, getAnPublicare(), getDimensiuneFisier(), string(getFormat()));
+        default:
+            return make_shared<Carte>(titlu, autor, getAnPublicare());
+    }
+}
+
+namespace {
+
+VedereSiruri vedereSiruri(const ColoanaSiruri& siruri) {
+    return {siruri.getInceputuri().begin(), siruri.getCaractere().begin()};
+}
+
+} // namespace
+
+CatalogCarti::CatalogCarti() {
+    publica();
+}
+
+void CatalogCarti::actualizeazaVedere() {
+    vedere.titluri = vedereSiruri(titluri);
+    vedere.autori = vedereSiruri(autori.getValori());
+    vedere.detalii = vedereSiruri(detalii.getValori());
+    vedere.idAutor = idAutor.begin();
+    vedere.anPublicare = anPublicare.begin();
+    vedere.tipuri = tipuri.begin();
+    vedere.numarPagini = numarPagini.begin();
+    vedere.dimensiuneFisier = dimensiuneFisier.begin();
+    vedere.idDetaliu = idDetaliu.begin();
+    vedere.numar = tipuri.size();
+}
+
+void CatalogCarti::publica() {
+    // Bufferele de acum, în aceeași ordine ca în vedere; o coloană care crește după publicare trece
+    // într-un buffer nou, iar acesta rămâne la versiune
+    std::array<shared_ptr<const void>, VersiuneCatalog::numarBuffere> buffere = {
+        titluri.getInceputuri().getProprietar(), titluri.getCaractere().getProprietar(),
+        autori.getValori().getInceputuri().getProprietar(), autori.getValori().getCaractere().getProprietar(),
+        detalii.getValori().getInceputuri().getProprietar(), detalii.getValori().getCaractere().getProprietar(),
+        idAutor.getProprietar(), anPublicare.getProprietar(), tipuri.getProprietar(),
+        numarPagini.getProprietar(), dimensiuneFisier.getProprietar(), idDetaliu.getProprietar()};
+    auto noua = make_shared<const VersiuneCatalog>(vedere, std::move(buffere), ++versiuni);
+    const lock_guard<mutex> blocare(mutexVersiune);
+    // Versiunea veche e eliberată (dacă nu o mai ține nimeni) de destructorul lui `noua`, după blocare
+    versiunePublicata.swap(noua);
+}
+
+IdCarte CatalogCarti::adauga(const Carte& carte) {
+    RandCarte rand{carte.getTip(), carte.getTitlu(), carte.getAutor(), carte.getAnPublicare(), 0, 0, {}};
+    if (rand.tip == TipCarte::Fizica) {
+        const auto& fizica = static_cast<const CarteFizica&>(carte);
+        rand.numarPagini = fizica.getNumarPagini();
+        rand.detaliu = fizica.getStareFizica();
+    } else if (rand.tip == TipCarte::Digitala) {
+        const auto& digitala = static_cast<const CarteDigitala&>(carte);
+        rand.dimensiuneFisier = digitala.getDimensiuneFisier();
+        rand.detaliu = digitala.getFormat();
+    }
+    return adauga(rand);
+}
+
+IdCarte CatalogCarti::adauga(const RandCarte& rand) {
+    const auto id = static_cast<IdCarte>(size());
+    titluri.adauga(rand.titlu);
+    idAutor.push_back(autori.interneaza(rand.autor));
+    anPublicare.push_back(rand.anPublicare);
+    tipuri.push_back(rand.tip);
+    // Câmpurile care nu țin de tipul cărții rămân 0, la fel ca la adăugarea unui obiect Carte
+    numarPagini.push_back(rand.tip == TipCarte::Fizica ? rand.numarPagini : 0);
+    dimensiuneFisier.push_back(rand.tip == TipCarte::Digitala ? rand.dimensiuneFisier : 0);
+    switch (rand.tip) {
+        case TipCarte::Fizica: {
+            const StareCarte stare = stareDinText(rand.detaliu);
+            idDetaliu.push_back(detalii.interneaza(numeStare(stare)));
+            if (stare == StareCarte::Uzata) {
+                vedere.idDetaliuUzata = idDetaliu.back();
+            }
+            break;
+        }
+        case TipCarte::Digitala:
+            idDetaliu.push_back(detalii.interneaza(rand.detaliu));
+            break;
+        default:
+            idDetaliu.push_back(detalii.interneaza(string_view{}));
+            break;
+    }
+    actualizeazaVedere();
+    return id;
+}
+
+void CatalogCarti::rezerva(size_t numar) {
+    titluri.rezerva(numar, numar * 16);
+    idAutor.reserve(numar);
+    anPublicare.reserve(numar);
+    tipuri.reserve(numar);
+    numarPagini.reserve(numar);
+    dimensiuneFisier.reserve(numar);
+    idDetaliu.reserve(numar);
+    actualizeazaVedere();
+}
+
+optional<uint32_t> CatalogCarti::idAutorDupaNume(string_view autor) const {
+    const uint32_t* id = autori.cauta(autor);
+    return id ? optional(*id) : nullopt;
+}
+
+optional<uint32_t> CatalogCarti::idDetaliuDupaNume(string_view detaliu) const {
+    const uint32_t* id = detalii.cauta(detaliu);
+    return id ? optional(*id) : nullopt;
+}
+
+vector<IdCarte> CatalogCarti::cautaDupaAutor(string_view autor) const {
+    vector<IdCarte> rezultat;
+    const uint32_t* cautat = autori.cauta(autor);
+    if (!cautat) {
+        return rezultat;
+    }
+    const uint32_t idCautat = *cautat;
+    for (size_t i = 0; i < idAutor.size(); ++i) {
+        if (idAutor[i] == idCautat) {
+            rezultat.push_back(static_cast<IdCarte>(i));
+        }
+    }
+    return rezultat;
+}
+
+vector<IdCarte> CatalogCarti::cautaDupaAn(int anMinim, int anMaxim) const {
+    vector<IdCarte> rezultat;
+    for (size_t i = 0; i < anPublicare.size(); ++i) {
+        if (anPublicare[i] >= anMinim && anPublicare[i] <= anMaxim) {
+            rezultat.push_back(static_cast<IdCarte>(i));
+        }
+    }
+    return rezultat;
+}
+
+size_t CatalogCarti::memorieOcupata() const {
+    return titluri.memorieOcupata() + autori.memorieOcupata() + detalii.memorieOcupata()
+         + idAutor.memorieOcupata() + anPublicare.memorieOcupata() + tipuri.memorieOcupata()
+         + numarPagini.memorieOcupata() + dimensiuneFisier.memorieOcupata() + idDetaliu.memorieOcupata();
+}
+
+void CatalogCarti::salveaza(ScriitorSnapshot& snapshot) const {
+    snapshot.scrieSectiune(Sectiune::CartiTip, tipuri);
+    snapshot.scrieSectiune(Sectiune::CartiAn, anPublicare);
+    snapshot.scrieSectiune(Sectiune::CartiPagini, numarPagini);
+    snapshot.scrieSectiune(Sectiune::CartiDimensiune, dimensiuneFisier);
+    snapshot.scrieSectiune(Sectiune::CartiAutor, idAutor);
+    snapshot.scrieSectiune(Sectiune::CartiDetaliu, idDetaliu);
+    snapshot.scrieSectiune(Sectiune::TitluriInceputuri, titluri.getInceputuri());
+    snapshot.scrieSectiune(Sectiune::TitluriCaractere, titluri.getCaractere());
+    snapshot.scrieSectiune(Sectiune::AutoriInceputuri, autori.getValori().getInceputuri());
+    snapshot.scrieSectiune(Sectiune::AutoriCaractere, autori.getValori().getCaractere());
+    snapshot.scrieSectiune(Sectiune::DetaliiInceputuri, detalii.getValori().getInceputuri());
+    snapshot.scrieSectiune(Sectiune::DetaliiCaractere, detalii.getValori().getCaractere());
+}
+
+void CatalogCarti::incarca(const CititorSnapshot& snapshot) {
+    snapshot.mapeaza(Sectiune::CartiTip, tipuri);
+    snapshot.mapeaza(Sectiune::CartiAn, anPublicare);
+    snapshot.mapeaza(Sectiune::CartiPagini, numarPagini);
+    snapshot.mapeaza(Sectiune::CartiDimensiune, dimensiuneFisier);
+    snapshot.mapeaza(Sectiune::CartiAutor, idAutor);
+    snapshot.mapeaza(Sectiune::CartiDetaliu, idDetaliu);
+    titluri.mapeaza(snapshot.sectiune<uint64_t>(Sectiune::TitluriInceputuri), snapshot.sectiune<char>(Sectiune::TitluriCaractere),
+                    snapshot.getFisier());
+    autori.mapeaza(snapshot.sectiune<uint64_t>(Sectiune::AutoriInceputuri), snapshot.sectiune<char>(Sectiune::AutoriCaractere),
+                   snapshot.getFisier());
+    detalii.mapeaza(snapshot.sectiune<uint64_t>(Sectiune::DetaliiInceputuri), snapshot.sectiune<char>(Sectiune::DetaliiCaractere),
+                    snapshot.getFisier());
+
+    const size_t numar = tipuri.size();
+    if (anPublicare.size() != numar || numarPagini.size() != numar || dimensiuneFisier.size() != numar
+        || idAutor.size() != numar || idDetaliu.size() != numar || titluri.size() != numar) {
+        throw PersistentaException("Coloane de lungimi diferite in snapshot");
+    }
+    // Id-urile din pool-uri sunt folosite ca indici, fără alte verificări, la fiecare citire
+    const size_t numarAutori = autori.size();
+    const size_t numarDetalii = detalii.size();
+    for (size_t i = 0; i < numar; ++i) {
+        if (idAutor[i] >= numarAutori || idDetaliu[i] >= numarDetalii) {
+            throw PersistentaException("Referinta invalida la autor sau detaliu in snapshot");
+        }
+    }
+
+    vedere.idDetaliuUzata = idDetaliuDupaNume(numeStare(StareCarte::Uzata)).value_or(faraDetaliu);
+    actualizeazaVedere();
+}
@@ -0,0 +1,63 @@
+#include "ColoanaSiruri.h"
+#include "Exceptii.h"
+
+using namespace std;
+
+uint32_t ColoanaSiruri::adauga(string_view sir) {
+    if (inceputuri.empty()) {
+        inceputuri.push_back(0);
+    }
+    const auto id = static_cast<uint32_t>(size());
+    caractere.extinde(sir);
+    inceputuri.push_back(caractere.size());
+    return id;
+}
+
+void ColoanaSiruri::rezerva(size_t numar, size_t numarCaractere) {
+    inceputuri.reserve(numar + 1);
+    caractere.reserve(numarCaractere);
+}
+
+void ColoanaSiruri::mapeaza(span<const uint64_t> inceputuriMapate, span<const char> caractereMapate,
+                            const shared_ptr<const void>& proprietar) {
+    if (!inceputuriMapate.empty() && inceputuriMapate.front() != 0) {
+        throw PersistentaException("Siruri invalide in snapshot");
+    }
+    for (size_t i = 1; i < inceputuriMapate.size(); ++i) {
+        if (inceputuriMapate[i] < inceputuriMapate[i - 1]) {
+            throw PersistentaException("Siruri invalide in snapshot");
+        }
+    }
+    if (!inceputuriMapate.empty() && inceputuriMapate.back() > caractereMapate.size()) {
+        throw PersistentaException("Siruri invalide in snapshot");
+    }
+    inceputuri.mapeaza(inceputuriMapate, proprietar);
+    caractere.mapeaza(caractereMapate, proprietar);
+}
+
+void PoolSiruri::reindexeaza() {
+    iduri.clear();
+    iduri.reserve(valori.size());
+    for (uint32_t id = 0; id < valori.size(); ++id) {
+        iduri.insert(id);
+    }
+}
+
+uint32_t PoolSiruri::interneaza(string_view sir) {
+    auto it = iduri.find(sir);
+    if (it != iduri.end()) {
+        return *it;
+    }
+    const uint32_t id = valori.adauga(sir);
+    iduri.insert(id);
+    return id;
+}
+
+void PoolSiruri::mapeaza(span<const uint64_t> inceputuri, span<const char> caractere, const shared_ptr<const void>& proprietar) {
+    valori.mapeaza(inceputuri, caractere, proprietar);
+    reindexeaza();
+}
+
+size_t PoolSiruri::memorieOcupata() const {
+    return valori.memorieOcupata() + iduri.size() * (sizeof(uint32_t) + 2 * sizeof(void*));
+}
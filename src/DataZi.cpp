@@ -0,0 +1,103 @@
+#include "DataZi.h"
+#include "Exceptii.h"
+
+#include <ostream>
+
+using namespace std;
+
+namespace {
+
+constexpr bool esteAnBisect(int an) {
+    return an % 4 == 0 && (an % 100 != 0 || an % 400 == 0);
+}
+
+constexpr unsigned zileInLuna(int an, unsigned luna) {
+    constexpr unsigned zile[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    return luna == 2 && esteAnBisect(an) ? 29 : zile[luna - 1];
+}
+
+bool citesteCifre(string_view text, size_t pozitie, size_t numar, unsigned& valoare) {
+    valoare = 0;
+    for (size_t i = pozitie; i < pozitie + numar; ++i) {
+        const auto cifra = static_cast<unsigned>(text[i] - '0');
+        if (cifra > 9) {
+            return false;
+        }
+        valoare = valoare * 10 + cifra;
+    }
+    return true;
+}
+
+struct ZiCalendar {
+    unsigned an;
+    unsigned luna;
+    unsigned zi;
+};
+
+// civil_from_days, inversul lui dinCalendar
+ZiCalendar dinZile(int32_t zile) {
+    const int z = zile + 719468;
+    const int era = (z >= 0 ? z : z - 146096) / 146097;
+    const auto ziInEra = static_cast<unsigned>(z - era * 146097);
+    const unsigned anInEra = (ziInEra - ziInEra / 1460 + ziInEra / 36524 - ziInEra / 146096) / 365;
+    const unsigned ziInAn = ziInEra - (365 * anInEra + anInEra / 4 - anInEra / 100);
+    const unsigned mp = (5 * ziInAn + 2) / 153;
+    const unsigned zi = ziInAn - (153 * mp + 2) / 5 + 1;
+    const unsigned luna = mp < 10 ? mp + 3 : mp - 9;
+    const auto an = static_cast<unsigned>(static_cast<int>(anInEra) + era * 400 + (luna <= 2));
+    return {an, luna, zi};
+}
+
+} // namespace
+
+optional<DataZi> DataZi::parseaza(string_view text) {
+    if (text.size() != 10 || text[4] != '-' || text[7] != '-') {
+        return nullopt;
+    }
+    unsigned an = 0, luna = 0, zi = 0;
+    if (!citesteCifre(text, 0, 4, an) || !citesteCifre(text, 5, 2, luna) || !citesteCifre(text, 8, 2, zi)) {
+        return nullopt;
+    }
+    if (luna < 1 || luna > 12 || zi < 1 || zi > zileInLuna(static_cast<int>(an), luna)) {
+        return nullopt;
+    }
+    return dinCalendar(static_cast<int>(an), luna, zi);
+}
+
+DataZi DataZi::parseazaSauArunca(string_view text) {
+    if (auto data = parseaza(text)) {
+        return *data;
+    }
+    throw ImprumutException("Data invalida (format asteptat YYYY-MM-DD): " + string(text));
+}
+
+void DataZi::scrie(char* destinatie) const {
+    const auto [an, luna, zi] = dinZile(zile);
+    destinatie[0] = static_cast<char>('0' + an / 1000 % 10);
+    destinatie[1] = static_cast<char>('0' + an / 100 % 10);
+    destinatie[2] = static_cast<char>('0' + an / 10 % 10);
+    destinatie[3] = static_cast<char>('0' + an % 10);
+    destinatie[4] = '-';
+    destinatie[5] = static_cast<char>('0' + luna / 10);
+    destinatie[6] = static_cast<char>('0' + luna % 10);
+    destinatie[7] = '-';
+    destinatie[8] = static_cast<char>('0' + zi / 10);
+    destinatie[9] = static_cast<char>('0' + zi % 10);
+}
+
+int32_t DataZi::getIndexLuna() const {
+    const auto calendar = dinZile(zile);
+    return static_cast<int32_t>(calendar.an) * 12 + static_cast<int32_t>(calendar.luna) - 1;
+}
+
+string DataZi::toString() const {
+    string text(10, '0');
+    scrie(text.data());
+    return text;
+}
+
+ostream& operator<<(ostream& os, DataZi data) {
+    char text[10];
+    data.scrie(text);
+    return os.write(text, sizeof(text));
+}
@@ -0,0 +1,63 @@
+#include "FisierMapat.h"
+#include "Exceptii.h"
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+#ifdef _WIN32
+
+FisierMapat::FisierMapat(const string& cale) {
+    ifstream fisier(cale, ios::binary | ios::ate);
+    if (!fisier) {
+        throw PersistentaException("Nu pot deschide " + cale);
+    }
+    dimensiune = static_cast<size_t>(fisier.tellg());
+    buffer = make_unique<byte[]>(dimensiune);
+    fisier.seekg(0);
+    if (!fisier.read(reinterpret_cast<char*>(buffer.get()), static_cast<streamsize>(dimensiune))) {
+        throw PersistentaException("Nu pot citi " + cale);
+    }
+    date = buffer.get();
+}
+
+FisierMapat::~FisierMapat() = default;
+
+#else
+
+FisierMapat::FisierMapat(const string& cale) {
+    const int fd = open(cale.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw PersistentaException("Nu pot deschide " + cale);
+    }
+    struct stat informatii {};
+    if (fstat(fd, &informatii) != 0) {
+        close(fd);
+        throw PersistentaException("Nu pot citi dimensiunea lui " + cale);
+    }
+    dimensiune = static_cast<size_t>(informatii.st_size);
+    if (dimensiune > 0) {
+        void* adresa = mmap(nullptr, dimensiune, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (adresa == MAP_FAILED) {
+            close(fd);
+            throw PersistentaException("mmap a esuat pentru " + cale);
+        }
+        date = static_cast<const byte*>(adresa);
+    }
+    close(fd); // maparea rămâne validă și după închiderea descriptorului
+}
+
+FisierMapat::~FisierMapat() {
+    if (date) {
+        munmap(const_cast<byte*>(date), dimensiune);
+    }
+}
+
+#endif
@@ -0,0 +1,418 @@
+#include "Formatare.h"
+
+#include <algorithm>
+#include <charconv>
+#include <ostream>
+
+using namespace std;
+
+namespace {
+
+string_view numeTip(TipCarte tip) {
+    switch (tip) {
+        case TipCarte::Fizica:
+            return "Fizica";
+        case TipCarte::Digitala:
+            return "Digitala";
+        default:
+            return "Generica";
+    }
+}
+
+// Câmp CSV: între ghilimele doar dacă e nevoie, cu ghilimelele interioare dublate
+void scrieCampCsv(IesireBufferata& iesire, string_view camp) {
+    if (none_of(camp.begin(), camp.end(), [](char c) { return c == ',' || c == '"' || c == '\r' || c == '\n'; })) {
+        iesire.scrie(camp);
+        return;
+    }
+    iesire.scrieCaracter('"');
+    for (size_t inceput = 0;;) {
+        const size_t ghilimele = camp.find('"', inceput);
+        iesire.scrie(camp.substr(inceput, ghilimele - inceput));
+        if (ghilimele == string_view::npos) {
+            break;
+        }
+        iesire.scrie("\"\"");
+        inceput = ghilimele + 1;
+    }
+    iesire.scrieCaracter('"');
+}
+
+void scrieSirJson(IesireBufferata& iesire, string_view sir) {
+    static constexpr char hex[] = "0123456789abcdef";
+    iesire.scrieCaracter('"');
+    size_t inceput = 0;
+    for (size_t i = 0; i < sir.size(); ++i) {
+        const auto c = static_cast<unsigned char>(sir[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue; // octeții UTF-8 trec neschimbați
+        }
+        iesire.scrie(sir.substr(inceput, i - inceput));
+        inceput = i + 1;
+        switch (c) {
+            case '"': iesire.scrie("\\\""); break;
+            case '\\': iesire.scrie("\\\\"); break;
+            case '\n': iesire.scrie("\\n"); break;
+            case '\r': iesire.scrie("\\r"); break;
+            case '\t': iesire.scrie("\\t"); break;
+            default:
+                iesire.scrie("\\u00");
+                iesire.scrieCaracter(hex[c >> 4]);
+                iesire.scrieCaracter(hex[c & 15]);
+        }
+    }
+    iesire.scrie(sir.substr(inceput));
+    iesire.scrieCaracter('"');
+}
+
+// ,"cheie":
+void scrieCheieJson(IesireBufferata& iesire, string_view cheie, bool prima = false) {
+    if (!prima) {
+        iesire.scrieCaracter(',');
+    }
+    iesire.scrieCaracter('"');
+    iesire.scrie(cheie);
+    iesire.scrie("\":");
+}
+
+} // namespace
+
+IesireBufferata::IesireBufferata(ostream& destinatie, size_t dimensiuneBloc)
+    : flux(&destinatie), bloc(max<size_t>(dimensiuneBloc, 64)) {}
+
+IesireBufferata::IesireBufferata(string& destinatie, size_t dimensiuneBloc)
+    : sir(&destinatie), bloc(max<size_t>(dimensiuneBloc, 64)) {}
+
+IesireBufferata::~IesireBufferata() {
+    goleste();
+}
+
+void IesireBufferata::trimiteBloc() {
+    if (folosit == 0) {
+        return;
+    }
+    if (flux) {
+        flux->write(bloc.data(), static_cast<streamsize>(folosit));
+    } else {
+        sir->append(bloc.data(), folosit);
+    }
+    folosit = 0;
+}
+
+void IesireBufferata::scrie(string_view text) {
+    if (text.size() > bloc.size() - folosit) {
+        trimiteBloc();
+        if (text.size() > bloc.size()) {
+            // Textele mai mari decât blocul merg direct, fără copie intermediară
+            if (flux) {
+                flux->write(text.data(), static_cast<streamsize>(text.size()));
+            } else {
+                sir->append(text);
+            }
+            return;
+        }
+    }
+    copy(text.begin(), text.end(), bloc.data() + folosit);
+    folosit += text.size();
+}
+
+void IesireBufferata::scrieCaracter(char c) {
+    if (folosit == bloc.size()) {
+        trimiteBloc();
+    }
+    bloc[folosit++] = c;
+}
+
+void IesireBufferata::scrieIntreg(int64_t valoare) {
+    char text[24];
+    const auto rezultat = to_chars(begin(text), end(text), valoare);
+    scrie({text, static_cast<size_t>(rezultat.ptr - text)});
+}
+
+void IesireBufferata::scrieReal(double valoare) {
+    char text[32];
+    const auto rezultat = to_chars(begin(text), end(text), valoare, chars_format::general, 6);
+    scrie({text, static_cast<size_t>(rezultat.ptr - text)});
+}
+
+void IesireBufferata::scrieData(DataZi data) {
+    char text[10];
+    data.scrie(text);
+    scrie({text, sizeof(text)});
+}
+
+void IesireBufferata::goleste() {
+    trimiteBloc();
+    if (flux) {
+        flux->flush();
+    }
+}
+
+optional<FormatListare> formatListareDinNume(string_view nume) {
+    if (nume == "text") {
+        return FormatListare::Text;
+    }
+    if (nume == "csv") {
+        return FormatListare::Csv;
+    }
+    if (nume == "json") {
+        return FormatListare::Json;
+    }
+    return nullopt;
+}
+
+unique_ptr<Formatator> Formatator::creeaza(FormatListare format) {
+    switch (format) {
+        case FormatListare::Csv:
+            return make_unique<FormatatorCsv>();
+        case FormatListare::Json:
+            return make_unique<FormatatorJson>();
+        default:
+            return make_unique<FormatatorText>();
+    }
+}
+
+// ------------------- Text -------------------
+
+void FormatatorText::carte(IesireBufferata& iesire, const CarteView& carte) {
+    iesire.scrie("Titlu: ");
+    iesire.scrie(carte.getTitlu());
+    iesire.scrie(", Autor: ");
+    iesire.scrie(carte.getAutor());
+    iesire.scrie(", An publicare: ");
+    iesire.scrieIntreg(carte.getAnPublicare());
+    iesire.scrieCaracter('\n');
+    if (carte.getTip() == TipCarte::Fizica) {
+        iesire.scrie("Numar pagini: ");
+        iesire.scrieIntreg(carte.getNumarPagini());
+        iesire.scrie(", Stare fizica: ");
+        iesire.scrie(carte.getStareFizica());
+        iesire.scrieCaracter('\n');
+    } else if (carte.getTip() == TipCarte::Digitala) {
+        iesire.scrie("Dimensiune fisier: ");
+        iesire.scrieReal(carte.getDimensiuneFisier());
+        iesire.scrie(" MB, Format: ");
+        iesire.scrie(carte.getFormat());
+        iesire.scrieCaracter('\n');
+    }
+}
+
+void FormatatorText::utilizator(IesireBufferata& iesire, const Utilizator& utilizator) {
+    iesire.scrie("Nume: ");
+    iesire.scrie(utilizator.getNume());
+    iesire.scrie(", Email: ");
+    iesire.scrie(utilizator.getEmail());
+    iesire.scrie(", Tip utilizator: ");
+    iesire.scrie(utilizator.getTipUtilizator());
+    iesire.scrie(", Penalitati: ");
+    iesire.scrieReal(utilizator.getPenalizari());
+    iesire.scrie(" RON\n");
+    iesire.scrie(utilizator.getTip() == TipUtilizator::Student ? "Facultate: " : "Departament: ");
+    iesire.scrie(utilizator.getFacultateDepartament());
+    iesire.scrieCaracter('\n');
+}
+
+void FormatatorText::inceputIstoric(IesireBufferata& iesire, const Utilizator& utilizator) {
+    iesire.scrie("Istoricul imprumuturilor pentru ");
+    iesire.scrie(utilizator.getNume());
+    iesire.scrie(":\n");
+}
+
+void FormatatorText::intrareIstoric(IesireBufferata& iesire, const Utilizator&, const IstoricImprumut& imprumut,
+                                    const CatalogCarti& catalog) {
+    iesire.scrie("Titlu: ");
+    iesire.scrie(catalog.titlu(imprumut.idCarte));
+    iesire.scrie(", Data imprumut: ");
+    iesire.scrieData(imprumut.dataImprumut);
+    iesire.scrie(", Data returnare: ");
+    iesire.scrieData(imprumut.dataReturnare);
+    iesire.scrieCaracter('\n');
+}
+
+// ------------------- CSV -------------------
+
+void FormatatorCsv::inceputCarti(IesireBufferata& iesire) {
+    iesire.scrie("tip,titlu,autor,anPublicare,numarPagini,stareFizica,dimensiuneFisier,format\n");
+}
+
+void FormatatorCsv::carte(IesireBufferata& iesire, const CarteView& carte) {
+    iesire.scrie(numeTip(carte.getTip()));
+    iesire.scrieCaracter(',');
+    scrieCampCsv(iesire, carte.getTitlu());
+    iesire.scrieCaracter(',');
+    scrieCampCsv(iesire, carte.getAutor());
+    iesire.scrieCaracter(',');
+    iesire.scrieIntreg(carte.getAnPublicare());
+    iesire.scrieCaracter(',');
+    if (carte.getTip() == TipCarte::Fizica) {
+        iesire.scrieIntreg(carte.getNumarPagini());
+        iesire.scrieCaracter(',');
+        scrieCampCsv(iesire, carte.getStareFizica());
+        iesire.scrie(",,\n");
+    } else if (carte.getTip() == TipCarte::Digitala) {
+        iesire.scrie(",,");
+        iesire.scrieReal(carte.getDimensiuneFisier());
+        iesire.scrieCaracter(',');
+        scrieCampCsv(iesire, carte.getFormat());
+        iesire.scrieCaracter('\n');
+    } else {
+        iesire.scrie(",,,\n");
+    }
+}
+
+void FormatatorCsv::inceputUtilizatori(IesireBufferata& iesire) {
+    iesire.scrie("tip,nume,email,facultateDepartament,penalizari\n");
+}
+
+void FormatatorCsv::utilizator(IesireBufferata& iesire, const Utilizator& utilizator) {
+    scrieCampCsv(iesire, utilizator.getTipUtilizator());
+    iesire.scrieCaracter(',');
+    scrieCampCsv(iesire, utilizator.getNume());
+    iesire.scrieCaracter(',');
+    scrieCampCsv(iesire, utilizator.getEmail());
+    iesire.scrieCaracter(',');
+    scrieCampCsv(iesire, utilizator.getFacultateDepartament());
+    iesire.scrieCaracter(',');
+    iesire.scrieReal(utilizator.getPenalizari());
+    iesire.scrieCaracter('\n');
+}
+
+void FormatatorCsv::inceputIstoric(IesireBufferata& iesire, const Utilizator&) {
+    iesire.scrie("email,titlu,dataImprumut,dataReturnare\n");
+}
+
+void FormatatorCsv::intrareIstoric(IesireBufferata& iesire, const Utilizator& utilizator, const IstoricImprumut& imprumut,
+                                   const CatalogCarti& catalog) {
+    scrieCampCsv(iesire, utilizator.getEmail());
+    iesire.scrieCaracter(',');
+    scrieCampCsv(iesire, catalog.titlu(imprumut.idCarte));
+    iesire.scrieCaracter(',');
+    iesire.scrieData(imprumut.dataImprumut);
+    iesire.scrieCaracter(',');
+    iesire.scrieData(imprumut.dataReturnare);
+    iesire.scrieCaracter('\n');
+}
+
+// ------------------- JSON -------------------
+
+void FormatatorJson::inceputObiect(IesireBufferata& iesire) {
+    iesire.scrie(primul ? "\n{" : ",\n{");
+    primul = false;
+}
+
+void FormatatorJson::inceputCarti(IesireBufferata& iesire) {
+    primul = true;
+    iesire.scrieCaracter('[');
+}
+
+void FormatatorJson::carte(IesireBufferata& iesire, const CarteView& carte) {
+    inceputObiect(iesire);
+    scrieCheieJson(iesire, "tip", true);
+    scrieSirJson(iesire, numeTip(carte.getTip()));
+    scrieCheieJson(iesire, "titlu");
+    scrieSirJson(iesire, carte.getTitlu());
+    scrieCheieJson(iesire, "autor");
+    scrieSirJson(iesire, carte.getAutor());
+    scrieCheieJson(iesire, "anPublicare");
+    iesire.scrieIntreg(carte.getAnPublicare());
+    if (carte.getTip() == TipCarte::Fizica) {
+        scrieCheieJson(iesire, "numarPagini");
+        iesire.scrieIntreg(carte.getNumarPagini());
+        scrieCheieJson(iesire, "stareFizica");
+        scrieSirJson(iesire, carte.getStareFizica());
+    } else if (carte.getTip() == TipCarte::Digitala) {
+        scrieCheieJson(iesire, "dimensiuneFisier");
+        iesire.scrieReal(carte.getDimensiuneFisier());
+        scrieCheieJson(iesire, "format");
+        scrieSirJson(iesire, carte.getFormat());
+    }
+    iesire.scrieCaracter('}');
+}
+
+void FormatatorJson::inceputUtilizatori(IesireBufferata& iesire) {
+    primul = true;
+    iesire.scrieCaracter('[');
+}
+
+void FormatatorJson::utilizator(IesireBufferata& iesire, const Utilizator& utilizator) {
+    inceputObiect(iesire);
+    scrieCheieJson(iesire, "tip", true);
+    scrieSirJson(iesire, utilizator.getTipUtilizator());
+    scrieCheieJson(iesire, "nume");
+    scrieSirJson(iesire, utilizator.getNume());
+    scrieCheieJson(iesire, "email");
+    scrieSirJson(iesire, utilizator.getEmail());
+    scrieCheieJson(iesire, "facultateDepartament");
+    scrieSirJson(iesire, utilizator.getFacultateDepartament());
+    scrieCheieJson(iesire, "penalizari");
+    iesire.scrieReal(utilizator.getPenalizari());
+    iesire.scrieCaracter('}');
+}
+
+void FormatatorJson::inceputIstoric(IesireBufferata& iesire, const Utilizator&) {
+    primul = true;
+    iesire.scrieCaracter('[');
+}
+
+void FormatatorJson::intrareIstoric(IesireBufferata& iesire, const Utilizator& utilizator, const IstoricImprumut& imprumut,
+                                    const CatalogCarti& catalog) {
+    inceputObiect(iesire);
+    scrieCheieJson(iesire, "email", true);
+    scrieSirJson(iesire, utilizator.getEmail());
+    scrieCheieJson(iesire, "titlu");
+    scrieSirJson(iesire, catalog.titlu(imprumut.idCarte));
+    scrieCheieJson(iesire, "dataImprumut");
+    iesire.scrieCaracter('"');
+    iesire.scrieData(imprumut.dataImprumut);
+    scrieCheieJson(iesire, "dataReturnare");
+    iesire.scrieCaracter('"');
+    iesire.scrieData(imprumut.dataReturnare);
+    iesire.scrie("\"}");
+}
+
+void FormatatorJson::sfarsitLista(IesireBufferata& iesire) {
+    iesire.scrie(primul ? "]\n" : "\n]\n");
+}
+
+// ------------------- Cursoare -------------------
+
+bool CursorListare::scrieBucata(size_t numarRanduri) {
+    if (!deschis) {
+        deschide();
+        deschis = true;
+    } else if (pozitie == total) {
+        return false;
+    }
+    const size_t sfarsit = min(total, pozitie + numarRanduri);
+    for (; pozitie < sfarsit; ++pozitie) {
+        scrieElement(pozitie);
+    }
+    if (pozitie == total) {
+        formatator.sfarsitLista(iesire);
+    }
+    iesire.goleste();
+    return pozitie < total;
+}
+
+void CursorListare::scrieTot(size_t numarRanduri) {
+    while (scrieBucata(numarRanduri)) {
+    }
+}
+
+void CursorIstoric::scrieElement(size_t index) {
+    if (index < inceputPagina || index - inceputPagina >= pagina.size()) {
+        pagina.clear();
+        inceputPagina = index;
+        utilizator.getIstoric().citeste(inceput + index, dimensiunePagina, pagina);
+    }
+    formatator.intrareIstoric(iesire, utilizator, pagina[index - inceputPagina], catalog);
+}
+
+void scrieUtilizatori(span<const shared_ptr<Utilizator>> utilizatori, Formatator& formatator, IesireBufferata& iesire) {
+    formatator.inceputUtilizatori(iesire);
+    for (const auto& utilizator : utilizatori) {
+        formatator.utilizator(iesire, *utilizator);
+    }
+    formatator.sfarsitLista(iesire);
+    iesire.goleste();
+}
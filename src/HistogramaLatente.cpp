@@ -0,0 +1,68 @@
+#include "HistogramaLatente.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+using namespace std;
+
+// Gălețile sunt închise la dreapta, (limita găleții anterioare, limitaSuperioara]: valorile se așază
+// cu una mai jos, ca fiecare putere a lui 2 să fie marginea de sus a unei găleți
+size_t HistogramaLatente::galeata(uint64_t nanosecunde) {
+    nanosecunde -= nanosecunde != 0;
+    if (nanosecunde < subgaleti) {
+        return static_cast<size_t>(nanosecunde);
+    }
+    // Exponentul alege grupa, următorii 4 biți de după bitul de sus aleg găleata din grupă
+    const unsigned exponent = static_cast<unsigned>(bit_width(nanosecunde)) - 1;
+    const auto sub = static_cast<size_t>((nanosecunde >> (exponent - 4)) & (subgaleti - 1));
+    return (exponent - 3) * subgaleti + sub;
+}
+
+uint64_t HistogramaLatente::limitaSuperioara(size_t galeata) {
+    if (galeata < subgaleti) {
+        return galeata + 1;
+    }
+    const unsigned exponent = static_cast<unsigned>(galeata / subgaleti) + 3;
+    const uint64_t inceput = (subgaleti + galeata % subgaleti) << (exponent - 4);
+    const uint64_t ultima = inceput + ((uint64_t{1} << (exponent - 4)) - 1);
+    return ultima == UINT64_MAX ? ultima : ultima + 1;
+}
+
+void HistogramaLatente::inregistreaza(uint64_t nanosecunde) {
+    galeti[galeata(nanosecunde)].fetch_add(1, memory_order_relaxed);
+    numar.fetch_add(1, memory_order_relaxed);
+    suma.fetch_add(nanosecunde, memory_order_relaxed);
+    uint64_t curent = maxim.load(memory_order_relaxed);
+    while (nanosecunde > curent && !maxim.compare_exchange_weak(curent, nanosecunde, memory_order_relaxed)) {
+    }
+}
+
+uint64_t HistogramaLatente::percentila(double p) const {
+    const uint64_t total = getNumar();
+    if (total == 0) {
+        return 0;
+    }
+    const auto tinta = max<uint64_t>(1, static_cast<uint64_t>(ceil(p * static_cast<double>(total))));
+    uint64_t cumulat = 0;
+    for (size_t i = 0; i < numarGaleti; ++i) {
+        cumulat += galeti[i].load(memory_order_relaxed);
+        if (cumulat >= tinta) {
+            return min(limitaSuperioara(i), getMaxim());
+        }
+    }
+    return getMaxim();
+}
+
+double HistogramaLatente::medie() const {
+    const uint64_t total = getNumar();
+    return total == 0 ? 0 : static_cast<double>(suma.load(memory_order_relaxed)) / static_cast<double>(total);
+}
+
+uint64_t HistogramaLatente::numarCelMult(uint64_t limita) const {
+    uint64_t rezultat = 0;
+    for (size_t i = 0; i < numarGaleti && limitaSuperioara(i) <= limita; ++i) {
+        rezultat += galeti[i].load(memory_order_relaxed);
+    }
+    return rezultat;
+}
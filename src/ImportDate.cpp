@@ -0,0 +1,640 @@
+#include "ImportDate.h"
+#include "DataZi.h"
+#include "Exceptii.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+using namespace std;
+
+namespace {
+
+constexpr size_t maximColoane = 8;
+
+// Numele coloanelor unui tip de import; primele `obligatorii` trebuie să apară în antetul CSV
+struct Schema {
+    array<string_view, maximColoane> nume;
+    size_t numar;
+    size_t obligatorii;
+};
+
+constexpr Schema schemaCarti{{"tip", "titlu", "autor", "anPublicare", "numarPagini", "stareFizica", "dimensiuneFisier", "format"}, 8, 4};
+constexpr Schema schemaUtilizatori{{"tip", "nume", "email", "facultateDepartament"}, 4, 4};
+constexpr Schema schemaImprumuturi{{"email", "titlu", "dataImprumut", "dataReturnare"}, 4, 4};
+
+int indexColoana(const Schema& schema, string_view nume) {
+    for (size_t i = 0; i < schema.numar; ++i) {
+        if (schema.nume[i] == nume) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+// Valorile unui rând, în ordinea schemei; coloanele lipsă rămân goale
+using Campuri = array<string_view, maximColoane>;
+
+struct Linie {
+    char* inceput;
+    char* sfarsit;
+    size_t numar;
+};
+
+// ------------------- CITIRE PE BLOCURI -------------------
+class CititorBlocuri {
+private:
+    FILE* fisier;
+    vector<char> buffer;
+    size_t ocupat = 0;      // octeți valizi în buffer
+    size_t consumat = 0;    // octeți din liniile deja întoarse
+    size_t numarLinie = 0;
+    bool terminat = false;
+    bool primulBloc = true;
+
+public:
+    CititorBlocuri(const string& cale, size_t dimensiuneBloc) : fisier(fopen(cale.c_str(), "rb")), buffer(dimensiuneBloc) {
+        if (!fisier) {
+            throw ImportException("Nu pot deschide " + cale);
+        }
+    }
+
+    ~CititorBlocuri() { fclose(fisier); }
+
+    CititorBlocuri(const CititorBlocuri&) = delete;
+    CititorBlocuri& operator=(const CititorBlocuri&) = delete;
+
+    // Liniile complete din blocul următor; liniile anterioare devin invalide. false la sfârșitul fișierului
+    bool urmatorul(vector<Linie>& linii) {
+        linii.clear();
+        // Restul unei linii neterminate trece la începutul buffer-ului
+        memmove(buffer.data(), buffer.data() + consumat, ocupat - consumat);
+        ocupat -= consumat;
+        consumat = 0;
+
+        while (linii.empty()) {
+            if (terminat && ocupat == 0) {
+                return false;
+            }
+            if (!terminat) {
+                if (ocupat == buffer.size()) {
+                    buffer.resize(buffer.size() * 2); // linie mai lungă decât un bloc
+                }
+                ocupat += fread(buffer.data() + ocupat, 1, buffer.size() - ocupat, fisier);
+                terminat = feof(fisier) || ferror(fisier);
+            }
+
+            char* inceput = buffer.data();
+            char* const capat = buffer.data() + ocupat;
+            if (primulBloc && ocupat >= 3 && memcmp(inceput, "\xEF\xBB\xBF", 3) == 0) {
+                inceput += 3; // BOM UTF-8
+            }
+            primulBloc = false;
+
+            while (inceput < capat) {
+                auto* sfarsit = static_cast<char*>(memchr(inceput, '\n', static_cast<size_t>(capat - inceput)));
+                if (!sfarsit) {
+                    if (!terminat) {
+                        break; // linie neterminată: așteaptă blocul următor
+                    }
+                    sfarsit = capat; // ultima linie fără '\n'
+                }
+                char* sfarsitText = sfarsit;
+                if (sfarsitText > inceput && sfarsitText[-1] == '\r') {
+                    --sfarsitText;
+                }
+                linii.push_back({inceput, sfarsitText, ++numarLinie});
+                inceput = sfarsit == capat ? capat : sfarsit + 1;
+            }
+            consumat = static_cast<size_t>(inceput - buffer.data());
+            if (terminat && linii.empty()) {
+                ocupat = 0;
+                consumat = 0;
+            }
+        }
+        return true;
+    }
+};
+
+// ------------------- PARSARE CÂMPURI -------------------
+
+// Împarte o linie CSV; câmpurile între ghilimele sunt decodate pe loc ("" devine ").
+// Întoarce numărul de câmpuri sau nullopt pentru ghilimele neînchise
+optional<size_t> imparteCsv(char* p, char* capat, span<string_view> campuri) {
+    size_t numar = 0;
+    while (true) {
+        string_view camp;
+        if (p < capat && *p == '"') {
+            char* citire = p + 1;
+            char* scriere = p;
+            char* const inceput = p;
+            while (true) {
+                if (citire == capat) {
+                    return nullopt;
+                }
+                if (*citire == '"') {
+                    if (citire + 1 < capat && citire[1] == '"') {
+                        *scriere++ = '"';
+                        citire += 2;
+                        continue;
+                    }
+                    ++citire;
+                    break;
+                }
+                *scriere++ = *citire++;
+            }
+            camp = {inceput, static_cast<size_t>(scriere - inceput)};
+            p = citire;
+            if (p < capat && *p != ',') {
+                return nullopt; // text după ghilimeaua de închidere
+            }
+        } else {
+            char* const inceput = p;
+            while (p < capat && *p != ',') {
+                ++p;
+            }
+            camp = {inceput, static_cast<size_t>(p - inceput)};
+        }
+        if (numar < campuri.size()) {
+            campuri[numar] = camp;
+        }
+        ++numar;
+        if (p == capat) {
+            return numar;
+        }
+        ++p; // virgula
+    }
+}
+
+void scrieUtf8(char*& scriere, uint32_t cod) {
+    if (cod < 0x80) {
+        *scriere++ = static_cast<char>(cod);
+    } else if (cod < 0x800) {
+        *scriere++ = static_cast<char>(0xC0 | cod >> 6);
+        *scriere++ = static_cast<char>(0x80 | (cod & 0x3F));
+    } else if (cod < 0x10000) {
+        *scriere++ = static_cast<char>(0xE0 | cod >> 12);
+        *scriere++ = static_cast<char>(0x80 | (cod >> 6 & 0x3F));
+        *scriere++ = static_cast<char>(0x80 | (cod & 0x3F));
+    } else {
+        *scriere++ = static_cast<char>(0xF0 | cod >> 18);
+        *scriere++ = static_cast<char>(0x80 | (cod >> 12 & 0x3F));
+        *scriere++ = static_cast<char>(0x80 | (cod >> 6 & 0x3F));
+        *scriere++ = static_cast<char>(0x80 | (cod & 0x3F));
+    }
+}
+
+optional<uint32_t> citesteHex4(const char* p, const char* capat) {
+    if (capat - p < 4) {
+        return nullopt;
+    }
+    uint32_t valoare = 0;
+    const auto [sfarsit, eroare] = from_chars(p, p + 4, valoare, 16);
+    if (eroare != errc{} || sfarsit != p + 4) {
+        return nullopt;
+    }
+    return valoare;
+}
+
+// Parser JSON minimal pentru un obiect plat pe o linie. Șirurile sunt decodate pe loc
+// (o secvență escape nu e niciodată mai scurtă decât codificarea ei UTF-8)
+class ParserJson {
+private:
+    char* p;
+    char* capat;
+
+    void spatii() {
+        while (p < capat && (*p == ' ' || *p == '\t')) {
+            ++p;
+        }
+    }
+
+    optional<string_view> sir() {
+        ++p; // ghilimeaua de deschidere
+        char* const inceput = p;
+        char* scriere = p;
+        while (p < capat && *p != '"') {
+            if (*p != '\\') {
+                *scriere++ = *p++;
+                continue;
+            }
+            if (++p == capat) {
+                return nullopt;
+            }
+            switch (*p++) {
+                case '"': *scriere++ = '"'; break;
+                case '\\': *scriere++ = '\\'; break;
+                case '/': *scriere++ = '/'; break;
+                case 'b': *scriere++ = '\b'; break;
+                case 'f': *scriere++ = '\f'; break;
+                case 'n': *scriere++ = '\n'; break;
+                case 'r': *scriere++ = '\r'; break;
+                case 't': *scriere++ = '\t'; break;
+                case 'u': {
+                    auto cod = citesteHex4(p, capat);
+                    if (!cod) {
+                        return nullopt;
+                    }
+                    p += 4;
+                    if (*cod >= 0xD800 && *cod < 0xDC00 && capat - p >= 6 && p[0] == '\\' && p[1] == 'u') {
+                        const auto jos = citesteHex4(p + 2, capat);
+                        if (jos && *jos >= 0xDC00 && *jos < 0xE000) {
+                            cod = 0x10000 + ((*cod - 0xD800) << 10) + (*jos - 0xDC00);
+                            p += 6;
+                        }
+                    }
+                    scrieUtf8(scriere, *cod);
+                    break;
+                }
+                default:
+                    return nullopt;
+            }
+        }
+        if (p == capat) {
+            return nullopt;
+        }
+        ++p; // ghilimeaua de închidere
+        return string_view(inceput, static_cast<size_t>(scriere - inceput));
+    }
+
+public:
+    ParserJson(char* inceput, char* sfarsit) : p(inceput), capat(sfarsit) {}
+
+    // Completează `campuri` după numele din schemă; cheile necunoscute sunt ignorate
+    optional<string> parseaza(const Schema& schema, Campuri& campuri) {
+        spatii();
+        if (p == capat || *p != '{') {
+            return "linia nu este un obiect JSON";
+        }
+        ++p;
+        spatii();
+        if (p < capat && *p == '}') {
+            ++p;
+            return nullopt;
+        }
+        while (true) {
+            spatii();
+            if (p == capat || *p != '"') {
+                return "cheie JSON invalida";
+            }
+            const auto cheie = sir();
+            if (!cheie) {
+                return "sir JSON invalid";
+            }
+            spatii();
+            if (p == capat || *p != ':') {
+                return "lipseste ':' dupa cheie";
+            }
+            ++p;
+            spatii();
+            if (p == capat) {
+                return "valoare lipsa";
+            }
+
+            string_view valoare;
+            bool nul = false;
+            if (*p == '"') {
+                const auto text = sir();
+                if (!text) {
+                    return "sir JSON invalid";
+                }
+                valoare = *text;
+            } else if (*p == '{' || *p == '[') {
+                return "valorile imbricate nu sunt suportate";
+            } else {
+                // număr, true, false sau null: textul brut
+                char* const inceput = p;
+                while (p < capat && *p != ',' && *p != '}' && *p != ' ' && *p != '\t') {
+                    ++p;
+                }
+                valoare = {inceput, static_cast<size_t>(p - inceput)};
+                nul = valoare == "null";
+            }
+            if (const int coloana = indexColoana(schema, *cheie); coloana >= 0 && !nul) {
+                campuri[static_cast<size_t>(coloana)] = valoare;
+            }
+
+            spatii();
+            if (p < capat && *p == ',') {
+                ++p;
+                continue;
+            }
+            if (p < capat && *p == '}') {
+                ++p;
+                spatii();
+                return p == capat ? nullopt : optional<string>("text dupa sfarsitul obiectului");
+            }
+            return "lipseste ',' sau '}'";
+        }
+    }
+};
+
+// Antetul CSV: poziția fiecărei coloane din fișier în schemă (-1 pentru coloane ignorate)
+vector<int> citesteAntet(const Linie& linie, const Schema& schema, const string& cale) {
+    array<string_view, 64> campuri{};
+    const auto numar = imparteCsv(linie.inceput, linie.sfarsit, campuri);
+    if (!numar || *numar > campuri.size()) {
+        throw ImportException("Antet CSV invalid in " + cale);
+    }
+    vector<int> coloane(*numar, -1);
+    array<bool, maximColoane> gasite{};
+    for (size_t i = 0; i < *numar; ++i) {
+        coloane[i] = indexColoana(schema, campuri[i]);
+        if (coloane[i] >= 0) {
+            gasite[static_cast<size_t>(coloane[i])] = true;
+        }
+    }
+    for (size_t i = 0; i < schema.obligatorii; ++i) {
+        if (!gasite[i]) {
+            throw ImportException("Lipseste coloana '" + string(schema.nume[i]) + "' din antetul " + cale);
+        }
+    }
+    return coloane;
+}
+
+optional<string> extrageCampuri(const Linie& linie, FormatImport format, const Schema& schema,
+                                const vector<int>& coloaneCsv, Campuri& campuri) {
+    campuri = {};
+    if (format == FormatImport::Jsonl) {
+        return ParserJson(linie.inceput, linie.sfarsit).parseaza(schema, campuri);
+    }
+    array<string_view, 64> valori{};
+    const auto numar = imparteCsv(linie.inceput, linie.sfarsit, valori);
+    if (!numar) {
+        return "ghilimele neinchise";
+    }
+    if (*numar != coloaneCsv.size()) {
+        return "numar de coloane diferit de antet";
+    }
+    for (size_t i = 0; i < *numar; ++i) {
+        if (coloaneCsv[i] >= 0) {
+            campuri[static_cast<size_t>(coloaneCsv[i])] = valori[i];
+        }
+    }
+    return nullopt;
+}
+
+template <typename T>
+bool citesteNumar(string_view text, T& valoare) {
+    const auto [sfarsit, eroare] = from_chars(text.data(), text.data() + text.size(), valoare);
+    return eroare == errc{} && sfarsit == text.data() + text.size();
+}
+
+// ------------------- RÂNDURI -------------------
+
+struct RandUtilizator {
+    TipUtilizator tip;
+    string_view nume;
+    string_view email;
+    string_view facultateDepartament;
+    size_t linie;
+};
+
+struct RandImprumut {
+    string_view email;
+    string_view titlu;
+    DataZi dataImprumut;
+    DataZi dataReturnare;
+    size_t linie;
+};
+
+struct RandCarteCuLinie {
+    RandCarte rand;
+    size_t linie;
+};
+
+optional<string> parseazaCarte(const Campuri& c, size_t linie, RandCarteCuLinie& rezultat) {
+    RandCarte rand{TipCarte::Generica, c[1], c[2], 0, 0, 0, {}};
+    if (c[0] == "Fizica") {
+        rand.tip = TipCarte::Fizica;
+    } else if (c[0] == "Digitala") {
+        rand.tip = TipCarte::Digitala;
+    } else {
+        return "tip de carte necunoscut";
+    }
+    if (rand.titlu.empty()) {
+        return "titlu lipsa";
+    }
+    if (!citesteNumar(c[3], rand.anPublicare)) {
+        return "an de publicare invalid";
+    }
+    if (rand.tip == TipCarte::Fizica) {
+        if (!citesteNumar(c[4], rand.numarPagini) || rand.numarPagini < 0) {
+            return "numar de pagini invalid";
+        }
+        rand.detaliu = c[5];
+    } else {
+        if (!citesteNumar(c[6], rand.dimensiuneFisier) || rand.dimensiuneFisier < 0) {
+            return "dimensiune de fisier invalida";
+        }
+        rand.detaliu = c[7];
+    }
+    rezultat = {rand, linie};
+    return nullopt;
+}
+
+optional<string> parseazaUtilizator(const Campuri& c, size_t linie, RandUtilizator& rezultat) {
+    const auto tip = tipUtilizatorDinText(c[0]);
+    if (!tip) {
+        return "tip de utilizator necunoscut";
+    }
+    if (c[2].empty()) {
+        return "email lipsa";
+    }
+    rezultat = {*tip, c[1], c[2], c[3], linie};
+    return nullopt;
+}
+
+optional<string> parseazaImprumut(const Campuri& c, size_t linie, RandImprumut& rezultat) {
+    const auto dataImprumut = DataZi::parseaza(c[2]);
+    const auto dataReturnare = DataZi::parseaza(c[3]);
+    if (!dataImprumut || !dataReturnare) {
+        return "data invalida (formatul este YYYY-MM-DD)";
+    }
+    rezultat = {c[0], c[1], *dataImprumut, *dataReturnare, linie};
+    return nullopt;
+}
+
+// Rezultatul unui fir pentru o felie de linii consecutive
+template <typename Rand>
+struct FelieParsata {
+    vector<Rand> randuri;
+    vector<RandInvalid> erori;
+};
+
+// Citește fișierul bloc cu bloc; liniile fiecărui bloc sunt parsate în paralel, iar `aplica`
+// primește rândurile valide în ordinea din fișier, cât timp blocul e încă în memorie
+template <typename Rand, typename Parser, typename Aplica>
+RaportImport importa(const string& cale, const Schema& schema, unsigned numarFire, size_t dimensiuneBloc,
+                     Parser parser, Aplica aplica) {
+    const auto start = chrono::steady_clock::now();
+    const FormatImport format = ImportDate::detecteazaFormat(cale);
+    CititorBlocuri cititor(cale, dimensiuneBloc);
+    RaportImport raport;
+    vector<int> coloaneCsv;
+    bool antetCitit = format == FormatImport::Jsonl;
+
+    vector<Linie> linii;
+    vector<FelieParsata<Rand>> felii(numarFire);
+    vector<Rand> randuri;
+    while (cititor.urmatorul(linii)) {
+        size_t primaLinie = 0;
+        if (!antetCitit) {
+            coloaneCsv = citesteAntet(linii.front(), schema, cale);
+            antetCitit = true;
+            primaLinie = 1;
+        }
+
+        // Felii contigue, una per fir, ca rezultatele să poată fi lipite în ordine
+        const size_t numarLinii = linii.size() - primaLinie;
+        const size_t fire = max<size_t>(1, min<size_t>(numarFire, numarLinii / 1024));
+        const auto parseazaFelie = [&](size_t fir) {
+            auto& felie = felii[fir];
+            felie.randuri.clear();
+            felie.erori.clear();
+            const size_t inceput = primaLinie + numarLinii * fir / fire;
+            const size_t sfarsit = primaLinie + numarLinii * (fir + 1) / fire;
+            Campuri campuri;
+            Rand rand{};
+            for (size_t i = inceput; i < sfarsit; ++i) {
+                const Linie& linie = linii[i];
+                if (linie.inceput == linie.sfarsit) {
+                    continue; // liniile goale sunt ignorate
+                }
+                auto eroare = extrageCampuri(linie, format, schema, coloaneCsv, campuri);
+                if (!eroare) {
+                    eroare = parser(campuri, linie.numar, rand);
+                }
+                if (eroare) {
+                    felie.erori.push_back({linie.numar, std::move(*eroare)});
+                } else {
+                    felie.randuri.push_back(rand);
+                }
+            }
+        };
+        {
+            vector<jthread> lucratori;
+            for (size_t fir = 1; fir < fire; ++fir) {
+                lucratori.emplace_back(parseazaFelie, fir);
+            }
+            parseazaFelie(0);
+        } // jthread face join la ieșirea din bloc
+
+        randuri.clear();
+        for (size_t fir = 0; fir < fire; ++fir) {
+            auto& felie = felii[fir];
+            raport.randuriCitite += felie.randuri.size() + felie.erori.size();
+            for (auto& eroare : felie.erori) {
+                raport.adaugaEroare(eroare.linie, std::move(eroare.motiv));
+            }
+            randuri.insert(randuri.end(), felie.randuri.begin(), felie.randuri.end());
+        }
+        aplica(span<const Rand>(randuri), raport);
+    }
+
+    // Erorile de parsare și cele de la adăugare au fost colectate separat pe fiecare bloc
+    stable_sort(raport.erori.begin(), raport.erori.end(),
+                [](const RandInvalid& a, const RandInvalid& b) { return a.linie < b.linie; });
+    raport.secunde = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return raport;
+}
+
+} // namespace
+
+void RaportImport::adaugaEroare(size_t linie, string motiv) {
+    ++randuriInvalide;
+    if (erori.size() < maximEroriRetinute) {
+        erori.push_back({linie, std::move(motiv)});
+    }
+}
+
+void RaportImport::afisare(size_t maximErori) const {
+    cout << "Randuri citite: " << randuriCitite << ", importate: " << randuriImportate
+         << ", invalide: " << randuriInvalide << '\n';
+    cout << "Durata: " << secunde << " s (" << static_cast<long long>(randuriPeSecunda()) << " randuri/s)\n";
+    for (size_t i = 0; i < min(maximErori, erori.size()); ++i) {
+        cout << "Linia " << erori[i].linie << ": " << erori[i].motiv << '\n';
+    }
+    if (randuriInvalide > min(maximErori, erori.size())) {
+        cout << "... si inca " << randuriInvalide - min(maximErori, erori.size()) << " randuri invalide\n";
+    }
+}
+
+ImportDate::ImportDate(unsigned numarFire, size_t dimensiuneBloc)
+    : numarFire(numarFire != 0 ? numarFire : max(1u, thread::hardware_concurrency())),
+      dimensiuneBloc(max<size_t>(dimensiuneBloc, 4096)) {}
+
+FormatImport ImportDate::detecteazaFormat(const string& cale) {
+    const string_view extensie = string_view(cale).substr(min(cale.size(), cale.rfind('.')));
+    return extensie == ".jsonl" || extensie == ".json" ? FormatImport::Jsonl : FormatImport::Csv;
+}
+
+RaportImport ImportDate::importaCarti(const string& cale, BibliotecaSingleton& biblioteca) const {
+    const auto start = chrono::steady_clock::now();
+    vector<RandCarte> lot;
+    auto raport = importa<RandCarteCuLinie>(cale, schemaCarti, numarFire, dimensiuneBloc, parseazaCarte,
+        [&](span<const RandCarteCuLinie> randuri, RaportImport& r) {
+            lot.clear();
+            for (const auto& rand : randuri) {
+                lot.push_back(rand.rand);
+            }
+            biblioteca.adaugaCarti(lot);
+            r.randuriImportate += lot.size();
+        });
+    // Ordinea alfabetică pentru toate loturile, o singură sortare la final, inclusă în durată
+    biblioteca.finalizeazaLoturi();
+    raport.secunde = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return raport;
+}
+
+RaportImport ImportDate::importaUtilizatori(const string& cale, vector<shared_ptr<Utilizator>>& utilizatori) const {
+    return importa<RandUtilizator>(cale, schemaUtilizatori, numarFire, dimensiuneBloc, parseazaUtilizator,
+        [&](span<const RandUtilizator> randuri, RaportImport& raport) {
+            utilizatori.reserve(utilizatori.size() + randuri.size());
+            for (const auto& rand : randuri) {
+                try {
+                    utilizatori.push_back(UtilizatorFactory::creareUtilizator(
+                        rand.tip, string(rand.nume), string(rand.email), rand.facultateDepartament));
+                    ++raport.randuriImportate;
+                } catch (const ImprumutException& ex) {
+                    raport.adaugaEroare(rand.linie, ex.what());
+                }
+            }
+        });
+}
+
+RaportImport ImportDate::importaImprumuturi(const string& cale, BibliotecaSingleton& biblioteca,
+                                            vector<shared_ptr<ImprumutAbstract>>& imprumuturi) const {
+    return importa<RandImprumut>(cale, schemaImprumuturi, numarFire, dimensiuneBloc, parseazaImprumut,
+        [&](span<const RandImprumut> randuri, RaportImport& raport) {
+            imprumuturi.reserve(imprumuturi.size() + randuri.size());
+            for (const auto& rand : randuri) {
+                const auto utilizator = Utilizator::cautaUtilizator(rand.email);
+                if (!utilizator) {
+                    raport.adaugaEroare(rand.linie, "utilizator necunoscut");
+                    continue;
+                }
+                const auto intrare = biblioteca.cautaCarte(rand.titlu);
+                if (!intrare) {
+                    raport.adaugaEroare(rand.linie, "carte necunoscuta");
+                    continue;
+                }
+                // Aceleași reguli ca la ghișeu: limita utilizatorului și exemplarele disponibile
+                try {
+                    adaugaImprumut(imprumuturi, biblioteca.imprumuta(intrare->id, *utilizator, rand.dataImprumut, rand.dataReturnare));
+                    ++raport.randuriImportate;
+                } catch (const ImprumutException& ex) {
+                    raport.adaugaEroare(rand.linie, ex.what());
+                }
+            }
+        });
+}
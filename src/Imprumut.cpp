@@ -0,0 +1,57 @@
+#include "Imprumut.h"
+#include "PoolObiecte.h"
+
+#include <algorithm>
+#include <iostream>
+
+using namespace std;
+
+AlocatorIduri ImprumutAbstract::alocatorIduri;
+
+void ImprumutCarteFizica::afisare() const {
+    cout << "ID Imprumut: " << idImprumut << ", Data imprumut: " << dataImprumut
+         << ", Data returnare: " << dataReturnare << '\n';
+    cout << "Carte: ";
+    carte.afisare();
+    cout << "Utilizator: ";
+    utilizator.afisare();
+}
+
+void ImprumutCarteDigitala::afisare() const {
+    cout << "ID Imprumut: " << idImprumut << ", Data imprumut: " << dataImprumut
+         << ", Data returnare: " << dataReturnare << '\n';
+    cout << "Carte: ";
+    carte.afisare();
+    cout << "Utilizator: ";
+    utilizator.afisare();
+}
+
+shared_ptr<ImprumutAbstract> ImprumutFactory::creareImprumut(const CarteView& carte, Utilizator& utilizator,
+                                                             DataZi imprumut, DataZi returnare, IdImprumut id) {
+    if (carte.getTip() != TipCarte::Fizica && carte.getTip() != TipCarte::Digitala) {
+        return nullptr;
+    }
+    if (id == 0) {
+        id = ImprumutAbstract::genereazaID();
+    } else {
+        ImprumutAbstract::avanseazaContorID(id);
+    }
+    if (carte.getTip() == TipCarte::Fizica) {
+        return allocate_shared<ImprumutCarteFizica>(AlocatorPool<ImprumutCarteFizica>{}, imprumut, returnare, carte, utilizator, id);
+    }
+    return allocate_shared<ImprumutCarteDigitala>(AlocatorPool<ImprumutCarteDigitala>{}, imprumut, returnare, carte, utilizator, id);
+}
+
+void adaugaImprumut(vector<shared_ptr<ImprumutAbstract>>& imprumuturi, shared_ptr<ImprumutAbstract> imprumut) {
+    auto pozitie = imprumuturi.end();
+    while (pozitie != imprumuturi.begin() && (*prev(pozitie))->getId() > imprumut->getId()) {
+        --pozitie;
+    }
+    imprumuturi.insert(pozitie, std::move(imprumut));
+}
+
+ImprumutAbstract* cautaImprumut(const vector<shared_ptr<ImprumutAbstract>>& imprumuturi, IdImprumut id) {
+    const auto it = lower_bound(imprumuturi.begin(), imprumuturi.end(), id,
+                                [](const shared_ptr<ImprumutAbstract>& imprumut, IdImprumut valoare) { return imprumut->getId() < valoare; });
+    return it != imprumuturi.end() && (*it)->getId() == id ? it->get() : nullptr;
+}
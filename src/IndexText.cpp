@@ -0,0 +1,342 @@
+#include "IndexText.h"
+#include "CatalogCarti.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+
+using namespace std;
+
+namespace {
+
+// U+00C0..U+00FF fără diacritice; spațiul marchează × și ÷, care separă cuvinte
+constexpr string_view latin1 = "aaaaaaaceeeeiiiidnooooo ouuuuyts"
+                               "aaaaaaaceeeeiiiidnooooo ouuuuyty";
+
+// Litera de bază pentru un caracter din două octeți UTF-8, ' ' pentru semne (« » ¿ ...); 0 dacă nu știm una
+char literaDeBaza(unsigned codPunct) {
+    if (codPunct < 0xC0) {
+        return ' ';
+    }
+    if (codPunct <= 0xFF) {
+        return latin1[codPunct - 0xC0];
+    }
+    switch (codPunct) {
+        case 0x102: case 0x103:                          // Ă ă
+            return 'a';
+        case 0x15E: case 0x15F: case 0x218: case 0x219:  // Ş ş Ș ș (cu sedilă și cu virgulă)
+            return 's';
+        case 0x162: case 0x163: case 0x21A: case 0x21B:  // Ţ ţ Ț ț
+            return 't';
+        default:
+            return 0;
+    }
+}
+
+void adaugaVarint(vector<uint8_t>& octeti, uint32_t valoare) {
+    while (valoare >= 0x80) {
+        octeti.push_back(static_cast<uint8_t>(valoare | 0x80));
+        valoare >>= 7;
+    }
+    octeti.push_back(static_cast<uint8_t>(valoare));
+}
+
+uint32_t citesteVarint(const uint8_t*& p) {
+    uint32_t valoare = 0;
+    for (int deplasare = 0;; deplasare += 7) {
+        const uint8_t octet = *p++;
+        valoare |= static_cast<uint32_t>(octet & 0x7F) << deplasare;
+        if (!(octet & 0x80)) {
+            return valoare;
+        }
+    }
+}
+
+// Parcurge o listă de postări, bloc cu bloc
+class CursorPostari {
+private:
+    const IndexText::ListaPostari* lista;
+    size_t bloc = 0;
+    const uint8_t* p = nullptr;
+    const uint8_t* sfarsitBloc = nullptr;
+
+public:
+    IdCarte id = 0;
+    uint32_t frecventa = 0;
+    bool terminat = false;
+
+    explicit CursorPostari(const IndexText::ListaPostari& lista) : lista(&lista) {
+        incepeBloc(0);
+    }
+
+    void incepeBloc(size_t index) {
+        bloc = index;
+        const auto& blocuri = lista->blocuri;
+        p = lista->octeti.data() + blocuri[index].offset;
+        sfarsitBloc = index + 1 < blocuri.size() ? lista->octeti.data() + blocuri[index + 1].offset
+                                                 : lista->octeti.data() + lista->octeti.size();
+        id = blocuri[index].primul;
+        citeste();
+    }
+
+    void citeste() {
+        id += citesteVarint(p);
+        frecventa = citesteVarint(p);
+    }
+
+    [[nodiscard]] bool sfarsitulBlocului() const { return p == sfarsitBloc; }
+    [[nodiscard]] size_t getBloc() const { return bloc; }
+
+    void urmator() {
+        if (!sfarsitulBlocului()) {
+            citeste();
+        } else if (bloc + 1 < lista->blocuri.size()) {
+            incepeBloc(bloc + 1);
+        } else {
+            terminat = true;
+        }
+    }
+
+    // Primul id >= tinta; blocurile care se termină înainte de tinta sunt sărite fără decodare
+    void avanseazaLa(IdCarte tinta) {
+        if (id >= tinta) {
+            return;
+        }
+        // Ultimul bloc care începe cel târziu la tinta, căutat binar printre cele rămase
+        const auto& blocuri = lista->blocuri;
+        const auto dupa = upper_bound(blocuri.begin() + static_cast<ptrdiff_t>(bloc) + 1, blocuri.end(), tinta,
+                                      [](IdCarte valoare, const IndexText::Bloc& b) { return valoare < b.primul; });
+        const auto tintaBloc = static_cast<size_t>(dupa - blocuri.begin()) - 1;
+        if (tintaBloc != bloc) {
+            incepeBloc(tintaBloc);
+        }
+        while (!terminat && id < tinta) {
+            urmator();
+        }
+    }
+};
+
+} // namespace
+
+vector<string> IndexText::cuvinte(string_view text) {
+    vector<string> rezultat;
+    string curent;
+    const auto incheie = [&] {
+        if (!curent.empty()) {
+            rezultat.push_back(std::move(curent));
+            curent.clear();
+        }
+    };
+    for (size_t i = 0; i < text.size(); ++i) {
+        const auto c = static_cast<unsigned char>(text[i]);
+        if (c < 0x80) {
+            if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z')) {
+                curent += static_cast<char>(c);
+            } else if (c >= 'A' && c <= 'Z') {
+                curent += static_cast<char>(c - 'A' + 'a');
+            } else {
+                incheie();
+            }
+            continue;
+        }
+        if ((c & 0xE0) == 0xC0 && i + 1 < text.size()) {
+            const unsigned codPunct = (c & 0x1Fu) << 6 | (static_cast<unsigned char>(text[i + 1]) & 0x3Fu);
+            if (const char litera = literaDeBaza(codPunct)) {
+                if (litera == ' ') {
+                    incheie();
+                } else {
+                    curent += litera;
+                }
+                ++i;
+                continue;
+            }
+        }
+        if (c == 0xE2 && i + 2 < text.size() && (static_cast<unsigned char>(text[i + 1]) & 0xFE) == 0x80) {
+            incheie(); // punctuația generală U+2000..U+207F: linii de pauză, ghilimele „ ”, ...
+            i += 2;
+            continue;
+        }
+        curent += static_cast<char>(c); // alte caractere non-ASCII rămân parte din cuvânt, neschimbate
+    }
+    incheie();
+    return rezultat;
+}
+
+void IndexText::adaugaCarte(IdCarte id) {
+    const CarteView carte = catalog[id];
+    auto termeniCarte = cuvinte(carte.getTitlu());
+    auto termeniAutor = cuvinte(carte.getAutor());
+    termeniCarte.insert(termeniCarte.end(), make_move_iterator(termeniAutor.begin()), make_move_iterator(termeniAutor.end()));
+    const auto lungime = static_cast<uint16_t>(min<size_t>(termeniCarte.size(), UINT16_MAX));
+    lungimi.resize(id + 1, 0);
+    lungimi[id] = lungime;
+    lungimeTotala += lungime;
+
+    sort(termeniCarte.begin(), termeniCarte.end());
+    for (size_t i = 0; i < termeniCarte.size();) {
+        size_t j = i + 1;
+        while (j < termeniCarte.size() && termeniCarte[j] == termeniCarte[i]) {
+            ++j;
+        }
+        const auto frecventa = static_cast<uint16_t>(min<size_t>(j - i, UINT16_MAX));
+
+        auto it = termeni.find(string_view(termeniCarte[i]));
+        if (it == termeni.end()) {
+            it = termeni.emplace(std::move(termeniCarte[i]), static_cast<uint32_t>(liste.size())).first;
+            liste.emplace_back();
+        }
+        ListaPostari& lista = liste[it->second];
+        IdCarte anterior = lista.ultimul;
+        if (lista.numar % dimensiuneBloc == 0) {
+            lista.blocuri.push_back({id, static_cast<uint32_t>(lista.octeti.size()), 0, UINT16_MAX});
+            anterior = id;
+        }
+        Bloc& bloc = lista.blocuri.back();
+        bloc.frecventaMaxima = max(bloc.frecventaMaxima, frecventa);
+        bloc.lungimeMinima = min(bloc.lungimeMinima, lungime);
+        lista.frecventaMaxima = max(lista.frecventaMaxima, frecventa);
+        lista.lungimeMinima = min(lista.lungimeMinima, lungime);
+        adaugaVarint(lista.octeti, id - anterior);
+        adaugaVarint(lista.octeti, frecventa);
+        lista.ultimul = id;
+        ++lista.numar;
+        i = j;
+    }
+}
+
+void IndexText::actualizeaza() {
+    const size_t numar = catalog.size();
+    if (indexate == numar) {
+        return; // fără nicio scriere, deci sigur și din citiri paralele
+    }
+    for (size_t id = indexate; id < numar; ++id) {
+        adaugaCarte(static_cast<IdCarte>(id));
+    }
+    indexate = numar;
+}
+
+void IndexText::reseteaza() {
+    indexate = 0;
+    termeni.clear();
+    liste.clear();
+    lungimi.clear();
+    lungimeTotala = 0;
+}
+
+vector<RezultatText> IndexText::cauta(string_view text, size_t k) const {
+    auto cautate = cuvinte(text);
+    sort(cautate.begin(), cautate.end());
+    cautate.erase(unique(cautate.begin(), cautate.end()), cautate.end());
+    if (cautate.empty() || k == 0 || indexate == 0) {
+        return {};
+    }
+
+    // Toate cuvintele trebuie să apară; cel mai rar conduce
+    vector<const ListaPostari*> listeCautate;
+    for (const auto& cuvant : cautate) {
+        const auto it = termeni.find(string_view(cuvant));
+        if (it == termeni.end()) {
+            return {};
+        }
+        listeCautate.push_back(&liste[it->second]);
+    }
+    sort(listeCautate.begin(), listeCautate.end(), [](auto a, auto b) { return a->numar < b->numar; });
+
+    const auto numarCarti = static_cast<float>(indexate);
+    const float lungimeMedie = max(1.0f, static_cast<float>(lungimeTotala) / numarCarti);
+    vector<float> idf;
+    for (const auto* lista : listeCautate) {
+        const auto df = static_cast<float>(lista->numar);
+        idf.push_back(log(1.0f + (numarCarti - df + 0.5f) / (df + 0.5f)));
+    }
+    const auto scor = [&](size_t termen, uint32_t frecventa, uint16_t lungime) {
+        const auto tf = static_cast<float>(frecventa);
+        return idf[termen] * tf * (k1 + 1) / (tf + k1 * (1 - b + b * static_cast<float>(lungime) / lungimeMedie));
+    };
+    // Cel mai mare scor posibil din celelalte cuvinte, oricare ar fi cartea
+    float maximRest = 0;
+    for (size_t j = 1; j < listeCautate.size(); ++j) {
+        maximRest += scor(j, listeCautate[j]->frecventaMaxima, listeCautate[j]->lungimeMinima);
+    }
+    // Odată ce tot top-ul are scorul maxim posibil, cărțile următoare (id-uri mai mari) nu mai pot intra
+    const float maximTotal = scor(0, listeCautate[0]->frecventaMaxima, listeCautate[0]->lungimeMinima) + maximRest;
+
+    const auto maiBun = [](const RezultatText& a, const RezultatText& c) {
+        return a.scor > c.scor || (a.scor == c.scor && a.id < c.id);
+    };
+    priority_queue<RezultatText, vector<RezultatText>, decltype(maiBun)> top(maiBun); // cel mai slab în vârf
+
+    vector<CursorPostari> cursoare;
+    for (const auto* lista : listeCautate) {
+        cursoare.emplace_back(*lista);
+    }
+    const auto& blocuri = listeCautate[0]->blocuri;
+    CursorPostari& conducator = cursoare[0];
+    for (size_t indexBloc = 0; indexBloc < blocuri.size(); ++indexBloc) {
+        if (top.size() == k && top.top().scor >= maximTotal) {
+            break;
+        }
+        const float limitaBloc = scor(0, blocuri[indexBloc].frecventaMaxima, blocuri[indexBloc].lungimeMinima) + maximRest;
+        if (top.size() == k && limitaBloc <= top.top().scor) {
+            continue; // nicio carte din bloc nu poate intra în top
+        }
+        if (conducator.getBloc() != indexBloc) {
+            conducator.incepeBloc(indexBloc);
+        }
+        while (true) {
+            const IdCarte id = conducator.id;
+            float total = scor(0, conducator.frecventa, lungimi[id]);
+            // Nici cu scorul maxim din celelalte cuvinte nu intră în top: celelalte liste nu mai sunt decodate
+            bool toate = top.size() < k || total + maximRest > top.top().scor;
+            for (size_t j = 1; j < cursoare.size() && toate; ++j) {
+                cursoare[j].avanseazaLa(id);
+                if (cursoare[j].terminat) {
+                    // O listă s-a terminat: nu mai există cărți cu toate cuvintele
+                    indexBloc = blocuri.size();
+                    toate = false;
+                } else if (cursoare[j].id != id) {
+                    toate = false;
+                } else {
+                    total += scor(j, cursoare[j].frecventa, lungimi[id]);
+                }
+            }
+            if (toate) {
+                const RezultatText rezultat{id, total};
+                if (top.size() < k) {
+                    top.push(rezultat);
+                } else if (maiBun(rezultat, top.top())) {
+                    top.pop();
+                    top.push(rezultat);
+                }
+                if (top.size() == k && top.top().scor >= maximTotal) {
+                    indexBloc = blocuri.size();
+                }
+            }
+            if (indexBloc >= blocuri.size() || conducator.sfarsitulBlocului()) {
+                break;
+            }
+            conducator.citeste();
+        }
+    }
+
+    vector<RezultatText> rezultat;
+    rezultat.reserve(top.size());
+    while (!top.empty()) {
+        rezultat.push_back(top.top());
+        top.pop();
+    }
+    reverse(rezultat.begin(), rezultat.end());
+    return rezultat;
+}
+
+size_t IndexText::memorieOcupata() const {
+    size_t total = lungimi.capacity() * sizeof(uint16_t) + liste.capacity() * sizeof(ListaPostari);
+    for (const auto& [termen, id] : termeni) {
+        total += termen.capacity() + sizeof(id);
+    }
+    for (const auto& lista : liste) {
+        total += lista.octeti.capacity() + lista.blocuri.capacity() * sizeof(Bloc);
+    }
+    return total;
+}
@@ -0,0 +1,221 @@
+#include "IndexTitluri.h"
+#include "CatalogCarti.h"
+#include "Snapshot.h"
+
+#include <algorithm>
+#include <bit>
+#include <numeric>
+#include <utility>
+
+using namespace std;
+
+namespace {
+
+// Tamponul rămâne mic față de secvența sortată, ca prefixele să nu plătească arborele
+constexpr size_t tamponMinim = 4096;
+
+} // namespace
+
+bool IndexTitluri::ComparatorTitlu::operator()(IdCarte a, IdCarte b) const {
+    const int comparatie = catalog->titlu(a).compare(catalog->titlu(b));
+    return comparatie < 0 || (comparatie == 0 && a < b);
+}
+
+bool IndexTitluri::ComparatorTitlu::operator()(IdCarte a, string_view b) const {
+    return catalog->titlu(a) < b;
+}
+
+bool IndexTitluri::ComparatorTitlu::operator()(string_view a, IdCarte b) const {
+    return a < catalog->titlu(b);
+}
+
+uint32_t IndexTitluri::amprenta(string_view titlu) {
+    uint32_t rezultat = 2166136261u;
+    for (const char c : titlu) {
+        rezultat = (rezultat ^ static_cast<unsigned char>(c)) * 16777619u;
+    }
+    return rezultat;
+}
+
+void IndexTitluri::insereazaExact(IdCarte id, uint32_t amprentaTitlu) {
+    Slot* tabela = sloturi.modifica();
+    const size_t masca = sloturi.size() - 1;
+    const string_view titlu = catalog.titlu(id);
+    for (size_t i = amprentaTitlu & masca;; i = (i + 1) & masca) {
+        if (tabela[i].id == slotLiber) {
+            tabela[i] = {id, amprentaTitlu};
+            ++ocupate;
+            return;
+        }
+        if (tabela[i].amprenta == amprentaTitlu && catalog.titlu(tabela[i].id) == titlu) {
+            return; // la duplicate rămâne prima intrare
+        }
+    }
+}
+
+void IndexTitluri::redimensioneaza(size_t numarSloturi) {
+    vector<Slot> vechi(sloturi.begin(), sloturi.end());
+    sloturi.assign(numarSloturi, Slot{slotLiber, 0});
+    ocupate = 0;
+    for (const Slot& slot : vechi) {
+        if (slot.id != slotLiber) {
+            insereazaExact(slot.id, slot.amprenta);
+        }
+    }
+}
+
+void IndexTitluri::rezerva(size_t numar) {
+    // Factor de încărcare cel mult 1/2
+    const size_t necesar = bit_ceil(max<size_t>(16, numar * 2));
+    if (necesar > sloturi.size()) {
+        redimensioneaza(necesar);
+    }
+}
+
+void IndexTitluri::adauga(IdCarte id) {
+    rezerva(ocupate + 1);
+    insereazaExact(id, amprenta(catalog.titlu(id)));
+    tampon.insert(id);
+    if (tampon.size() > max(tamponMinim, ordonate.size() / 8)) {
+        compacteaza();
+    }
+}
+
+void IndexTitluri::adaugaLot(IdCarte primul, IdCarte sfarsit) {
+    if (primul >= sfarsit) {
+        return;
+    }
+    rezerva(ocupate + (sfarsit - primul));
+    for (IdCarte id = primul; id < sfarsit; ++id) {
+        insereazaExact(id, amprenta(catalog.titlu(id)));
+        loturi.push_back(id);
+    }
+}
+
+void IndexTitluri::compacteaza() {
+    if (tampon.empty() && loturi.empty()) {
+        return;
+    }
+    const auto comparator = tampon.key_comp();
+    vector<IdCarte> noi(tampon.begin(), tampon.end());
+    if (!loturi.empty()) {
+        sort(loturi.begin(), loturi.end(), comparator);
+        vector<IdCarte> cuLoturi;
+        cuLoturi.reserve(noi.size() + loturi.size());
+        merge(noi.begin(), noi.end(), loturi.begin(), loturi.end(), back_inserter(cuLoturi), comparator);
+        noi = std::move(cuLoturi);
+    }
+
+    vector<IdCarte> combinate;
+    combinate.reserve(ordonate.size() + noi.size());
+    merge(ordonate.begin(), ordonate.end(), noi.begin(), noi.end(), back_inserter(combinate), comparator);
+    ordonate.assign(combinate.begin(), combinate.end());
+    tampon.clear();
+    loturi = {};
+}
+
+void IndexTitluri::reconstruieste() {
+    const auto numar = static_cast<IdCarte>(catalog.size());
+    tampon.clear();
+    loturi = {};
+    sloturi.assign(0, Slot{});
+    ocupate = 0;
+    rezerva(numar);
+    for (IdCarte id = 0; id < numar; ++id) {
+        insereazaExact(id, amprenta(catalog.titlu(id)));
+    }
+
+    vector<IdCarte> toate(numar);
+    iota(toate.begin(), toate.end(), IdCarte{0});
+    sort(toate.begin(), toate.end(), tampon.key_comp());
+    ordonate.assign(toate.begin(), toate.end());
+}
+
+optional<IntrareTitlu> IndexTitluri::cauta(string_view titlu) const {
+    if (sloturi.empty()) {
+        return nullopt;
+    }
+    const uint32_t amprentaTitlu = amprenta(titlu);
+    const size_t masca = sloturi.size() - 1;
+    for (size_t i = amprentaTitlu & masca; sloturi[i].id != slotLiber; i = (i + 1) & masca) {
+        if (sloturi[i].amprenta == amprentaTitlu && catalog.titlu(sloturi[i].id) == titlu) {
+            const IdCarte id = sloturi[i].id;
+            return IntrareTitlu{id, catalog[id].getTip()};
+        }
+    }
+    return nullopt;
+}
+
+template <typename Conditie>
+vector<IntrareTitlu> IndexTitluri::parcurge(const IdCarte* itOrdonate, set<IdCarte, ComparatorTitlu>::const_iterator itTampon,
+                                            size_t limita, Conditie inInterval) const {
+    vector<IntrareTitlu> rezultat;
+    const auto comparator = tampon.key_comp();
+    bool ordonateActive = itOrdonate != ordonate.end() && inInterval(*itOrdonate);
+    bool tamponActiv = itTampon != tampon.end() && inInterval(*itTampon);
+    while (rezultat.size() < limita && (ordonateActive || tamponActiv)) {
+        IdCarte id;
+        if (ordonateActive && (!tamponActiv || comparator(*itOrdonate, *itTampon))) {
+            id = *itOrdonate++;
+            ordonateActive = itOrdonate != ordonate.end() && inInterval(*itOrdonate);
+        } else {
+            id = *itTampon++;
+            tamponActiv = itTampon != tampon.end() && inInterval(*itTampon);
+        }
+        rezultat.push_back({id, catalog[id].getTip()});
+    }
+    return rezultat;
+}
+
+vector<IntrareTitlu> IndexTitluri::cautaPrefix(string_view prefix, size_t limita) const {
+    // Oprită la primul titlu fără prefix
+    return parcurge(lower_bound(ordonate.begin(), ordonate.end(), prefix, tampon.key_comp()), tampon.lower_bound(prefix), limita,
+                    [&](IdCarte id) { return catalog.titlu(id).starts_with(prefix); });
+}
+
+vector<IntrareTitlu> IndexTitluri::cautaInterval(string_view dela, string_view panaLa, size_t limita) const {
+    return parcurge(lower_bound(ordonate.begin(), ordonate.end(), dela, tampon.key_comp()), tampon.lower_bound(dela), limita,
+                    [&](IdCarte id) { return panaLa.empty() || catalog.titlu(id) < panaLa; });
+}
+
+vector<IntrareTitlu> IndexTitluri::paginaDupa(string_view titlu, size_t marime) const {
+    const auto oriunde = [](IdCarte) { return true; };
+    if (titlu.empty()) {
+        return parcurge(ordonate.begin(), tampon.begin(), marime, oriunde);
+    }
+    return parcurge(upper_bound(ordonate.begin(), ordonate.end(), titlu, tampon.key_comp()), tampon.upper_bound(titlu), marime, oriunde);
+}
+
+vector<IntrareTitlu> IndexTitluri::paginaDupa(IdCarte ultima, size_t marime) const {
+    if (ultima >= catalog.size()) {
+        return {};
+    }
+    // Cheia de ordonare e (titlu, id), deci cartea însăși e un cursor exact
+    return parcurge(upper_bound(ordonate.begin(), ordonate.end(), ultima, tampon.key_comp()), tampon.upper_bound(ultima), marime,
+                    [](IdCarte) { return true; });
+}
+
+void IndexTitluri::salveaza(ScriitorSnapshot& snapshot) const {
+    const uint64_t numarOcupate = ocupate;
+    snapshot.scrieSectiune(Sectiune::IndexSloturi, sloturi);
+    snapshot.scrieSectiune(Sectiune::IndexOrdonate, ordonate);
+    snapshot.scrieSectiune(Sectiune::IndexOcupate, &numarOcupate, sizeof(numarOcupate));
+}
+
+void IndexTitluri::incarca(const CititorSnapshot& snapshot) {
+    tampon.clear();
+    loturi = {};
+    snapshot.mapeaza(Sectiune::IndexSloturi, sloturi);
+    snapshot.mapeaza(Sectiune::IndexOrdonate, ordonate);
+    const auto numarOcupate = snapshot.sectiune<uint64_t>(Sectiune::IndexOcupate);
+    ocupate = numarOcupate.empty() ? 0 : numarOcupate[0];
+    if ((!sloturi.empty() && !has_single_bit(sloturi.size())) || ordonate.size() != catalog.size()) {
+        throw PersistentaException("Tabela de titluri invalida in snapshot");
+    }
+    const size_t numarCarti = catalog.size();
+    const auto inCatalog = [numarCarti](IdCarte id) { return id < numarCarti; };
+    if (!all_of(ordonate.begin(), ordonate.end(), inCatalog)
+        || !all_of(sloturi.begin(), sloturi.end(), [&](const Slot& slot) { return slot.id == slotLiber || inCatalog(slot.id); })) {
+        throw PersistentaException("Tabela de titluri invalida in snapshot");
+    }
+}
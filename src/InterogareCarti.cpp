@@ -0,0 +1,205 @@
+#include "InterogareCarti.h"
+#include "CatalogCarti.h"
+
+#include <algorithm>
+#include <numeric>
+
+using namespace std;
+
+namespace {
+
+constexpr size_t faraEstimare = numeric_limits<size_t>::max();
+
+} // namespace
+
+void IndexCatalog::actualizeaza() {
+    const size_t numar = catalog.size();
+    if (indexate == numar) {
+        return; // fără nicio scriere, deci sigur și din citiri paralele
+    }
+    const auto autori = catalog.coloanaAutor();
+    const auto ani = catalog.coloanaAnPublicare();
+    const auto tipuri = catalog.coloanaTip();
+    const auto detalii = catalog.coloanaDetaliu();
+
+    auto itAn = cartiAn.end();
+    for (size_t i = indexate; i < numar; ++i) {
+        const auto id = static_cast<IdCarte>(i);
+        if (autori[i] >= cartiAutor.size()) {
+            cartiAutor.resize(autori[i] + 1);
+        }
+        cartiAutor[autori[i]].push_back(id);
+
+        // Cărțile vin des grupate pe ani (importuri sortate), deci anul anterior e încercat primul
+        if (itAn == cartiAn.end() || itAn->first != ani[i]) {
+            itAn = cartiAn.try_emplace(ani[i]).first;
+        }
+        itAn->second.push_back(id);
+
+        cartiTip[static_cast<size_t>(tipuri[i])].seteaza(id);
+        if (detalii[i] >= cartiDetaliu.size()) {
+            cartiDetaliu.resize(detalii[i] + 1);
+        }
+        cartiDetaliu[detalii[i]].seteaza(id);
+    }
+    indexate = numar;
+}
+
+void IndexCatalog::reseteaza() {
+    indexate = 0;
+    cartiAutor.clear();
+    cartiAn.clear();
+    cartiTip = {};
+    cartiDetaliu.clear();
+}
+
+RezultatInterogare IndexCatalog::executa(const Interogare& interogare) const {
+    RezultatInterogare rezultat;
+
+    // Filtrele pe șiruri devin id-uri interne; un șir care nu apare în catalog nu se potrivește cu nimic
+    optional<TipCarte> tip = interogare.tip;
+    optional<uint32_t> detaliu;
+    const auto cereDetaliu = [&](TipCarte tipCerut, const string& valoare) {
+        if (tip && *tip != tipCerut) {
+            return false;
+        }
+        tip = tipCerut;
+        detaliu = catalog.idDetaliuDupaNume(valoare);
+        return detaliu.has_value();
+    };
+    if (interogare.stareFizica && interogare.format) {
+        return rezultat;
+    }
+    if (interogare.stareFizica && !cereDetaliu(TipCarte::Fizica, *interogare.stareFizica)) {
+        return rezultat;
+    }
+    if (interogare.format && !cereDetaliu(TipCarte::Digitala, *interogare.format)) {
+        return rezultat;
+    }
+    optional<uint32_t> autor;
+    if (interogare.autor && !(autor = catalog.idAutorDupaNume(*interogare.autor))) {
+        return rezultat;
+    }
+    const bool filtruAn = interogare.anMinim || interogare.anMaxim;
+    const int anMinim = interogare.anMinim.value_or(numeric_limits<int>::min());
+    const int anMaxim = interogare.anMaxim.value_or(numeric_limits<int>::max());
+    if (anMinim > anMaxim) {
+        return rezultat;
+    }
+
+    // Câți candidați ar da fiecare index
+    const auto ani = filtruAn ? cartiAn.lower_bound(anMinim) : cartiAn.end();
+    const auto aniSfarsit = filtruAn ? cartiAn.upper_bound(anMaxim) : cartiAn.end();
+    size_t estimareAni = filtruAn ? 0 : faraEstimare;
+    for (auto it = ani; it != aniSfarsit; ++it) {
+        estimareAni += it->second.size();
+    }
+    const size_t estimareAutor = !autor ? faraEstimare : *autor < cartiAutor.size() ? cartiAutor[*autor].size() : 0;
+    const MultimeBiti* bitiTip = tip ? &cartiTip[static_cast<size_t>(*tip)] : nullptr;
+    const MultimeBiti* bitiDetaliu = detaliu ? (*detaliu < cartiDetaliu.size() ? &cartiDetaliu[*detaliu] : nullptr) : nullptr;
+    if (detaliu && !bitiDetaliu) {
+        return rezultat; // valoare cunoscută în catalog, dar fără cărți indexate
+    }
+    const size_t estimareBiti = min(bitiTip ? bitiTip->size() : faraEstimare, bitiDetaliu ? bitiDetaliu->size() : faraEstimare);
+
+    // Restul filtrelor se verifică direct pe coloane
+    const auto coloanaAutor = catalog.coloanaAutor();
+    const auto coloanaAn = catalog.coloanaAnPublicare();
+    const auto coloanaTip = catalog.coloanaTip();
+    const auto coloanaDetaliu = catalog.coloanaDetaliu();
+    const auto potriveste = [&](IdCarte id) {
+        return (!autor || coloanaAutor[id] == *autor) && (!filtruAn || (coloanaAn[id] >= anMinim && coloanaAn[id] <= anMaxim))
+            && (!tip || coloanaTip[id] == *tip) && (!detaliu || coloanaDetaliu[id] == *detaliu);
+    };
+
+    vector<IdCarte> gasite;
+    const size_t minim = min({estimareAutor, estimareAni, estimareBiti});
+    if (minim == faraEstimare) {
+        rezultat.sursa = SursaInterogare::Catalog;
+        gasite.resize(indexate);
+        iota(gasite.begin(), gasite.end(), IdCarte{0});
+    } else if (minim == estimareAutor) {
+        rezultat.sursa = SursaInterogare::Autor;
+        if (estimareAutor > 0) {
+            copy_if(cartiAutor[*autor].begin(), cartiAutor[*autor].end(), back_inserter(gasite), potriveste);
+        }
+    } else if (minim == estimareAni) {
+        rezultat.sursa = SursaInterogare::Ani;
+        for (auto it = ani; it != aniSfarsit; ++it) {
+            copy_if(it->second.begin(), it->second.end(), back_inserter(gasite), potriveste);
+        }
+        if (ani != aniSfarsit && next(ani) != aniSfarsit) {
+            sort(gasite.begin(), gasite.end()); // listele pe ani sunt crescătoare fiecare, nu și concatenate
+        }
+    } else {
+        rezultat.sursa = SursaInterogare::MultimiBiti;
+        const auto colecteaza = [&](const MultimeBiti& candidati) {
+            gasite.reserve(candidati.size());
+            candidati.pentruFiecare([&](size_t id) {
+                if (potriveste(static_cast<IdCarte>(id))) {
+                    gasite.push_back(static_cast<IdCarte>(id));
+                }
+            });
+        };
+        if (bitiTip && bitiDetaliu) {
+            MultimeBiti candidati = bitiTip->size() <= bitiDetaliu->size() ? *bitiTip : *bitiDetaliu;
+            candidati.intersecteaza(bitiTip->size() <= bitiDetaliu->size() ? *bitiDetaliu : *bitiTip);
+            colecteaza(candidati);
+        } else {
+            colecteaza(bitiTip ? *bitiTip : *bitiDetaliu);
+        }
+    }
+
+    rezultat.total = gasite.size();
+    if (interogare.deplasament >= gasite.size()) {
+        return rezultat;
+    }
+    const size_t sfarsit = interogare.deplasament + min(interogare.limita, gasite.size() - interogare.deplasament);
+
+    // Ordonare doar cât e nevoie pentru pagina cerută; la chei egale decide ordinea adăugării
+    const auto ordoneaza = [&](auto cheie) {
+        const auto comparator = [&](IdCarte a, IdCarte b) {
+            const auto cheieA = cheie(a), cheieB = cheie(b);
+            if (cheieA != cheieB) {
+                return interogare.descrescator ? cheieB < cheieA : cheieA < cheieB;
+            }
+            return a < b;
+        };
+        partial_sort(gasite.begin(), gasite.begin() + static_cast<ptrdiff_t>(sfarsit), gasite.end(), comparator);
+    };
+    switch (interogare.ordonare) {
+        case OrdonareCarti::Titlu:
+            ordoneaza([&](IdCarte id) { return catalog.titlu(id); });
+            break;
+        case OrdonareCarti::AnPublicare:
+            ordoneaza([&](IdCarte id) { return coloanaAn[id]; });
+            break;
+        case OrdonareCarti::Autor:
+            ordoneaza([&](IdCarte id) { return catalog[id].getAutor(); });
+            break;
+        default:
+            if (interogare.descrescator) {
+                reverse(gasite.begin(), gasite.end());
+            }
+    }
+    rezultat.carti.assign(gasite.begin() + static_cast<ptrdiff_t>(interogare.deplasament),
+                          gasite.begin() + static_cast<ptrdiff_t>(sfarsit));
+    return rezultat;
+}
+
+size_t IndexCatalog::memorieOcupata() const {
+    size_t total = cartiAutor.capacity() * sizeof(vector<IdCarte>);
+    for (const auto& carti : cartiAutor) {
+        total += carti.capacity() * sizeof(IdCarte);
+    }
+    for (const auto& [an, carti] : cartiAn) {
+        total += carti.capacity() * sizeof(IdCarte);
+    }
+    for (const auto& biti : cartiTip) {
+        total += biti.memorieOcupata();
+    }
+    for (const auto& biti : cartiDetaliu) {
+        total += biti.memorieOcupata();
+    }
+    return total;
+}
@@ -0,0 +1,183 @@
+#include "Inventar.h"
+#include "CatalogCarti.h"
+#include "Exceptii.h"
+#include "Utilizator.h"
+
+#include <algorithm>
+#include <bit>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+// Biții exemplarelor [dela, panaLa)
+uint64_t mascaExemplare(unsigned dela, unsigned panaLa) {
+    const uint64_t panaLaMasca = panaLa >= 64 ? ~uint64_t{0} : (uint64_t{1} << panaLa) - 1;
+    const uint64_t delaMasca = dela >= 64 ? ~uint64_t{0} : (uint64_t{1} << dela) - 1;
+    return panaLaMasca & ~delaMasca;
+}
+
+} // namespace
+
+Inventar::Inventar(const CatalogCarti& catalog)
+    : catalog(catalog), segmente(make_unique<unique_ptr<StareCarte[]>[]>(numarSegmente)) {}
+
+Inventar::StareCarte& Inventar::stareIndexata(IdCarte id) const {
+    if (id >= indexate.load(memory_order_acquire)) {
+        throw ImprumutException("Carte inexistenta in inventar!");
+    }
+    return stare(id);
+}
+
+void Inventar::actualizeaza() {
+    const lock_guard<mutex> blocare(mutexScriere);
+    const size_t numar = catalog.size();
+    const auto tipuri = catalog.coloanaTip();
+    for (size_t i = indexate.load(memory_order_relaxed); i < numar; ++i) {
+        auto& segment = segmente[i >> bitiSegment];
+        if (!segment) {
+            segment = make_unique<StareCarte[]>(cartiPeSegment);
+        }
+        auto& carte = segment[i & (cartiPeSegment - 1)];
+        carte.tip = tipuri[i];
+        if (tipuri[i] == TipCarte::Fizica) {
+            carte.exemplare.store(1, memory_order_relaxed);
+            carte.libere.store(1, memory_order_relaxed);
+        }
+    }
+    // Publică stările noi pentru firele care împrumută
+    indexate.store(numar, memory_order_release);
+}
+
+void Inventar::incarca(span<const uint8_t> exemplare) {
+    {
+        const lock_guard<mutex> blocare(mutexScriere);
+        for (size_t i = 0; i < numarSegmente && segmente[i]; ++i) {
+            segmente[i].reset();
+        }
+        indexate.store(0, memory_order_relaxed);
+    }
+    for (auto& shard : sharduri) {
+        shard.detinatori.clear();
+    }
+    actualizeaza();
+    if (!exemplare.empty() && exemplare.size() != catalog.size()) {
+        throw ImprumutException("Inventar inconsistent cu catalogul");
+    }
+    for (size_t i = 0; i < exemplare.size(); ++i) {
+        auto& carte = stare(static_cast<IdCarte>(i));
+        if (carte.tip == TipCarte::Fizica) {
+            const unsigned numar = min<unsigned>(exemplare[i], maximExemplare);
+            carte.exemplare.store(static_cast<uint8_t>(numar), memory_order_relaxed);
+            carte.libere.store(mascaExemplare(0, numar), memory_order_relaxed);
+        }
+    }
+}
+
+void Inventar::seteazaExemplare(IdCarte id, unsigned numar) {
+    const lock_guard<mutex> blocare(mutexScriere);
+    auto& carte = stareIndexata(id);
+    if (carte.tip != TipCarte::Fizica) {
+        throw ImprumutException("Doar cartile fizice au exemplare!");
+    }
+    if (numar > maximExemplare) {
+        throw ImprumutException("O carte are cel mult " + to_string(maximExemplare) + " exemplare!");
+    }
+    const unsigned vechi = carte.exemplare.load(memory_order_relaxed);
+    if (numar > vechi) {
+        carte.libere.fetch_or(mascaExemplare(vechi, numar), memory_order_release);
+    } else if (numar < vechi) {
+        // Exemplarele scoase trebuie să fie toate pe raft; le scoate dintr-o dată, ca nimeni să nu le mai ia
+        const uint64_t scoase = mascaExemplare(numar, vechi);
+        uint64_t libere = carte.libere.load(memory_order_relaxed);
+        do {
+            if ((libere & scoase) != scoase) {
+                throw ImprumutException("Exemplarele de scos sunt imprumutate!");
+            }
+        } while (!carte.libere.compare_exchange_weak(libere, libere & ~scoase, memory_order_acq_rel));
+    }
+    carte.exemplare.store(static_cast<uint8_t>(numar), memory_order_relaxed);
+}
+
+uint8_t Inventar::imprumuta(IdCarte id, Utilizator& utilizator) {
+    auto& carte = stareIndexata(id);
+    if (carte.tip == TipCarte::Generica) {
+        throw ImprumutException("Cartea nu se poate imprumuta!");
+    }
+    if (!utilizator.rezervaImprumut()) {
+        throw ImprumutException("Limita de " + to_string(utilizator.limitaImprumuturi()) + " imprumuturi active a fost atinsa!");
+    }
+    if (carte.tip == TipCarte::Digitala) {
+        return faraExemplar;
+    }
+
+    uint64_t libere = carte.libere.load(memory_order_relaxed);
+    do {
+        if (libere == 0) {
+            utilizator.elibereazaImprumut();
+            throw ImprumutException("Niciun exemplar disponibil!");
+        }
+    } while (!carte.libere.compare_exchange_weak(libere, libere & (libere - 1), memory_order_acquire, memory_order_relaxed));
+    const auto exemplar = static_cast<uint8_t>(countr_zero(libere));
+    seteazaDetinator(id, exemplar, &utilizator);
+    return exemplar;
+}
+
+void Inventar::returneaza(IdCarte id, uint8_t exemplar, Utilizator& utilizator) {
+    if (exemplar != faraExemplar) {
+        auto& carte = stareIndexata(id);
+        // Deținătorul se șterge înainte ca exemplarul să poată fi luat de altcineva
+        seteazaDetinator(id, exemplar, nullptr);
+        carte.libere.fetch_or(uint64_t{1} << exemplar, memory_order_release);
+    }
+    utilizator.elibereazaImprumut();
+}
+
+void Inventar::restaureaza(IdCarte id, uint8_t exemplar, Utilizator& utilizator) {
+    if (exemplar != faraExemplar) {
+        auto& carte = stareIndexata(id);
+        const uint64_t bit = exemplar < maximExemplare ? uint64_t{1} << exemplar : 0;
+        if (!bit || !(carte.libere.fetch_and(~bit, memory_order_acquire) & bit)) {
+            throw ImprumutException("Exemplar inexistent sau deja imprumutat!");
+        }
+        seteazaDetinator(id, exemplar, &utilizator);
+    }
+    utilizator.restaureazaImprumut();
+}
+
+void Inventar::seteazaDetinator(IdCarte id, uint8_t exemplar, Utilizator* utilizator) {
+    const uint64_t c = cheie(id, exemplar);
+    auto& s = shard(c);
+    const lock_guard<mutex> blocare(s.mutex);
+    if (utilizator) {
+        s.detinatori[c] = utilizator;
+    } else {
+        s.detinatori.erase(c);
+    }
+}
+
+unsigned Inventar::exemplare(IdCarte id) const {
+    return stareIndexata(id).exemplare.load(memory_order_relaxed);
+}
+
+unsigned Inventar::disponibile(IdCarte id) const {
+    return static_cast<unsigned>(popcount(stareIndexata(id).libere.load(memory_order_relaxed)));
+}
+
+Utilizator* Inventar::detinator(IdCarte id, uint8_t exemplar) const {
+    const uint64_t c = cheie(id, exemplar);
+    auto& s = shard(c);
+    const lock_guard<mutex> blocare(s.mutex);
+    const auto it = s.detinatori.find(c);
+    return it == s.detinatori.end() ? nullptr : it->second;
+}
+
+vector<uint8_t> Inventar::exemplarePerCarte() const {
+    const size_t numar = indexate.load(memory_order_acquire);
+    vector<uint8_t> exemplare(numar);
+    for (size_t i = 0; i < numar; ++i) {
+        exemplare[i] = stare(static_cast<IdCarte>(i)).exemplare.load(memory_order_relaxed);
+    }
+    return exemplare;
+}
@@ -0,0 +1,271 @@
+#include "IstoricImprumuturi.h"
+#include "Exceptii.h"
+
+#include <algorithm>
+#include <filesystem>
+
+using namespace std;
+
+namespace {
+
+void scrieVarint(vector<uint8_t>& octeti, uint64_t valoare) {
+    while (valoare >= 0x80) {
+        octeti.push_back(static_cast<uint8_t>(valoare | 0x80));
+        valoare >>= 7;
+    }
+    octeti.push_back(static_cast<uint8_t>(valoare));
+}
+
+uint64_t citesteVarint(const uint8_t*& pozitie, const uint8_t* sfarsit) {
+    uint64_t valoare = 0;
+    for (unsigned deplasare = 0; pozitie != sfarsit && deplasare < 64; deplasare += 7) {
+        const uint8_t octet = *pozitie++;
+        valoare |= static_cast<uint64_t>(octet & 0x7F) << deplasare;
+        if (octet < 0x80) {
+            return valoare;
+        }
+    }
+    throw PersistentaException("Bloc de istoric corupt");
+}
+
+// Diferențe negative mici devin numere mici: 0, -1, 1, -2, ... -> 0, 1, 2, 3, ...
+uint64_t zigzag(int64_t valoare) {
+    return (static_cast<uint64_t>(valoare) << 1) ^ static_cast<uint64_t>(valoare >> 63);
+}
+
+int64_t dinZigzag(uint64_t valoare) {
+    return static_cast<int64_t>(valoare >> 1) ^ -static_cast<int64_t>(valoare & 1);
+}
+
+bool dupaData(DataZi data, const IstoricImprumut& imprumut) {
+    return data < imprumut.dataImprumut;
+}
+
+bool inainteDeData(const IstoricImprumut& imprumut, DataZi data) {
+    return imprumut.dataImprumut < data;
+}
+
+} // namespace
+
+ArhivaIstoric::ArhivaIstoric(string caleArhiva) : cale(std::move(caleArhiva)) {
+    fisier.open(cale, ios::in | ios::out | ios::trunc | ios::binary);
+    if (!fisier) {
+        throw PersistentaException("Nu pot deschide arhiva de istoric " + cale);
+    }
+}
+
+ArhivaIstoric::~ArhivaIstoric() {
+    fisier.close();
+    error_code eroare;
+    filesystem::remove(cale, eroare);
+}
+
+uint64_t ArhivaIstoric::scrie(span<const uint8_t> octeti) {
+    const lock_guard<mutex> blocare(mutexFisier);
+    fisier.seekp(static_cast<streamoff>(lungime));
+    fisier.write(reinterpret_cast<const char*>(octeti.data()), static_cast<streamsize>(octeti.size()));
+    if (!fisier) {
+        throw PersistentaException("Scriere esuata in arhiva de istoric " + cale);
+    }
+    const uint64_t pozitie = lungime;
+    lungime += octeti.size();
+    return pozitie;
+}
+
+vector<uint8_t> ArhivaIstoric::citeste(uint64_t pozitie, uint32_t numarOcteti) const {
+    vector<uint8_t> octeti(numarOcteti);
+    const lock_guard<mutex> blocare(mutexFisier);
+    fisier.seekg(static_cast<streamoff>(pozitie));
+    fisier.read(reinterpret_cast<char*>(octeti.data()), static_cast<streamsize>(octeti.size()));
+    if (!fisier) {
+        throw PersistentaException("Citire esuata din arhiva de istoric " + cale);
+    }
+    return octeti;
+}
+
+uint64_t ArhivaIstoric::getLungime() const {
+    const lock_guard<mutex> blocare(mutexFisier);
+    return lungime;
+}
+
+shared_ptr<ArhivaIstoric> IstoricImprumuturi::arhiva;
+
+size_t IstoricImprumuturi::numarInBlocuri() const {
+    return blocuri.empty() ? 0 : blocuri.back().inceput + blocuri.back().numar;
+}
+
+// Trei coloane, una după alta: diferența față de data precedentă, durata împrumutului și
+// diferența față de id-ul precedent
+void IstoricImprumuturi::comprima(Bloc& bloc, span<const IstoricImprumut> intrari, bool inArhiva) {
+    vector<uint8_t> octeti;
+    octeti.reserve(intrari.size() * 4);
+    DataZi precedenta = intrari.front().dataImprumut;
+    for (const auto& intrare : intrari) {
+        scrieVarint(octeti, static_cast<uint64_t>(intrare.dataImprumut - precedenta));
+        precedenta = intrare.dataImprumut;
+    }
+    for (const auto& intrare : intrari) {
+        scrieVarint(octeti, zigzag(intrare.dataReturnare - intrare.dataImprumut));
+    }
+    int64_t idPrecedent = 0;
+    for (const auto& intrare : intrari) {
+        scrieVarint(octeti, zigzag(static_cast<int64_t>(intrare.idCarte) - idPrecedent));
+        idPrecedent = intrare.idCarte;
+    }
+
+    bloc.prima = intrari.front().dataImprumut;
+    bloc.ultima = intrari.back().dataImprumut;
+    bloc.numar = static_cast<uint32_t>(intrari.size());
+    if (inArhiva) {
+        // Versiunea veche rămâne nefolosită în fișier; se întâmplă doar la inserări întârziate
+        bloc.pozitieArhiva = arhiva->scrie(octeti);
+        bloc.lungimeArhiva = static_cast<uint32_t>(octeti.size());
+        bloc.octeti = vector<uint8_t>();
+    } else {
+        octeti.shrink_to_fit();
+        bloc.octeti = std::move(octeti);
+    }
+}
+
+void IstoricImprumuturi::decomprima(const Bloc& bloc, vector<IstoricImprumut>& rezultat) const {
+    vector<uint8_t> dinArhiva;
+    span<const uint8_t> octeti = bloc.octeti;
+    if (octeti.empty()) {
+        dinArhiva = arhiva->citeste(bloc.pozitieArhiva, bloc.lungimeArhiva);
+        octeti = dinArhiva;
+    }
+    const uint8_t* pozitie = octeti.data();
+    const uint8_t* const sfarsit = pozitie + octeti.size();
+
+    const size_t inceput = rezultat.size();
+    DataZi data = bloc.prima;
+    for (uint32_t i = 0; i < bloc.numar; ++i) {
+        data = data + static_cast<int32_t>(citesteVarint(pozitie, sfarsit));
+        rezultat.emplace_back(0, data, data);
+    }
+    for (size_t i = inceput; i < rezultat.size(); ++i) {
+        rezultat[i].dataReturnare = rezultat[i].dataImprumut + static_cast<int32_t>(dinZigzag(citesteVarint(pozitie, sfarsit)));
+    }
+    int64_t id = 0;
+    for (size_t i = inceput; i < rezultat.size(); ++i) {
+        id += dinZigzag(citesteVarint(pozitie, sfarsit));
+        rezultat[i].idCarte = static_cast<IdCarte>(id);
+    }
+}
+
+void IstoricImprumuturi::sigileaza() {
+    Bloc bloc{};
+    bloc.inceput = numarInBlocuri();
+    comprima(bloc, coada, false);
+    blocuri.push_back(std::move(bloc));
+    coada.clear();
+
+    if (!arhiva) {
+        return;
+    }
+    // Blocurile vechi pleacă în arhivă pe rând, în ordinea sigilării
+    for (; primulCald + blocuriCalde < blocuri.size(); ++primulCald) {
+        Bloc& rece = blocuri[primulCald];
+        rece.pozitieArhiva = arhiva->scrie(rece.octeti);
+        rece.lungimeArhiva = static_cast<uint32_t>(rece.octeti.size());
+        rece.octeti = vector<uint8_t>(); // atribuirea cu {} ar păstra capacitatea
+    }
+}
+
+void IstoricImprumuturi::insereazaInBloc(size_t index, const IstoricImprumut& imprumut) {
+    Bloc& bloc = blocuri[index];
+    vector<IstoricImprumut> intrari;
+    intrari.reserve(bloc.numar + 1);
+    decomprima(bloc, intrari);
+    intrari.insert(upper_bound(intrari.begin(), intrari.end(), imprumut.dataImprumut, dupaData), imprumut);
+    comprima(bloc, intrari, bloc.octeti.empty());
+    for (size_t i = index + 1; i < blocuri.size(); ++i) {
+        ++blocuri[i].inceput;
+    }
+}
+
+void IstoricImprumuturi::adauga(const IstoricImprumut& imprumut) {
+    if (!blocuri.empty() && imprumut.dataImprumut < blocuri.back().ultima) {
+        // Primul bloc care se termină după data lui: intervalele rămân disjuncte și ordonate
+        const auto bloc = upper_bound(blocuri.begin(), blocuri.end(), imprumut.dataImprumut,
+                                      [](DataZi data, const Bloc& b) { return data < b.ultima; });
+        insereazaInBloc(static_cast<size_t>(bloc - blocuri.begin()), imprumut);
+        return;
+    }
+    coada.insert(upper_bound(coada.begin(), coada.end(), imprumut.dataImprumut, dupaData), imprumut);
+    if (coada.size() == dimensiuneBloc) {
+        sigileaza();
+    }
+}
+
+size_t IstoricImprumuturi::pozitie(DataZi data) const {
+    const auto bloc = lower_bound(blocuri.begin(), blocuri.end(), data,
+                                  [](const Bloc& b, DataZi d) { return b.ultima < d; });
+    if (bloc == blocuri.end()) {
+        return numarInBlocuri() + static_cast<size_t>(lower_bound(coada.begin(), coada.end(), data, inainteDeData) - coada.begin());
+    }
+    if (!(bloc->prima < data)) {
+        return bloc->inceput;
+    }
+    vector<IstoricImprumut> intrari;
+    intrari.reserve(bloc->numar);
+    decomprima(*bloc, intrari);
+    return bloc->inceput + static_cast<size_t>(lower_bound(intrari.begin(), intrari.end(), data, inainteDeData) - intrari.begin());
+}
+
+void IstoricImprumuturi::citeste(size_t inceput, size_t cate, vector<IstoricImprumut>& rezultat) const {
+    const size_t sfarsit = min(numar(), inceput + min(cate, numar()));
+    if (inceput >= sfarsit) {
+        return;
+    }
+    rezultat.reserve(rezultat.size() + (sfarsit - inceput));
+
+    auto bloc = upper_bound(blocuri.begin(), blocuri.end(), inceput,
+                            [](size_t p, const Bloc& b) { return p < b.inceput; });
+    if (bloc != blocuri.begin()) {
+        --bloc;
+    }
+    size_t pozitieCurenta = inceput;
+    vector<IstoricImprumut> intrari;
+    for (; bloc != blocuri.end() && pozitieCurenta < sfarsit; ++bloc) {
+        if (bloc->inceput + bloc->numar <= pozitieCurenta) {
+            continue;
+        }
+        intrari.clear();
+        decomprima(*bloc, intrari);
+        const size_t de = pozitieCurenta - bloc->inceput;
+        const size_t pana = min<size_t>(bloc->numar, sfarsit - bloc->inceput);
+        rezultat.insert(rezultat.end(), intrari.begin() + static_cast<ptrdiff_t>(de), intrari.begin() + static_cast<ptrdiff_t>(pana));
+        pozitieCurenta = bloc->inceput + pana;
+    }
+    const size_t inBlocuri = numarInBlocuri();
+    if (pozitieCurenta < sfarsit) {
+        rezultat.insert(rezultat.end(), coada.begin() + static_cast<ptrdiff_t>(pozitieCurenta - inBlocuri),
+                        coada.begin() + static_cast<ptrdiff_t>(sfarsit - inBlocuri));
+    }
+}
+
+vector<IstoricImprumut> IstoricImprumuturi::intre(DataZi de, DataZi pana) const {
+    vector<IstoricImprumut> rezultat;
+    if (pana < de) {
+        return rezultat;
+    }
+    const size_t inceput = pozitie(de);
+    citeste(inceput, pozitie(pana + 1) - inceput, rezultat);
+    return rezultat;
+}
+
+vector<IstoricImprumut> IstoricImprumuturi::ultimele(size_t cate) const {
+    vector<IstoricImprumut> rezultat;
+    const size_t total = numar();
+    citeste(total - min(cate, total), cate, rezultat);
+    return rezultat;
+}
+
+size_t IstoricImprumuturi::octetiInMemorie() const {
+    size_t octeti = blocuri.capacity() * sizeof(Bloc) + coada.capacity() * sizeof(IstoricImprumut);
+    for (const auto& bloc : blocuri) {
+        octeti += bloc.octeti.capacity();
+    }
+    return octeti;
+}
@@ -0,0 +1,136 @@
+#include "JurnalOperatii.h"
+
+#include <array>
+#include <filesystem>
+#include <utility>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+struct AntetOperatie {
+    uint32_t lungime; // lungimea conținutului, fără antet
+    uint32_t crc;     // peste secvență, tip și conținut
+    uint64_t secventa;
+    TipOperatie tip;
+};
+
+constexpr size_t dimensiuneAntet = 17; // fără umplutura structurii
+constexpr uint32_t lungimeMaxima = 1u << 26;
+
+constexpr array<uint32_t, 256> tabelCrc = [] {
+    array<uint32_t, 256> tabel{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t valoare = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            valoare = (valoare & 1) ? 0xEDB88320u ^ (valoare >> 1) : valoare >> 1;
+        }
+        tabel[i] = valoare;
+    }
+    return tabel;
+}();
+
+uint32_t actualizeazaCrc(uint32_t crc, const void* date, size_t lungime) {
+    const auto* octeti = static_cast<const unsigned char*>(date);
+    for (size_t i = 0; i < lungime; ++i) {
+        crc = tabelCrc[(crc ^ octeti[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+uint32_t crcOperatie(uint64_t secventa, TipOperatie tip, string_view continut) {
+    uint32_t crc = ~0u;
+    crc = actualizeazaCrc(crc, &secventa, sizeof(secventa));
+    crc = actualizeazaCrc(crc, &tip, sizeof(tip));
+    crc = actualizeazaCrc(crc, continut.data(), continut.size());
+    return ~crc;
+}
+
+// Scrie antetul câmp cu câmp, fără umplutura structurii
+void serializeazaAntet(const AntetOperatie& antet, char* destinatie) {
+    memcpy(destinatie, &antet.lungime, 4);
+    memcpy(destinatie + 4, &antet.crc, 4);
+    memcpy(destinatie + 8, &antet.secventa, 8);
+    memcpy(destinatie + 16, &antet.tip, 1);
+}
+
+} // namespace
+
+JurnalOperatii::JurnalOperatii(string caleJurnal) : cale(std::move(caleJurnal)) {
+    uint64_t lungimeValida = 0;
+    if (FILE* existent = fopen(cale.c_str(), "rb")) {
+        char octetiAntet[dimensiuneAntet];
+        while (fread(octetiAntet, 1, dimensiuneAntet, existent) == dimensiuneAntet) {
+            AntetOperatie antet{};
+            memcpy(&antet.lungime, octetiAntet, 4);
+            memcpy(&antet.crc, octetiAntet + 4, 4);
+            memcpy(&antet.secventa, octetiAntet + 8, 8);
+            memcpy(&antet.tip, octetiAntet + 16, 1);
+            if (antet.lungime > lungimeMaxima || antet.secventa <= secventa) {
+                break;
+            }
+            string continut(antet.lungime, '\0');
+            if (fread(continut.data(), 1, continut.size(), existent) != continut.size()
+                || crcOperatie(antet.secventa, antet.tip, continut) != antet.crc) {
+                break; // înregistrare scrisă pe jumătate: tot ce urmează e ignorat
+            }
+            secventa = antet.secventa;
+            lungimeValida += dimensiuneAntet + antet.lungime;
+            recuperate.push_back({antet.secventa, antet.tip, std::move(continut)});
+        }
+        fclose(existent);
+
+        error_code eroare;
+        if (filesystem::file_size(cale, eroare) != lungimeValida && !eroare) {
+            filesystem::resize_file(cale, lungimeValida);
+        }
+    }
+
+    fisier = fopen(cale.c_str(), "ab");
+    if (!fisier) {
+        throw PersistentaException("Nu pot deschide jurnalul " + cale);
+    }
+}
+
+JurnalOperatii::~JurnalOperatii() {
+    if (fisier) {
+        fclose(fisier);
+    }
+}
+
+uint64_t JurnalOperatii::scrie(TipOperatie tip, string_view continut) {
+    const AntetOperatie antet{static_cast<uint32_t>(continut.size()), crcOperatie(secventa + 1, tip, continut), secventa + 1, tip};
+    char octetiAntet[dimensiuneAntet];
+    serializeazaAntet(antet, octetiAntet);
+    if (fwrite(octetiAntet, 1, dimensiuneAntet, fisier) != dimensiuneAntet
+        || fwrite(continut.data(), 1, continut.size(), fisier) != continut.size()
+        || (!inLot && fflush(fisier) != 0)) {
+        throw PersistentaException("Scriere esuata in jurnalul " + cale);
+    }
+    return ++secventa;
+}
+
+void JurnalOperatii::terminaLot() {
+    inLot = false;
+    if (fflush(fisier) != 0) {
+        throw PersistentaException("Scriere esuata in jurnalul " + cale);
+    }
+}
+
+void JurnalOperatii::sincronizeaza() {
+#ifndef _WIN32
+    fsync(fileno(fisier));
+#endif
+}
+
+void JurnalOperatii::goleste() {
+    fclose(fisier);
+    fisier = fopen(cale.c_str(), "wb");
+    if (!fisier) {
+        throw PersistentaException("Nu pot goli jurnalul " + cale);
+    }
+}
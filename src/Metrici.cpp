@@ -0,0 +1,65 @@
+#include "Metrici.h"
+
+#include <ostream>
+
+using namespace std;
+
+// Inițializare constantă: metricile pot fi folosite din orice constructor static
+constinit MetriciBiblioteca metrici;
+
+namespace {
+
+// Marginile găleților exportate: puteri ale lui 2 între 128 ns și ~17 s
+constexpr unsigned primaPutere = 7;
+constexpr unsigned ultimaPutere = 34;
+
+} // namespace
+
+uint64_t ContorSharduit::valoare() const {
+    uint64_t total = 0;
+    for (const auto& shard : sharduri) {
+        total += shard.valoare.load(memory_order_relaxed);
+    }
+    return total;
+}
+
+void MetricaLatenta::scriePrometheus(ostream& iesire) const {
+    iesire << "# HELP " << nume << "_apeluri_total " << descriere << ": numarul de apeluri\n"
+           << "# TYPE " << nume << "_apeluri_total counter\n"
+           << nume << "_apeluri_total " << apeluri.valoare() << '\n';
+
+    // Histograma, _count și _sum acoperă doar apelurile eșantionate; numărul exact e în _apeluri_total
+    iesire << "# HELP " << nume << "_seconds " << descriere << ": latenta apelurilor esantionate (1 din "
+           << mascaEsantionare + 1 << "); _count si _sum numara doar esantioanele, toate apelurile sunt in "
+           << nume << "_apeluri_total\n"
+           << "# TYPE " << nume << "_seconds histogram\n";
+    for (unsigned putere = primaPutere; putere <= ultimaPutere; ++putere) {
+        const uint64_t limita = uint64_t{1} << putere;
+        uint64_t numar = 0;
+        for (const auto& histograma : histograme) {
+            numar += histograma.numarCelMult(limita);
+        }
+        iesire << nume << "_seconds_bucket{le=\"" << static_cast<double>(limita) / 1e9 << "\"} " << numar << '\n';
+    }
+    uint64_t numar = 0;
+    uint64_t suma = 0;
+    for (const auto& histograma : histograme) {
+        numar += histograma.getNumar();
+        suma += histograma.getSuma();
+    }
+    iesire << nume << "_seconds_bucket{le=\"+Inf\"} " << numar << '\n'
+           << nume << "_seconds_sum " << static_cast<double>(suma) / 1e9 << '\n'
+           << nume << "_seconds_count " << numar << '\n';
+}
+
+void scrieMetriciPrometheus(ostream& iesire) {
+    iesire << "# HELP biblioteca_imprumuturi_total Imprumuturi create de la pornire\n"
+           << "# TYPE biblioteca_imprumuturi_total counter\n"
+           << "biblioteca_imprumuturi_total " << metrici.imprumuturiCreate.valoare() << '\n';
+#if BIBLIOTECA_METRICI
+    for (const auto* metrica : {&metrici.adaugaCarte, &metrici.cautareTitlu, &metrici.cautareUtilizator,
+                                &metrici.calculPenalitate}) {
+        metrica->scriePrometheus(iesire);
+    }
+#endif
+}
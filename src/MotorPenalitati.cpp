@@ -0,0 +1,204 @@
+#include "MotorPenalitati.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+using namespace std;
+
+namespace {
+
+// Împrumuturile unui singur tip de carte, pe coloane
+struct LotImprumuturi {
+    vector<int32_t> zileImprumut;
+    vector<double> penalitateZi;
+    vector<uint32_t> pozitie; // poziția în vectorul de împrumuturi primit
+    vector<double> penalitate;
+
+    void goleste() {
+        zileImprumut.clear();
+        penalitateZi.clear();
+        pozitie.clear();
+    }
+};
+
+// Tabel cu adresare deschisă Utilizator* -> index; mult mai ieftin decât unordered_map pe calea fierbinte
+class TabelUtilizatori {
+private:
+    vector<Utilizator*> chei;
+    vector<uint32_t> valori;
+    vector<size_t> ocupate;
+
+    static size_t dispersie(const Utilizator* utilizator) {
+        auto x = reinterpret_cast<uintptr_t>(utilizator);
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        return static_cast<size_t>(x ^ (x >> 33));
+    }
+
+    void mareste() {
+        vector<Utilizator*> vechi = std::move(chei);
+        vector<uint32_t> valoriVechi = std::move(valori);
+        chei.assign(max<size_t>(64, vechi.size() * 2), nullptr);
+        valori.assign(chei.size(), 0);
+        ocupate.clear();
+        for (size_t i = 0; i < vechi.size(); ++i) {
+            if (vechi[i]) {
+                gaseste(vechi[i], valoriVechi[i]);
+            }
+        }
+    }
+
+public:
+    // Întoarce indexul existent sau îl inserează pe `urmator`; `nou` spune care dintre ele
+    pair<uint32_t, bool> gaseste(Utilizator* utilizator, uint32_t urmator) {
+        if ((ocupate.size() + 1) * 2 > chei.size()) {
+            mareste();
+        }
+        const size_t masca = chei.size() - 1;
+        for (size_t i = dispersie(utilizator) & masca;; i = (i + 1) & masca) {
+            if (chei[i] == utilizator) {
+                return {valori[i], false};
+            }
+            if (!chei[i]) {
+                chei[i] = utilizator;
+                valori[i] = urmator;
+                ocupate.push_back(i);
+                return {urmator, true};
+            }
+        }
+    }
+
+    void goleste() {
+        for (const size_t i : ocupate) {
+            chei[i] = nullptr;
+        }
+        ocupate.clear();
+    }
+};
+
+// Sumele parțiale ale unui bloc, în ordinea primei apariții a utilizatorului în bloc
+struct RezultatBloc {
+    vector<pair<Utilizator*, double>> totaluri;
+    double total = 0;
+    size_t intarziate = 0;
+};
+
+// Dimensiunea blocului nu depinde de numărul de fire, deci nici ordinea adunărilor
+constexpr size_t dimensiuneBloc = 1 << 14;
+
+// Formula e inline din PoliticaIntarziere; perioada de grație e citită o dată pe rulare
+void calculeazaLot(LotImprumuturi& lot, int32_t zileLaData, int32_t zileGratie) {
+    const size_t numar = lot.zileImprumut.size();
+    lot.penalitate.resize(numar);
+    const int32_t* zile = lot.zileImprumut.data();
+    const double* rata = lot.penalitateZi.data();
+    double* rezultat = lot.penalitate.data();
+    for (size_t i = 0; i < numar; ++i) {
+        rezultat[i] = PoliticaIntarziere::penalitate(zileLaData - zile[i], rata[i], zileGratie);
+    }
+}
+
+void proceseazaBloc(const vector<shared_ptr<ImprumutAbstract>>& imprumuturi, size_t inceput, size_t sfarsit,
+                    int32_t zileLaData, int32_t zileGratie, double* penalitatePerImprumut, RezultatBloc& rezultat) {
+    thread_local LotImprumuturi loturi[3];
+    thread_local TabelUtilizatori indexUtilizator;
+    thread_local vector<Utilizator*> utilizatori; // citiți o singură dată, în aceeași trecere cu datele; nullptr = returnat
+
+    // Gruparea pe tip de carte: fiecare lot e o buclă simplă pe coloane contigue
+    for (auto& lot : loturi) {
+        lot.goleste();
+    }
+    utilizatori.clear();
+    for (size_t i = inceput; i < sfarsit; ++i) {
+        const auto& imprumut = *imprumuturi[i];
+        // Un împrumut returnat nu mai acumulează: rămâne cu penalitatea deja aplicată, deci aplica() nu-l atinge
+        if (imprumut.esteReturnat()) {
+            utilizatori.push_back(nullptr);
+            penalitatePerImprumut[i] = imprumut.getPenalitateAplicata();
+            continue;
+        }
+        utilizatori.push_back(&imprumut.getUtilizator());
+        auto& lot = loturi[static_cast<size_t>(imprumut.getTipCarte())];
+        lot.zileImprumut.push_back(imprumut.getDataImprumut().getZile());
+        lot.penalitateZi.push_back(imprumut.getPenalitateZi());
+        lot.pozitie.push_back(static_cast<uint32_t>(i));
+    }
+    for (auto& lot : loturi) {
+        calculeazaLot(lot, zileLaData, zileGratie);
+        for (size_t i = 0; i < lot.pozitie.size(); ++i) {
+            penalitatePerImprumut[lot.pozitie[i]] = lot.penalitate[i];
+        }
+    }
+
+    // Doar împrumuturile întârziate și nereturnate contribuie la totaluri
+    indexUtilizator.goleste();
+    for (size_t i = inceput; i < sfarsit; ++i) {
+        const double penalitate = penalitatePerImprumut[i];
+        Utilizator* utilizator = utilizatori[i - inceput];
+        if (penalitate <= 0 || !utilizator) {
+            continue;
+        }
+        const auto [index, nou] = indexUtilizator.gaseste(utilizator, static_cast<uint32_t>(rezultat.totaluri.size()));
+        if (nou) {
+            rezultat.totaluri.emplace_back(utilizator, 0.0);
+        }
+        rezultat.totaluri[index].second += penalitate;
+        rezultat.total += penalitate;
+        ++rezultat.intarziate;
+    }
+}
+
+} // namespace
+
+MotorPenalitati::MotorPenalitati(unsigned numarFire)
+    : numarFire(numarFire != 0 ? numarFire : max(1u, thread::hardware_concurrency())) {}
+
+RezultatPenalitati MotorPenalitati::calculeaza(const vector<shared_ptr<ImprumutAbstract>>& imprumuturi, DataZi data) const {
+    RezultatPenalitati rezultat;
+    rezultat.data = data;
+    rezultat.penalitatePerImprumut.assign(imprumuturi.size(), 0.0);
+
+    const size_t numarBlocuri = (imprumuturi.size() + dimensiuneBloc - 1) / dimensiuneBloc;
+    vector<RezultatBloc> blocuri(numarBlocuri);
+    atomic<size_t> urmatorulBloc{0};
+    const int32_t zileGratie = TabelPenalitati::curent().getZileGratie();
+    auto lucreaza = [&] {
+        for (size_t bloc = urmatorulBloc++; bloc < numarBlocuri; bloc = urmatorulBloc++) {
+            const size_t inceput = bloc * dimensiuneBloc;
+            proceseazaBloc(imprumuturi, inceput, min(imprumuturi.size(), inceput + dimensiuneBloc),
+                           data.getZile(), zileGratie, rezultat.penalitatePerImprumut.data(), blocuri[bloc]);
+        }
+    };
+    {
+        vector<jthread> fire;
+        for (size_t i = 1; i < min<size_t>(numarFire, numarBlocuri); ++i) {
+            fire.emplace_back(lucreaza);
+        }
+        lucreaza();
+    } // jthread face join la ieșirea din bloc
+
+    // Reducerea se face în ordinea blocurilor, deci sumele nu depind de numărul de fire
+    TabelUtilizatori indexUtilizator;
+    for (const auto& bloc : blocuri) {
+        for (const auto& [utilizator, suma] : bloc.totaluri) {
+            const auto [index, nou] = indexUtilizator.gaseste(utilizator, static_cast<uint32_t>(rezultat.utilizatori.size()));
+            if (nou) {
+                rezultat.utilizatori.push_back(utilizator);
+                rezultat.totalPerUtilizator.push_back(0);
+            }
+            rezultat.totalPerUtilizator[index] += suma;
+        }
+        rezultat.total += bloc.total;
+        rezultat.imprumuturiIntarziate += bloc.intarziate;
+    }
+    return rezultat;
+}
+
+void MotorPenalitati::aplica(const vector<shared_ptr<ImprumutAbstract>>& imprumuturi, const RezultatPenalitati& rezultat) {
+    for (size_t i = 0; i < imprumuturi.size() && i < rezultat.penalitatePerImprumut.size(); ++i) {
+        imprumuturi[i]->aplicaPenalitate(rezultat.penalitatePerImprumut[i]);
+    }
+}
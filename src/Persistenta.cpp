@@ -0,0 +1,296 @@
+#include "Persistenta.h"
+#include "ColoanaSiruri.h"
+#include "MotorPenalitati.h"
+#include "Snapshot.h"
+
+#include <filesystem>
+#include <unordered_map>
+
+using namespace std;
+
+namespace {
+
+// Un rând din secțiunea de împrumuturi
+struct InregistrareImprumut {
+    IdImprumut id;
+    IdCarte idCarte;
+    uint32_t indexUtilizator; // poziția în lista de utilizatori din același snapshot
+    int32_t dataImprumut;
+    int32_t dataReturnare;
+    uint32_t stare; // exemplarul în octetul de jos și bitul de returnare
+    uint32_t rezervat; // zero; aliniază penalitatea fără octeți de umplutură neinițializați
+    double penalitateAplicata;
+};
+static_assert(sizeof(InregistrareImprumut) == 40);
+
+constexpr uint32_t stareReturnat = 1u << 8;
+
+enum class TipUtilizatorSalvat : uint8_t { Student, Profesor };
+
+// Creează directorul înainte ca jurnalul să fie deschis în lista de inițializare
+string pregatesteDirector(const string& director) {
+    filesystem::create_directories(director);
+    return director;
+}
+
+shared_ptr<Carte> carteDinOperatie(CititorOperatie& cititor) {
+    const auto tip = cititor.citeste<TipCarte>();
+    const auto an = cititor.citeste<int32_t>();
+    const auto pagini = cititor.citeste<int32_t>();
+    const auto dimensiune = cititor.citeste<float>();
+    const string titlu = cititor.citesteSir();
+    const string autor = cititor.citesteSir();
+    string detaliu = cititor.citesteSir();
+    switch (tip) {
+        case TipCarte::Fizica:
+            return make_shared<CarteFizica>(titlu, autor, an, pagini, std::move(detaliu));
+        case TipCarte::Digitala:
+            return make_shared<CarteDigitala>(titlu, autor, an, dimensiune, std::move(detaliu));
+        default:
+            return make_shared<Carte>(titlu, autor, an);
+    }
+}
+
+} // namespace
+
+Persistenta::Persistenta(const string& director)
+    : director(director), caleSnapshot((filesystem::path(pregatesteDirector(director)) / "snapshot.bin").string()),
+      jurnal((filesystem::path(director) / "jurnal.wal").string()) {}
+
+uint64_t Persistenta::incarcaSnapshot(BibliotecaSingleton& biblioteca, vector<shared_ptr<Utilizator>>& utilizatori,
+                                      vector<shared_ptr<ImprumutAbstract>>& imprumuturi) {
+    const CititorSnapshot snapshot(caleSnapshot);
+    snapshotMapat = snapshot.getFisier();
+
+    // Catalogul și indexul de titluri folosesc direct memoria mapată
+    biblioteca.incarca(snapshot);
+
+    const auto tipuri = snapshot.sectiune<TipUtilizatorSalvat>(Sectiune::UtilizatoriTip);
+    const auto penalizari = snapshot.sectiune<double>(Sectiune::UtilizatoriPenalizari);
+    ColoanaSiruri siruri;
+    siruri.mapeaza(snapshot.sectiune<uint64_t>(Sectiune::UtilizatoriSiruriInceputuri),
+                   snapshot.sectiune<char>(Sectiune::UtilizatoriSiruriCaractere));
+    if (penalizari.size() != tipuri.size() || siruri.size() != 3 * tipuri.size()) {
+        throw PersistentaException("Sectiuni de utilizatori inconsistente in snapshot");
+    }
+
+    // Utilizatorii și împrumuturile sunt obiecte polimorfe, deci se construiesc unul câte unul
+    const size_t primulUtilizator = utilizatori.size();
+    for (uint32_t i = 0; i < tipuri.size(); ++i) {
+        auto utilizator = UtilizatorFactory::creareUtilizator(
+            tipuri[i] == TipUtilizatorSalvat::Student ? TipUtilizator::Student : TipUtilizator::Profesor,
+            string(siruri[3 * i]), string(siruri[3 * i + 1]), siruri[3 * i + 2]);
+        if (penalizari[i] != 0) {
+            utilizator->adaugaPenalitate(penalizari[i]);
+        }
+        utilizatori.push_back(std::move(utilizator));
+    }
+
+    const auto inregistrari = snapshot.sectiune<InregistrareImprumut>(Sectiune::Imprumuturi);
+    imprumuturi.reserve(imprumuturi.size() + inregistrari.size());
+    for (size_t i = 0; i < inregistrari.size(); ++i) {
+        const auto& inregistrare = inregistrari[i];
+        if (inregistrare.idCarte >= biblioteca.getCarti().size() || inregistrare.indexUtilizator >= tipuri.size()) {
+            throw PersistentaException("Imprumut cu referinte invalide in snapshot");
+        }
+        auto imprumut = ImprumutFactory::creareImprumut(
+            biblioteca.getCarte(inregistrare.idCarte), *utilizatori[primulUtilizator + inregistrare.indexUtilizator],
+            DataZi(inregistrare.dataImprumut), DataZi(inregistrare.dataReturnare), inregistrare.id);
+        if (!imprumut) {
+            throw PersistentaException("Imprumut pentru o carte care nu se poate imprumuta");
+        }
+        imprumut->restaureazaPenalitateAplicata(inregistrare.penalitateAplicata);
+        biblioteca.restaureazaImprumut(imprumut, static_cast<uint8_t>(inregistrare.stare & 0xFF),
+                                       (inregistrare.stare & stareReturnat) != 0);
+        imprumuturi.push_back(std::move(imprumut));
+    }
+
+    jurnal.continuaDupa(snapshot.getSecventaJurnal());
+    return snapshot.getSecventaJurnal();
+}
+
+void Persistenta::reaplica(const Operatie& operatie, BibliotecaSingleton& biblioteca,
+                           vector<shared_ptr<Utilizator>>& utilizatori,
+                           vector<shared_ptr<ImprumutAbstract>>& imprumuturi) {
+    CititorOperatie cititor(operatie.continut);
+    switch (operatie.tip) {
+        case TipOperatie::CarteAdaugata:
+            biblioteca.adaugaCarte(carteDinOperatie(cititor));
+            break;
+        case TipOperatie::UtilizatorAdaugat: {
+            const string tip = cititor.citesteSir();
+            string nume = cititor.citesteSir();
+            string email = cititor.citesteSir();
+            const string facultateDepartament = cititor.citesteSir();
+            utilizatori.push_back(UtilizatorFactory::creareUtilizator(tip, std::move(nume), std::move(email), facultateDepartament));
+            break;
+        }
+        case TipOperatie::ImprumutCreat: {
+            const auto id = cititor.citeste<IdImprumut>();
+            const auto idCarte = cititor.citeste<IdCarte>();
+            const auto dataImprumut = DataZi(cititor.citeste<int32_t>());
+            const auto dataReturnare = DataZi(cititor.citeste<int32_t>());
+            const string email = cititor.citesteSir();
+            const auto utilizator = Utilizator::cautaUtilizator(email);
+            if (!utilizator || idCarte >= biblioteca.getCarti().size()) {
+                throw PersistentaException("Imprumut cu referinte invalide in jurnal");
+            }
+            // Aceleași verificări ca la creare, pe aceeași stare, deci același exemplar
+            adaugaImprumut(imprumuturi, biblioteca.imprumuta(idCarte, *utilizator, dataImprumut, dataReturnare, id));
+            break;
+        }
+        case TipOperatie::ImprumutReturnat: {
+            const auto id = cititor.citeste<IdImprumut>();
+            const auto imprumut = cautaImprumut(imprumuturi, id);
+            if (!imprumut) {
+                throw PersistentaException("Returnare pentru un imprumut inexistent in jurnal");
+            }
+            biblioteca.returneaza(*imprumut);
+            break;
+        }
+        case TipOperatie::ExemplareSetate: {
+            const auto idCarte = cititor.citeste<IdCarte>();
+            const auto numar = cititor.citeste<uint32_t>();
+            biblioteca.seteazaExemplare(idCarte, numar);
+            break;
+        }
+        case TipOperatie::PenalitatiAplicate: {
+            const auto data = DataZi(cititor.citeste<int32_t>());
+            const MotorPenalitati motor;
+            MotorPenalitati::aplica(imprumuturi, motor.calculeaza(imprumuturi, data));
+            break;
+        }
+        case TipOperatie::IntarzieriAvansate: {
+            // Planificatorul a primit aceleași împrumuturi, în aceeași ordine, deci expiră aceleași
+            auto& intarzieri = biblioteca.getIntarzieri();
+            intarzieri.avanseaza(DataZi(cititor.citeste<int32_t>()));
+            intarzieri.acumuleazaPenalitati();
+            break;
+        }
+        default:
+            throw PersistentaException("Operatie necunoscuta in jurnal");
+    }
+}
+
+size_t Persistenta::recupereaza(BibliotecaSingleton& biblioteca, vector<shared_ptr<Utilizator>>& utilizatori,
+                                vector<shared_ptr<ImprumutAbstract>>& imprumuturi) {
+    uint64_t secventaSnapshot = 0;
+    if (filesystem::exists(caleSnapshot)) {
+        secventaSnapshot = incarcaSnapshot(biblioteca, utilizatori, imprumuturi);
+    }
+
+    // Operațiile cu secvența cel mult cea a snapshot-ului sunt deja incluse în el
+    // (crash între rename-ul snapshot-ului și golirea jurnalului)
+    size_t reaplicate = 0;
+    for (const auto& operatie : jurnal.preiaRecuperate()) {
+        if (operatie.secventa > secventaSnapshot) {
+            reaplica(operatie, biblioteca, utilizatori, imprumuturi);
+            ++reaplicate;
+        }
+    }
+    return reaplicate;
+}
+
+void Persistenta::carteAdaugata(const CarteView& carte) {
+    ScriitorOperatie operatie;
+    operatie.scrie(carte.getTip())
+        .scrie(static_cast<int32_t>(carte.getAnPublicare()))
+        .scrie(static_cast<int32_t>(carte.getNumarPagini()))
+        .scrie(carte.getDimensiuneFisier())
+        .scrieSir(carte.getTitlu())
+        .scrieSir(carte.getAutor())
+        .scrieSir(carte.getTip() == TipCarte::Digitala ? carte.getFormat() : carte.getStareFizica());
+    jurnal.scrie(TipOperatie::CarteAdaugata, operatie.continut());
+}
+
+void Persistenta::utilizatorAdaugat(const Utilizator& utilizator) {
+    ScriitorOperatie operatie;
+    operatie.scrieSir(utilizator.getTipUtilizator())
+        .scrieSir(utilizator.getNume())
+        .scrieSir(utilizator.getEmail())
+        .scrieSir(utilizator.getFacultateDepartament());
+    jurnal.scrie(TipOperatie::UtilizatorAdaugat, operatie.continut());
+}
+
+void Persistenta::imprumutCreat(const ImprumutAbstract& imprumut) {
+    ScriitorOperatie operatie;
+    operatie.scrie(imprumut.getId())
+        .scrie(imprumut.getIdCarte())
+        .scrie(imprumut.getDataImprumut().getZile())
+        .scrie(imprumut.getDataReturnare().getZile())
+        .scrieSir(imprumut.getUtilizator().getEmail());
+    jurnal.scrie(TipOperatie::ImprumutCreat, operatie.continut());
+}
+
+void Persistenta::imprumutReturnat(const ImprumutAbstract& imprumut) {
+    ScriitorOperatie operatie;
+    operatie.scrie(imprumut.getId());
+    jurnal.scrie(TipOperatie::ImprumutReturnat, operatie.continut());
+}
+
+void Persistenta::exemplareSetate(IdCarte id, unsigned numar) {
+    ScriitorOperatie operatie;
+    operatie.scrie(id).scrie(static_cast<uint32_t>(numar));
+    jurnal.scrie(TipOperatie::ExemplareSetate, operatie.continut());
+}
+
+void Persistenta::penalitatiAplicate(DataZi data) {
+    ScriitorOperatie operatie;
+    operatie.scrie(data.getZile());
+    jurnal.scrie(TipOperatie::PenalitatiAplicate, operatie.continut());
+}
+
+void Persistenta::intarzieriAvansate(DataZi data) {
+    ScriitorOperatie operatie;
+    operatie.scrie(data.getZile());
+    jurnal.scrie(TipOperatie::IntarzieriAvansate, operatie.continut());
+}
+
+void Persistenta::salveaza(BibliotecaSingleton& biblioteca, const vector<shared_ptr<Utilizator>>& utilizatori,
+                           const vector<shared_ptr<ImprumutAbstract>>& imprumuturi) {
+    const string caleTemporara = caleSnapshot + ".tmp";
+    {
+        ScriitorSnapshot snapshot(caleTemporara);
+        biblioteca.salveaza(snapshot);
+
+        vector<TipUtilizatorSalvat> tipuri;
+        vector<double> penalizari;
+        ColoanaSiruri siruri;
+        unordered_map<const Utilizator*, uint32_t> indexUtilizator;
+        tipuri.reserve(utilizatori.size());
+        penalizari.reserve(utilizatori.size());
+        for (const auto& utilizator : utilizatori) {
+            indexUtilizator.emplace(utilizator.get(), static_cast<uint32_t>(tipuri.size()));
+            tipuri.push_back(utilizator->getTip() == TipUtilizator::Student ? TipUtilizatorSalvat::Student : TipUtilizatorSalvat::Profesor);
+            penalizari.push_back(utilizator->getPenalizari());
+            siruri.adauga(utilizator->getNume());
+            siruri.adauga(utilizator->getEmail());
+            siruri.adauga(utilizator->getFacultateDepartament());
+        }
+        snapshot.scrieSectiune(Sectiune::UtilizatoriTip, span<const TipUtilizatorSalvat>(tipuri));
+        snapshot.scrieSectiune(Sectiune::UtilizatoriPenalizari, span<const double>(penalizari));
+        snapshot.scrieSectiune(Sectiune::UtilizatoriSiruriInceputuri, siruri.getInceputuri());
+        snapshot.scrieSectiune(Sectiune::UtilizatoriSiruriCaractere, siruri.getCaractere());
+
+        vector<InregistrareImprumut> inregistrari;
+        inregistrari.reserve(imprumuturi.size());
+        for (const auto& imprumut : imprumuturi) {
+            const auto it = indexUtilizator.find(&imprumut->getUtilizator());
+            if (it == indexUtilizator.end()) {
+                throw PersistentaException("Imprumut al unui utilizator care nu este in lista");
+            }
+            inregistrari.push_back({imprumut->getId(), imprumut->getIdCarte(), it->second,
+                                    imprumut->getDataImprumut().getZile(), imprumut->getDataReturnare().getZile(),
+                                    imprumut->getExemplar() | (imprumut->esteReturnat() ? stareReturnat : 0), 0,
+                                    imprumut->getPenalitateAplicata()});
+        }
+        snapshot.scrieSectiune(Sectiune::Imprumuturi, span<const InregistrareImprumut>(inregistrari));
+
+        snapshot.finalizeaza(jurnal.getSecventa());
+    }
+
+    // Vechiul snapshot poate fi încă mapat: pe POSIX maparea rămâne validă după rename,
+    // iar pe Windows fișierul a fost citit în memorie
+    filesystem::rename(caleTemporara, caleSnapshot);
+    jurnal.goleste();
+}
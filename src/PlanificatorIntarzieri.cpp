@@ -0,0 +1,199 @@
+#include "PlanificatorIntarzieri.h"
+#include "Exceptii.h"
+#include "PoliticaPenalitati.h"
+
+#include <algorithm>
+#include <bit>
+
+using namespace std;
+
+namespace {
+
+constexpr int32_t mascaSlot = PlanificatorIntarzieri::sloturiPeNivel - 1;
+
+// Prima zi de întârziere
+int32_t expirare(const ImprumutAbstract& imprumut) {
+    return imprumut.getDataImprumut().getZile() + TabelPenalitati::curent().getZileGratie() + 1;
+}
+
+} // namespace
+
+PlanificatorIntarzieri::PlanificatorIntarzieri(DataZi inceput) : baza(inceput.getZile()) {}
+
+// Primul nivel pe care expirarea e în același interval cu baza; intervalele din urmă au fost deja
+// coborâte, deci sloturile ocupate de pe un nivel sunt toate după slotul bazei
+void PlanificatorIntarzieri::plaseaza(Intrare intrare) {
+    for (size_t nivel = 0; nivel < numarNiveluri; ++nivel) {
+        const unsigned deplasare = bitiNivel * static_cast<unsigned>(nivel);
+        if ((intrare.expirare >> (deplasare + bitiNivel)) == (baza >> (deplasare + bitiNivel))) {
+            const auto slot = static_cast<size_t>((intrare.expirare >> deplasare) & mascaSlot);
+            sloturi[nivel][slot].push_back(std::move(intrare));
+            ocupate[nivel] |= uint64_t{1} << slot;
+            return;
+        }
+    }
+    departe.push_back(std::move(intrare));
+    push_heap(departe.begin(), departe.end(), maiTarziu);
+}
+
+void PlanificatorIntarzieri::coboara(size_t nivel, size_t slot) {
+    if (!(ocupate[nivel] >> slot & 1)) {
+        return;
+    }
+    vector<Intrare> intrari = std::move(sloturi[nivel][slot]);
+    sloturi[nivel][slot].clear();
+    ocupate[nivel] &= ~(uint64_t{1} << slot);
+    for (auto& intrare : intrari) {
+        plaseaza(std::move(intrare));
+    }
+}
+
+void PlanificatorIntarzieri::coboaraLaInceputDeBloc() {
+    constexpr unsigned bitiRoata = bitiNivel * numarNiveluri;
+    if ((baza & ((1 << (2 * bitiNivel)) - 1)) == 0) {
+        if ((baza & ((1 << bitiRoata) - 1)) == 0) {
+            while (!departe.empty() && (departe.front().expirare >> bitiRoata) == (baza >> bitiRoata)) {
+                pop_heap(departe.begin(), departe.end(), maiTarziu);
+                Intrare intrare = std::move(departe.back());
+                departe.pop_back();
+                plaseaza(std::move(intrare));
+            }
+        }
+        coboara(2, static_cast<size_t>((baza >> (2 * bitiNivel)) & mascaSlot));
+    }
+    coboara(1, static_cast<size_t>((baza >> bitiNivel) & mascaSlot));
+}
+
+void PlanificatorIntarzieri::adauga(shared_ptr<ImprumutAbstract> imprumut) {
+    const int32_t zi = expirare(*imprumut);
+    const lock_guard<mutex> blocare(mutexRoata);
+    ++programate;
+    if (zi < baza) {
+        expirateDeja.push_back({zi, std::move(imprumut)});
+        return;
+    }
+    plaseaza({zi, std::move(imprumut)});
+}
+
+void PlanificatorIntarzieri::restaureazaCeas(DataZi ultimaZi, span<const IdImprumut> neraportate) {
+    const lock_guard<mutex> blocare(mutexRoata);
+    if (programate != 0 || !intarziate.empty()) {
+        throw ImprumutException("Ceasul intarzierilor se restaureaza doar cu roata goala");
+    }
+    baza = ultimaZi.getZile() + 1;
+    neraportateRestaurate.assign(neraportate.begin(), neraportate.end());
+    sort(neraportateRestaurate.begin(), neraportateRestaurate.end());
+}
+
+void PlanificatorIntarzieri::restaureaza(shared_ptr<ImprumutAbstract> imprumut) {
+    const int32_t zi = expirare(*imprumut);
+    {
+        const lock_guard<mutex> blocare(mutexRoata);
+        if (zi < baza && !binary_search(neraportateRestaurate.begin(), neraportateRestaurate.end(), imprumut->getId())) {
+            intarziate.push_back(std::move(imprumut));
+            return;
+        }
+    }
+    adauga(std::move(imprumut));
+}
+
+LotIntarzieri PlanificatorIntarzieri::avanseaza(DataZi data) {
+    const int32_t pana = data.getZile();
+    const lock_guard<mutex> blocare(mutexRoata);
+    if (pana < baza - 1) {
+        throw ImprumutException("Data " + data.toString() + " este inaintea ultimei avansari");
+    }
+    LotIntarzieri lot{data, {}};
+    const auto expira = [&](Intrare& intrare) {
+        --programate;
+        if (!intrare.imprumut->esteReturnat()) {
+            lot.imprumuturi.push_back(intrare.imprumut);
+            intarziate.push_back(std::move(intrare.imprumut));
+        }
+    };
+
+    sort(expirateDeja.begin(), expirateDeja.end(), [](const Intrare& a, const Intrare& b) { return maiTarziu(b, a); });
+    for (auto& intrare : expirateDeja) {
+        expira(intrare);
+    }
+    expirateDeja.clear();
+    neraportateRestaurate.clear();
+
+    while (baza <= pana) {
+        const int32_t inceputBloc = baza & ~mascaSlot;
+        const uint64_t ramase = ocupate[0] & (~uint64_t{0} << (baza & mascaSlot));
+        if (ramase == 0) {
+            // Nimic până la capătul intervalului; baza nu trece de pana + 1, ca o adăugare ulterioară
+            // cu expirarea în restul intervalului să nu fie socotită deja expirată
+            const int32_t urmatorulBloc = inceputBloc + mascaSlot + 1;
+            if (urmatorulBloc > pana + 1) {
+                baza = pana + 1;
+                break;
+            }
+            baza = urmatorulBloc;
+            coboaraLaInceputDeBloc();
+            continue;
+        }
+        const int32_t zi = inceputBloc + countr_zero(ramase);
+        if (zi > pana) {
+            baza = pana + 1;
+            break;
+        }
+        auto& slot = sloturi[0][static_cast<size_t>(zi & mascaSlot)];
+        for (auto& intrare : slot) {
+            expira(intrare);
+        }
+        slot.clear();
+        ocupate[0] &= ~(uint64_t{1} << (zi & mascaSlot));
+        baza = zi + 1;
+        if ((baza & mascaSlot) == 0) {
+            coboaraLaInceputDeBloc();
+        }
+    }
+    return lot;
+}
+
+AcumularePenalitati PlanificatorIntarzieri::acumuleazaPenalitati() {
+    const lock_guard<mutex> blocare(mutexRoata);
+    AcumularePenalitati rezultat{DataZi(baza - 1)};
+    size_t pastrate = 0;
+    for (size_t i = 0; i < intarziate.size(); ++i) {
+        auto& imprumut = *intarziate[i];
+        if (imprumut.esteReturnat()) {
+            continue;
+        }
+        const double penalitate = imprumut.calculeazaPenalitate(rezultat.data);
+        imprumut.aplicaPenalitate(penalitate);
+        rezultat.total += penalitate;
+        ++rezultat.imprumuturi;
+        intarziate[pastrate++] = std::move(intarziate[i]);
+    }
+    intarziate.resize(pastrate);
+    return rezultat;
+}
+
+DataZi PlanificatorIntarzieri::getData() const {
+    const lock_guard<mutex> blocare(mutexRoata);
+    return DataZi(baza - 1);
+}
+
+vector<IdImprumut> PlanificatorIntarzieri::getNeraportate() const {
+    const lock_guard<mutex> blocare(mutexRoata);
+    vector<IdImprumut> iduri;
+    for (const auto& intrare : expirateDeja) {
+        if (!intrare.imprumut->esteReturnat()) {
+            iduri.push_back(intrare.imprumut->getId());
+        }
+    }
+    return iduri;
+}
+
+size_t PlanificatorIntarzieri::numarProgramate() const {
+    const lock_guard<mutex> blocare(mutexRoata);
+    return programate;
+}
+
+size_t PlanificatorIntarzieri::numarIntarziate() const {
+    const lock_guard<mutex> blocare(mutexRoata);
+    return intarziate.size();
+}
@@ -0,0 +1,90 @@
+#include "PoliticaPenalitati.h"
+#include "Exceptii.h"
+
+#include <charconv>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+constinit TabelPenalitati TabelPenalitati::activ = TabelPenalitati::implicit();
+
+namespace {
+
+// Valorile care se potrivesc cu un câmp al regulii; "*" le dă pe toate
+template <typename T, size_t N>
+vector<T> potriviri(string_view camp, const array<pair<string_view, T>, N>& valori) {
+    vector<T> rezultat;
+    for (const auto& [nume, valoare] : valori) {
+        if (camp == "*" || camp == nume) {
+            rezultat.push_back(valoare);
+        }
+    }
+    return rezultat;
+}
+
+constexpr array<pair<string_view, TipCarte>, 3> tipuriCarte{
+    {{"Generica", TipCarte::Generica}, {"Fizica", TipCarte::Fizica}, {"Digitala", TipCarte::Digitala}}};
+constexpr array<pair<string_view, StareCarte>, 2> stari{{{"buna", StareCarte::Buna}, {"uzata", StareCarte::Uzata}}};
+constexpr array<pair<string_view, TipUtilizator>, 2> tipuriUtilizator{
+    {{"Student", TipUtilizator::Student}, {"Profesor", TipUtilizator::Profesor}}};
+
+template <typename T>
+bool numar(string_view text, T& valoare) {
+    const auto [ultim, eroare] = from_chars(text.data(), text.data() + text.size(), valoare);
+    return eroare == errc{} && ultim == text.data() + text.size() && valoare >= 0;
+}
+
+} // namespace
+
+TabelPenalitati TabelPenalitati::incarca(const string& cale) {
+    ifstream fisier(cale);
+    if (!fisier) {
+        throw ImportException("Fisierul de reguli " + cale + " nu poate fi deschis");
+    }
+    TabelPenalitati tabel = implicit();
+    string linie;
+    for (size_t numarLinie = 1; getline(fisier, linie); ++numarLinie) {
+        istringstream campuri(linie);
+        vector<string> cuvinte;
+        for (string cuvant; campuri >> cuvant;) {
+            cuvinte.push_back(std::move(cuvant));
+        }
+        if (cuvinte.empty() || cuvinte[0].starts_with('#')) {
+            continue;
+        }
+        const auto eroare = [&](const string& mesaj) {
+            return ImportException(cale + ":" + to_string(numarLinie) + ": " + mesaj);
+        };
+
+        if (cuvinte[0] == "gratie") {
+            int32_t zile = 0;
+            if (cuvinte.size() != 2 || !numar(cuvinte[1], zile)) {
+                throw eroare("se astepta 'gratie <zile>'");
+            }
+            tabel.seteazaZileGratie(zile);
+            continue;
+        }
+
+        double rata = 0;
+        if (cuvinte.size() != 4 || !numar(cuvinte[3], rata)) {
+            throw eroare("se astepta '<tip carte> <stare> <tip utilizator> <rata>'");
+        }
+        const auto tipuri = potriviri(cuvinte[0], tipuriCarte);
+        const auto stariPotrivite = potriviri(cuvinte[1], stari);
+        const auto utilizatori = potriviri(cuvinte[2], tipuriUtilizator);
+        if (tipuri.empty() || stariPotrivite.empty() || utilizatori.empty()) {
+            throw eroare("tip de carte, stare sau tip de utilizator necunoscut");
+        }
+        for (const auto tip : tipuri) {
+            for (const auto stare : stariPotrivite) {
+                for (const auto utilizator : utilizatori) {
+                    tabel.seteazaRata(tip, stare, utilizator, rata);
+                }
+            }
+        }
+    }
+    return tabel;
+}
@@ -0,0 +1,93 @@
+#include "PoolFire.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+
+// Pool-ul și coada firului curent, ca trimite() din interiorul unei sarcini să rămână local
+thread_local const PoolFire* poolCurent = nullptr;
+thread_local size_t coadaCurenta = 0;
+
+} // namespace
+
+PoolFire::PoolFire(unsigned numarFire) {
+    const unsigned numar = numarFire != 0 ? numarFire : max(1u, thread::hardware_concurrency());
+    cozi.reserve(numar);
+    for (unsigned i = 0; i < numar; ++i) {
+        cozi.push_back(make_unique<Coada>());
+    }
+    fire.reserve(numar);
+    for (unsigned i = 0; i < numar; ++i) {
+        fire.emplace_back(&PoolFire::lucreaza, this, i);
+    }
+}
+
+PoolFire::~PoolFire() {
+    {
+        const lock_guard<mutex> blocare(mutexSomn);
+        oprit = true;
+    }
+    somn.notify_all();
+    for (auto& fir : fire) {
+        fir.join();
+    }
+}
+
+void PoolFire::trimite(function<void()> sarcina) {
+    const size_t index = poolCurent == this ? coadaCurenta : urmatoareaCoada.fetch_add(1, memory_order_relaxed) % cozi.size();
+    // Contorul crește înainte ca sarcina să fie vizibilă: un fir care o ia imediat îl scade după,
+    // deci nu poate coborî sub zero. Cel mult, un fir trezit devreme mai caută o dată
+    inAsteptare.fetch_add(1, memory_order_release);
+    {
+        const lock_guard<mutex> blocare(cozi[index]->mutex);
+        cozi[index]->sarcini.push_back(std::move(sarcina));
+    }
+    // Blocarea, chiar goală, face ca un fir care tocmai a văzut inAsteptare == 0 să fie deja în wait
+    {
+        const lock_guard<mutex> blocare(mutexSomn);
+    }
+    somn.notify_one();
+}
+
+bool PoolFire::iaSarcina(size_t index, function<void()>& sarcina) {
+    {
+        auto& proprie = *cozi[index];
+        const lock_guard<mutex> blocare(proprie.mutex);
+        if (!proprie.sarcini.empty()) {
+            sarcina = std::move(proprie.sarcini.back());
+            proprie.sarcini.pop_back();
+            return true;
+        }
+    }
+    for (size_t pas = 1; pas < cozi.size(); ++pas) {
+        auto& victima = *cozi[(index + pas) % cozi.size()];
+        const lock_guard<mutex> blocare(victima.mutex);
+        if (!victima.sarcini.empty()) {
+            sarcina = std::move(victima.sarcini.front());
+            victima.sarcini.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void PoolFire::lucreaza(size_t index) {
+    poolCurent = this;
+    coadaCurenta = index;
+    function<void()> sarcina;
+    while (true) {
+        if (iaSarcina(index, sarcina)) {
+            inAsteptare.fetch_sub(1, memory_order_relaxed);
+            sarcina();
+            sarcina = nullptr;
+            continue;
+        }
+        unique_lock<mutex> blocare(mutexSomn);
+        somn.wait(blocare, [this] { return oprit || inAsteptare.load(memory_order_acquire) > 0; });
+        if (oprit && inAsteptare.load(memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
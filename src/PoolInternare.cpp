@@ -0,0 +1,35 @@
+#include "PoolInternare.h"
+
+#include <mutex>
+
+using namespace std;
+
+uint32_t PoolInternare::interneaza(string_view sir) {
+    {
+        const shared_lock blocare(mutex);
+        const auto it = iduri.find(sir);
+        if (it != iduri.end()) {
+            return it->second;
+        }
+    }
+    const unique_lock blocare(mutex);
+    // Alt fir poate să fi adăugat valoarea între cele două blocări
+    const auto it = iduri.find(sir);
+    if (it != iduri.end()) {
+        return it->second;
+    }
+    const auto id = static_cast<uint32_t>(valori.size());
+    iduri.emplace(valori.emplace_back(sir), id);
+    return id;
+}
+
+size_t PoolInternare::memorieOcupata() const {
+    const shared_lock blocare(mutex);
+    size_t octeti = valori.size() * sizeof(string) + iduri.size() * (sizeof(string_view) + sizeof(uint32_t) + 2 * sizeof(void*));
+    for (const auto& valoare : valori) {
+        if (valoare.capacity() > 15) {
+            octeti += valoare.capacity() + 1;
+        }
+    }
+    return octeti;
+}
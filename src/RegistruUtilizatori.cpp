@@ -0,0 +1,43 @@
+#include "RegistruUtilizatori.h"
+#include "Utilizator.h"
+
+#include <mutex>
+#include <utility>
+
+using namespace std;
+
+shared_ptr<Utilizator> RegistruUtilizatori::cauta(string_view email) const {
+    const auto cheieCautare = cheie(email);
+    const Shard& s = shard(cheieCautare);
+    shared_lock lock(s.mutex);
+    auto it = s.utilizatori.find(cheieCautare);
+    return it != s.utilizatori.end() ? it->second : nullptr;
+}
+
+bool RegistruUtilizatori::adauga(shared_ptr<Utilizator> utilizator) {
+    const string_view email = utilizator->getEmail(); // trăiește cât obiectul, adică cât intrarea din registru
+    Shard& s = shard(cheie(email));
+    unique_lock lock(s.mutex);
+    return s.utilizatori.try_emplace(email, std::move(utilizator)).second;
+}
+
+bool RegistruUtilizatori::sterge(string_view email) {
+    const auto cheieCautare = cheie(email);
+    Shard& s = shard(cheieCautare);
+    unique_lock lock(s.mutex);
+    auto it = s.utilizatori.find(cheieCautare);
+    if (it == s.utilizatori.end()) {
+        return false;
+    }
+    s.utilizatori.erase(it);
+    return true;
+}
+
+size_t RegistruUtilizatori::size() const {
+    size_t total = 0;
+    for (const auto& s : sharduri) {
+        shared_lock lock(s.mutex);
+        total += s.utilizatori.size();
+    }
+    return total;
+}
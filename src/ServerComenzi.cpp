@@ -0,0 +1,661 @@
+#include "ServerComenzi.h"
+#include "Analitice.h"
+#include "DataZi.h"
+#include "Exceptii.h"
+#include "Formatare.h"
+#include "Metrici.h"
+#include "MotorPenalitati.h"
+#include "Persistenta.h"
+
+#include <algorithm>
+#include <charconv>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <thread>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// Răspunsurile unei conexiuni: sosesc în orice ordine de la firele pool-ului și pleacă în ordinea
+// cererilor; tot ce e gata și consecutiv pleacă într-o singură scriere
+class ServerComenzi::Conexiune {
+private:
+    function<void(string_view)> scrie;
+    mutex mutexRaspunsuri;
+    condition_variable terminat;
+    map<uint64_t, string> gata;
+    uint64_t urmatorulRaspuns = 0;
+    uint64_t inregistrate = 0; // doar firul de citire
+
+public:
+    uint64_t ultimaScriere = 0; // secvența ultimei scrieri trimise; doar firul de citire
+
+    explicit Conexiune(function<void(string_view)> scrie) : scrie(std::move(scrie)) {}
+
+    uint64_t inregistreaza() { return inregistrate++; }
+
+    void raspunde(uint64_t pozitie, string raspuns) {
+        const lock_guard<mutex> blocare(mutexRaspunsuri);
+        gata.emplace(pozitie, std::move(raspuns));
+        string deTrimis;
+        for (auto it = gata.begin(); it != gata.end() && it->first == urmatorulRaspuns; it = gata.erase(it)) {
+            deTrimis += it->second;
+            deTrimis += '\n';
+            ++urmatorulRaspuns;
+        }
+        if (!deTrimis.empty()) {
+            scrie(deTrimis);
+            terminat.notify_all();
+        }
+    }
+
+    // Apelat de firul de citire, după ultima cerere
+    void asteaptaTot() {
+        unique_lock<mutex> blocare(mutexRaspunsuri);
+        terminat.wait(blocare, [this] { return urmatorulRaspuns == inregistrate; });
+    }
+};
+
+namespace {
+
+constexpr array<string_view, numarTipuriComanda> numeComenzi = {
+    "utilizator", "carte", "imprumut", "returnare", "exemplare", "aplicaPenalitati", "intarzieri",
+    "cauta", "prefix", "text", "cautaUtilizator", "penalitati", "metrici", "exportCarti", "topCarti", "statistici", "opreste", "necunoscuta"};
+
+TipComanda tipDinNume(string_view nume) {
+    for (size_t i = 0; i + 1 < numeComenzi.size(); ++i) {
+        if (numeComenzi[i] == nume) {
+            return static_cast<TipComanda>(i);
+        }
+    }
+    return TipComanda::Necunoscuta;
+}
+
+bool esteScriere(TipComanda tip) {
+    return tip <= TipComanda::AvanseazaIntarzieri;
+}
+
+// Citiri care văd doar o versiune fixată a catalogului și nu au nevoie de shared_mutex
+bool citesteVersiune(TipComanda tip) {
+    return tip == TipComanda::ExportaCarti;
+}
+
+void verificaCampuri(const vector<string>& campuri, size_t minim, size_t maxim) {
+    if (campuri.size() < minim || campuri.size() > maxim) {
+        throw ImprumutException("Numar de campuri invalid");
+    }
+}
+
+template <typename T>
+T numar(string_view text, string_view camp) {
+    T valoare{};
+    const auto [ultim, eroare] = from_chars(text.data(), text.data() + text.size(), valoare);
+    if (eroare != errc{} || ultim != text.data() + text.size()) {
+        throw ImprumutException("Valoare invalida pentru " + string(camp));
+    }
+    return valoare;
+}
+
+// Fișierele cerute de clienți ajung doar în <director de date>/exporturi: numele e o cale relativă,
+// fără "..", deci nu poate ieși din director și nici nu poate atinge snapshot-ul sau jurnalul
+filesystem::path caleExport(const Persistenta* persistenta, const string& nume) {
+    if (!persistenta) {
+        throw ImprumutException("Exporturile cer un director de date");
+    }
+    const filesystem::path relativa(nume);
+    if (relativa.empty() || relativa.has_root_name() || relativa.has_root_directory()
+        || any_of(relativa.begin(), relativa.end(), [](const filesystem::path& parte) { return parte == ".."; })) {
+        throw ImprumutException("Cale invalida: " + nume);
+    }
+    const auto cale = filesystem::path(persistenta->getDirector()) / "exporturi" / relativa;
+    filesystem::create_directories(cale.parent_path());
+    return cale;
+}
+
+void adaugaIntreg(string& rezultat, int64_t valoare) {
+    char tampon[24];
+    rezultat.append(tampon, to_chars(tampon, tampon + sizeof(tampon), valoare).ptr);
+}
+
+// Ca operator<< implicit al ostream: 6 cifre semnificative
+void adaugaReal(string& rezultat, double valoare) {
+    char tampon[32];
+    rezultat.append(tampon, to_chars(tampon, tampon + sizeof(tampon), valoare, chars_format::general, 6).ptr);
+}
+
+void adaugaCarte(string& rezultat, const CarteView& carte) {
+    rezultat += '\t';
+    adaugaIntreg(rezultat, carte.getId());
+    rezultat += '\t';
+    rezultat += carte.getTitlu();
+    rezultat += '\t';
+    rezultat += carte.getAutor();
+    rezultat += '\t';
+    adaugaIntreg(rezultat, carte.getAnPublicare());
+}
+
+// nume, număr, apoi medie și percentile în microsecunde, cu o zecimală
+string liniaStatistici(TipComanda tip, const HistogramaLatente& histograma) {
+    string linie(numeComenzi[static_cast<size_t>(tip)]);
+    linie += ' ';
+    adaugaIntreg(linie, static_cast<int64_t>(histograma.getNumar()));
+    const auto adaugaMicro = [&](double nanosecunde) {
+        char tampon[32];
+        linie += ' ';
+        linie.append(tampon, to_chars(tampon, tampon + sizeof(tampon), nanosecunde / 1000, chars_format::fixed, 1).ptr);
+    };
+    adaugaMicro(histograma.medie());
+    for (const double p : {0.5, 0.9, 0.99, 0.999}) {
+        adaugaMicro(static_cast<double>(histograma.percentila(p)));
+    }
+    adaugaMicro(static_cast<double>(histograma.getMaxim()));
+    return linie;
+}
+
+} // namespace
+
+ServerComenzi::ServerComenzi(BibliotecaSingleton& biblioteca, vector<shared_ptr<Utilizator>>& utilizatori,
+                             vector<shared_ptr<ImprumutAbstract>>& imprumuturi, Persistenta* persistenta, unsigned numarFire)
+    : biblioteca(biblioteca), utilizatori(utilizatori), imprumuturi(imprumuturi), persistenta(persistenta), pool(numarFire) {
+    // De aici încolo citirile nu mai actualizează nimic; fiecare lot de scrieri le aduce la zi
+    biblioteca.actualizeazaIndexuri();
+}
+
+void ServerComenzi::proceseazaLinie(const shared_ptr<Conexiune>& conexiune, string_view linie) {
+    if (!linie.empty() && linie.back() == '\r') {
+        linie.remove_suffix(1);
+    }
+    if (linie.empty()) {
+        return;
+    }
+    Cerere cerere{TipComanda::Necunoscuta, {}, conexiune, conexiune->inregistreaza(), chrono::steady_clock::now()};
+    const size_t tab = linie.find('\t');
+    cerere.tip = tipDinNume(linie.substr(0, tab));
+    for (size_t inceput = tab; inceput != string_view::npos;) {
+        const size_t urmator = linie.find('\t', inceput + 1);
+        cerere.campuri.emplace_back(linie.substr(inceput + 1, urmator - inceput - 1));
+        inceput = urmator;
+    }
+
+    if (cerere.tip == TipComanda::Opreste) {
+        opreste();
+        termina(cerere, "OK");
+    } else if (esteScriere(cerere.tip)) {
+        conexiune->ultimaScriere = adaugaScriere(std::move(cerere));
+    } else if (conexiune->ultimaScriere > scrieriAplicate.load(memory_order_acquire)) {
+        adaugaScriere(std::move(cerere));
+    } else {
+        pool.trimite([this, cerere = std::move(cerere)] {
+            string raspuns;
+            if (citesteVersiune(cerere.tip)) {
+                raspuns = executa(cerere);
+            } else {
+                const shared_lock<shared_mutex> blocare(mutexStare);
+                raspuns = executa(cerere);
+            }
+            termina(cerere, std::move(raspuns));
+        });
+    }
+}
+
+uint64_t ServerComenzi::adaugaScriere(Cerere cerere) {
+    const lock_guard<mutex> blocare(mutexScrieri);
+    scrieri.push_back(std::move(cerere));
+    if (!scriitorActiv) {
+        scriitorActiv = true;
+        pool.trimite([this] { aplicaScrieri(); });
+    }
+    return ++scrieriPrimite;
+}
+
+void ServerComenzi::aplicaScrieri() {
+    while (true) {
+        vector<Cerere> lot;
+        uint64_t ultima;
+        {
+            const lock_guard<mutex> blocare(mutexScrieri);
+            if (scrieri.empty()) {
+                scriitorActiv = false;
+                return;
+            }
+            lot.swap(scrieri);
+            ultima = scrieriPrimite;
+        }
+
+        vector<string> raspunsuri;
+        raspunsuri.reserve(lot.size());
+        {
+            const unique_lock<shared_mutex> blocare(mutexStare);
+            if (persistenta) {
+                persistenta->incepeLot();
+            }
+            for (const auto& cerere : lot) {
+                raspunsuri.push_back(executa(cerere));
+            }
+            biblioteca.actualizeazaIndexuri();
+            if (persistenta) {
+                try {
+                    persistenta->terminaLot();
+                } catch (const exception& ex) {
+                    // Operațiile sunt deja aplicate în memorie, deci răspunsurile lor rămân cele reale;
+                    // un snapshot le duce pe disc fără jurnal (și îl golește pe cel stricat)
+                    cerr << "Jurnalul nu a putut fi scris (" << ex.what() << "), salvez un snapshot\n";
+                    try {
+                        persistenta->salveaza(biblioteca, utilizatori, imprumuturi);
+                    } catch (const exception& exSnapshot) {
+                        cerr << "Nici snapshot-ul nu a putut fi salvat: " << exSnapshot.what() << '\n';
+                    }
+                }
+            }
+        }
+        scrieriAplicate.store(ultima, memory_order_release);
+        for (size_t i = 0; i < lot.size(); ++i) {
+            termina(lot[i], std::move(raspunsuri[i]));
+        }
+    }
+}
+
+void ServerComenzi::termina(const Cerere& cerere, string raspuns) {
+    const auto durata = chrono::steady_clock::now() - cerere.primire;
+    latente[static_cast<size_t>(cerere.tip)].inregistreaza(
+        static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(durata).count()));
+    cerere.conexiune->raspunde(cerere.pozitie, std::move(raspuns));
+}
+
+void ServerComenzi::opreste() {
+    oprit.store(true);
+#ifndef _WIN32
+    // Trezește accept() și citirile blocate; răspunsurile deja cerute pleacă în continuare
+    const lock_guard<mutex> blocare(mutexSocketuri);
+    if (socketAscultare >= 0) {
+        shutdown(socketAscultare, SHUT_RDWR);
+    }
+    for (const int socket : socketuriDeschise) {
+        shutdown(socket, SHUT_RD);
+    }
+#endif
+}
+
+string ServerComenzi::executa(const Cerere& cerere) {
+    try {
+        return esteScriere(cerere.tip) ? executaScriere(cerere) : executaCitire(cerere);
+    } catch (const exception& ex) {
+        return string("EROARE\t") + ex.what();
+    }
+}
+
+string ServerComenzi::executaScriere(const Cerere& cerere) {
+    const auto& c = cerere.campuri;
+    string raspuns = "OK";
+    switch (cerere.tip) {
+        case TipComanda::AdaugaUtilizator: {
+            verificaCampuri(c, 4, 4);
+            auto utilizator = UtilizatorFactory::creareUtilizator(c[0], c[1], c[2], c[3]);
+            utilizatori.push_back(utilizator);
+            if (persistenta) {
+                persistenta->utilizatorAdaugat(*utilizator);
+            }
+            break;
+        }
+        case TipComanda::AdaugaCarte: {
+            verificaCampuri(c, 6, 6);
+            const int an = numar<int>(c[3], "an");
+            shared_ptr<Carte> carte;
+            if (c[0] == "Fizica") {
+                carte = make_shared<CarteFizica>(c[1], c[2], an, numar<int>(c[4], "numarPagini"), c[5]);
+            } else if (c[0] == "Digitala") {
+                carte = make_shared<CarteDigitala>(c[1], c[2], an, numar<float>(c[4], "dimensiuneFisier"), c[5]);
+            } else {
+                throw ImprumutException("Tip carte necunoscut");
+            }
+            const IdCarte id = biblioteca.adaugaCarte(carte);
+            if (persistenta) {
+                persistenta->carteAdaugata(biblioteca.getCarte(id));
+            }
+            raspuns += '\t';
+            adaugaIntreg(raspuns, id);
+            break;
+        }
+        case TipComanda::Imprumuta: {
+            verificaCampuri(c, 4, 4);
+            const auto utilizator = Utilizator::cautaUtilizator(c[0]);
+            if (!utilizator) {
+                throw ImprumutException("Utilizatorul nu a fost gasit");
+            }
+            const auto intrare = biblioteca.cautaCarte(c[1]);
+            if (!intrare) {
+                throw ImprumutException("Cartea nu a fost gasita");
+            }
+            auto imprumut = biblioteca.imprumuta(intrare->id, *utilizator, DataZi::parseazaSauArunca(c[2]),
+                                                 DataZi::parseazaSauArunca(c[3]));
+            if (persistenta) {
+                persistenta->imprumutCreat(*imprumut);
+            }
+            raspuns += '\t';
+            adaugaIntreg(raspuns, imprumut->getId());
+            adaugaImprumut(imprumuturi, std::move(imprumut));
+            break;
+        }
+        case TipComanda::Returneaza: {
+            verificaCampuri(c, 1, 1);
+            auto* imprumut = cautaImprumut(imprumuturi, numar<IdImprumut>(c[0], "id"));
+            if (!imprumut) {
+                throw ImprumutException("Imprumutul nu a fost gasit");
+            }
+            if (!biblioteca.returneaza(*imprumut)) {
+                throw ImprumutException("Imprumutul a fost deja returnat");
+            }
+            if (persistenta) {
+                persistenta->imprumutReturnat(*imprumut);
+            }
+            break;
+        }
+        case TipComanda::SeteazaExemplare: {
+            verificaCampuri(c, 2, 2);
+            const auto intrare = biblioteca.cautaCarte(c[0]);
+            if (!intrare) {
+                throw ImprumutException("Cartea nu a fost gasita");
+            }
+            const auto exemplare = numar<unsigned>(c[1], "exemplare");
+            biblioteca.seteazaExemplare(intrare->id, exemplare);
+            if (persistenta) {
+                persistenta->exemplareSetate(intrare->id, exemplare);
+            }
+            break;
+        }
+        case TipComanda::AplicaPenalitati: {
+            verificaCampuri(c, 1, 1);
+            const DataZi data = DataZi::parseazaSauArunca(c[0]);
+            const MotorPenalitati motor;
+            const auto rezultat = motor.calculeaza(imprumuturi, data);
+            MotorPenalitati::aplica(imprumuturi, rezultat);
+            if (persistenta) {
+                persistenta->penalitatiAplicate(data);
+            }
+            raspuns += '\t';
+            adaugaReal(raspuns, rezultat.total);
+            raspuns += '\t';
+            adaugaIntreg(raspuns, static_cast<int64_t>(rezultat.imprumuturiIntarziate));
+            break;
+        }
+        case TipComanda::AvanseazaIntarzieri: {
+            // Răspuns: penalitățile acumulate, câte împrumuturi sunt întârziate, apoi id-urile celor
+            // care au devenit întârziate de la avansarea anterioară (lotul de notificări)
+            verificaCampuri(c, 1, 1);
+            const DataZi data = DataZi::parseazaSauArunca(c[0]);
+            auto& intarzieri = biblioteca.getIntarzieri();
+            const auto lot = intarzieri.avanseaza(data);
+            const auto acumulare = intarzieri.acumuleazaPenalitati();
+            if (persistenta) {
+                persistenta->intarzieriAvansate(data);
+            }
+            raspuns += '\t';
+            adaugaReal(raspuns, acumulare.total);
+            raspuns += '\t';
+            adaugaIntreg(raspuns, static_cast<int64_t>(acumulare.imprumuturi));
+            for (const auto& imprumut : lot.imprumuturi) {
+                raspuns += '\t';
+                adaugaIntreg(raspuns, static_cast<int64_t>(imprumut->getId()));
+            }
+            break;
+        }
+        default:
+            throw ImprumutException("Comanda necunoscuta");
+    }
+    return raspuns;
+}
+
+string ServerComenzi::executaCitire(const Cerere& cerere) {
+    const auto& c = cerere.campuri;
+    string raspuns = "OK";
+    const auto adaugaIntrari = [&](const auto& intrari, auto id) {
+        raspuns += '\t';
+        adaugaIntreg(raspuns, static_cast<int64_t>(intrari.size()));
+        for (const auto& intrare : intrari) {
+            adaugaCarte(raspuns, biblioteca.getCarte(id(intrare)));
+        }
+    };
+    switch (cerere.tip) {
+        case TipComanda::CautaCarte: {
+            verificaCampuri(c, 1, 1);
+            const auto intrare = biblioteca.cautaCarte(c[0]);
+            raspuns += intrare ? "\t1" : "\t0";
+            if (intrare) {
+                adaugaCarte(raspuns, biblioteca.getCarte(intrare->id));
+            }
+            break;
+        }
+        case TipComanda::CautaPrefix: {
+            verificaCampuri(c, 1, 2);
+            const size_t limita = c.size() > 1 ? numar<size_t>(c[1], "limita") : 20;
+            adaugaIntrari(biblioteca.cautaDupaPrefix(c[0], limita), [](const IntrareTitlu& intrare) { return intrare.id; });
+            break;
+        }
+        case TipComanda::CautaText: {
+            verificaCampuri(c, 1, 2);
+            const size_t k = c.size() > 1 ? numar<size_t>(c[1], "k") : 20;
+            adaugaIntrari(biblioteca.cautaText(c[0], k), [](const RezultatText& rezultat) { return rezultat.id; });
+            break;
+        }
+        case TipComanda::CautaUtilizator: {
+            verificaCampuri(c, 1, 1);
+            const auto utilizator = Utilizator::cautaUtilizator(c[0]);
+            raspuns += utilizator ? "\t1" : "\t0";
+            if (utilizator) {
+                for (const string_view camp : {string_view(utilizator->getNume()), string_view(utilizator->getEmail()),
+                                               utilizator->getTipUtilizator(), string_view(utilizator->getFacultateDepartament())}) {
+                    raspuns += '\t';
+                    raspuns += camp;
+                }
+                raspuns += '\t';
+                adaugaReal(raspuns, utilizator->getPenalizari());
+                raspuns += '\t';
+                adaugaIntreg(raspuns, utilizator->getImprumuturiActive());
+            }
+            break;
+        }
+        case TipComanda::Penalitati: {
+            verificaCampuri(c, 1, 1);
+            // Pe firul pool-ului, fără fire proprii: citirile concurente ocupă deja celelalte nuclee.
+            // Scrierea (AplicaPenalitati) ține blocarea exclusivă, deci acolo motorul poate folosi toată mașina
+            const auto rezultat = MotorPenalitati(1).calculeaza(imprumuturi, DataZi::parseazaSauArunca(c[0]));
+            raspuns += '\t';
+            adaugaReal(raspuns, rezultat.total);
+            raspuns += '\t';
+            adaugaIntreg(raspuns, static_cast<int64_t>(rezultat.imprumuturiIntarziate));
+            break;
+        }
+        case TipComanda::ExportaMetrici: {
+            verificaCampuri(c, 1, 1);
+            ofstream fisier(caleExport(persistenta, c[0]));
+            scrieMetriciPrometheus(fisier);
+            if (!fisier) {
+                throw ImprumutException("Fisierul " + c[0] + " nu poate fi scris");
+            }
+            break;
+        }
+        case TipComanda::ExportaCarti: {
+            // Răspuns: câte cărți au fost scrise și numărul versiunii de catalog exportate
+            verificaCampuri(c, 2, 2);
+            const auto format = formatListareDinNume(c[0]);
+            if (!format) {
+                throw ImprumutException("Format necunoscut: " + c[0]);
+            }
+            auto versiune = biblioteca.getVersiuneCatalog();
+            const size_t numarCarti = versiune->size();
+            const uint64_t numarVersiune = versiune->getNumarVersiune();
+            ofstream fisier(caleExport(persistenta, c[1]), ios::binary);
+            {
+                const auto formatator = Formatator::creeaza(*format);
+                IesireBufferata iesire(fisier, 1 << 20);
+                CursorCatalog(std::move(versiune), *formatator, iesire).scrieTot(64 * 1024);
+            }
+            if (!fisier) {
+                throw ImprumutException("Fisierul " + c[1] + " nu poate fi scris");
+            }
+            raspuns += '\t';
+            adaugaIntreg(raspuns, static_cast<int64_t>(numarCarti));
+            raspuns += '\t';
+            adaugaIntreg(raspuns, static_cast<int64_t>(numarVersiune));
+            break;
+        }
+        case TipComanda::TopCarti: {
+            // Răspuns: id, titlu și numărul estimat de împrumuturi, pentru fiecare carte, descrescător
+            verificaCampuri(c, 0, 1);
+            const size_t k = c.empty() ? 10 : numar<size_t>(c[0], "k");
+            for (const auto& frecventa : analitice.topCarti(k)) {
+                raspuns += '\t';
+                adaugaIntreg(raspuns, frecventa.id);
+                raspuns += '\t';
+                raspuns += biblioteca.getCarte(frecventa.id).getTitlu();
+                raspuns += '\t';
+                adaugaIntreg(raspuns, static_cast<int64_t>(frecventa.numar));
+            }
+            break;
+        }
+        case TipComanda::Statistici:
+            for (size_t i = 0; i < numarTipuriComanda; ++i) {
+                if (latente[i].getNumar() > 0) {
+                    raspuns += '\t';
+                    raspuns += liniaStatistici(static_cast<TipComanda>(i), latente[i]);
+                }
+            }
+            break;
+        default:
+            throw ImprumutException("Comanda necunoscuta");
+    }
+    return raspuns;
+}
+
+void ServerComenzi::servesteFlux(istream& intrare, ostream& iesire) {
+    const auto conexiune = make_shared<Conexiune>([&iesire](string_view text) {
+        iesire.write(text.data(), static_cast<streamsize>(text.size()));
+        iesire.flush();
+    });
+    string linie;
+    while (!oprit.load() && getline(intrare, linie)) {
+        proceseazaLinie(conexiune, linie);
+    }
+    conexiune->asteaptaTot();
+}
+
+#ifndef _WIN32
+
+void ServerComenzi::servesteConexiune(int socket) {
+    const auto conexiune = make_shared<Conexiune>([socket](string_view text) {
+        while (!text.empty()) {
+            const ssize_t trimisi = send(socket, text.data(), text.size(), MSG_NOSIGNAL);
+            if (trimisi < 0 && errno == EINTR) {
+                continue;
+            }
+            if (trimisi <= 0) {
+                return; // clientul a închis; răspunsurile rămase se pierd
+            }
+            text.remove_prefix(static_cast<size_t>(trimisi));
+        }
+    });
+    string tampon;
+    char bloc[64 * 1024];
+    while (!oprit.load()) {
+        const ssize_t cititi = read(socket, bloc, sizeof(bloc));
+        if (cititi < 0 && errno == EINTR) {
+            continue;
+        }
+        if (cititi <= 0) {
+            break;
+        }
+        tampon.append(bloc, static_cast<size_t>(cititi));
+        size_t inceput = 0;
+        for (size_t sfarsit; (sfarsit = tampon.find('\n', inceput)) != string::npos; inceput = sfarsit + 1) {
+            proceseazaLinie(conexiune, string_view(tampon).substr(inceput, sfarsit - inceput));
+        }
+        tampon.erase(0, inceput);
+    }
+    conexiune->asteaptaTot();
+    {
+        const lock_guard<mutex> blocare(mutexSocketuri);
+        socketuriDeschise.erase(socket);
+    }
+    close(socket);
+}
+
+void ServerComenzi::servesteSocket(const string& cale) {
+    sockaddr_un adresa{};
+    adresa.sun_family = AF_UNIX;
+    if (cale.size() >= sizeof(adresa.sun_path)) {
+        throw ServerException("Cale prea lunga pentru socket: " + cale);
+    }
+    cale.copy(adresa.sun_path, cale.size());
+
+    const int ascultare = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (ascultare < 0) {
+        throw ServerException("Nu pot crea socket-ul");
+    }
+    unlink(cale.c_str());
+    if (bind(ascultare, reinterpret_cast<const sockaddr*>(&adresa), sizeof(adresa)) != 0 || listen(ascultare, SOMAXCONN) != 0) {
+        close(ascultare);
+        throw ServerException("Nu pot asculta pe " + cale);
+    }
+    {
+        const lock_guard<mutex> blocare(mutexSocketuri);
+        socketAscultare = ascultare;
+    }
+
+    vector<thread> cititori;
+    while (!oprit.load()) {
+        const int socket = accept(ascultare, nullptr, nullptr);
+        if (socket < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            break; // inclusiv după opreste()
+        }
+        const lock_guard<mutex> blocare(mutexSocketuri);
+        if (oprit.load()) {
+            close(socket);
+            break;
+        }
+        socketuriDeschise.insert(socket);
+        cititori.emplace_back(&ServerComenzi::servesteConexiune, this, socket);
+    }
+    for (auto& cititor : cititori) {
+        cititor.join();
+    }
+    {
+        const lock_guard<mutex> blocare(mutexSocketuri);
+        socketAscultare = -1;
+    }
+    close(ascultare);
+    unlink(cale.c_str());
+}
+
+#else
+
+void ServerComenzi::servesteConexiune(int) {}
+
+void ServerComenzi::servesteSocket(const string&) {
+    throw ServerException("Socket-urile Unix nu sunt disponibile pe Windows; folositi modul stdin");
+}
+
+#endif
+
+void ServerComenzi::scrieStatistici(ostream& iesire) const {
+    iesire << "comanda numar medie_us p50_us p90_us p99_us p999_us max_us\n";
+    for (size_t i = 0; i < numarTipuriComanda; ++i) {
+        if (latente[i].getNumar() > 0) {
+            iesire << liniaStatistici(static_cast<TipComanda>(i), latente[i]) << '\n';
+        }
+    }
+}
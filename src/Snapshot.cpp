@@ -0,0 +1,116 @@
+#include "Snapshot.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+constexpr uint64_t aliniere = 64;
+
+} // namespace
+
+ScriitorSnapshot::ScriitorSnapshot(const string& cale) : fisier(fopen(cale.c_str(), "wb")), cale(cale) {
+    if (!fisier) {
+        throw PersistentaException("Nu pot crea " + cale);
+    }
+    const AntetSnapshot gol{};
+    scrieOcteti(&gol, sizeof(gol)); // completat la finalizare
+    pozitie = sizeof(AntetSnapshot);
+}
+
+ScriitorSnapshot::~ScriitorSnapshot() {
+    if (fisier) {
+        fclose(fisier);
+    }
+}
+
+void ScriitorSnapshot::scrieOcteti(const void* date, size_t dimensiune) {
+    if (dimensiune > 0 && fwrite(date, 1, dimensiune, fisier) != dimensiune) {
+        throw PersistentaException("Scriere esuata in " + cale);
+    }
+}
+
+void ScriitorSnapshot::scrieSectiune(Sectiune id, const void* date, size_t dimensiune) {
+    static constexpr byte zerouri[aliniere] = {};
+    const uint64_t umplutura = (aliniere - pozitie % aliniere) % aliniere;
+    scrieOcteti(zerouri, umplutura);
+    pozitie += umplutura;
+
+    tabel.push_back({id, 0, pozitie, dimensiune});
+    scrieOcteti(date, dimensiune);
+    pozitie += dimensiune;
+}
+
+void ScriitorSnapshot::finalizeaza(uint64_t secventaJurnal) {
+    static constexpr byte zerouri[aliniere] = {};
+    const uint64_t umplutura = (aliniere - pozitie % aliniere) % aliniere;
+    scrieOcteti(zerouri, umplutura);
+    pozitie += umplutura;
+
+    AntetSnapshot antet{};
+    memcpy(antet.magic, AntetSnapshot::magicAsteptat, sizeof(antet.magic));
+    antet.versiune = AntetSnapshot::versiuneCurenta;
+    antet.numarSectiuni = static_cast<uint32_t>(tabel.size());
+    antet.offsetTabel = pozitie;
+    antet.secventaJurnal = secventaJurnal;
+    scrieOcteti(tabel.data(), tabel.size() * sizeof(IntrareSectiune));
+
+    if (fseek(fisier, 0, SEEK_SET) != 0) {
+        throw PersistentaException("Nu pot scrie antetul in " + cale);
+    }
+    scrieOcteti(&antet, sizeof(antet));
+    if (fflush(fisier) != 0) {
+        throw PersistentaException("Scriere esuata in " + cale);
+    }
+#ifndef _WIN32
+    fsync(fileno(fisier));
+#endif
+    fclose(fisier);
+    fisier = nullptr;
+}
+
+CititorSnapshot::CititorSnapshot(const string& cale) : fisier(make_shared<const FisierMapat>(cale)) {
+    const auto continut = fisier->continut();
+    if (continut.size() < sizeof(AntetSnapshot)) {
+        throw PersistentaException("Snapshot trunchiat: " + cale);
+    }
+    antet = reinterpret_cast<const AntetSnapshot*>(continut.data());
+    if (memcmp(antet->magic, AntetSnapshot::magicAsteptat, sizeof(antet->magic)) != 0) {
+        throw PersistentaException("Fisierul nu este un snapshot: " + cale);
+    }
+    if (antet->versiune != AntetSnapshot::versiuneCurenta) {
+        throw PersistentaException("Versiune de snapshot nesuportata: " + to_string(antet->versiune));
+    }
+    const uint64_t dimensiuneTabel = uint64_t{antet->numarSectiuni} * sizeof(IntrareSectiune);
+    if (antet->offsetTabel > continut.size() || dimensiuneTabel > continut.size() - antet->offsetTabel) {
+        throw PersistentaException("Tabel de sectiuni invalid in " + cale);
+    }
+    tabel = {reinterpret_cast<const IntrareSectiune*>(continut.data() + antet->offsetTabel), antet->numarSectiuni};
+    for (const auto& intrare : tabel) {
+        if (intrare.offset > continut.size() || intrare.dimensiune > continut.size() - intrare.offset) {
+            throw PersistentaException("Sectiune in afara fisierului in " + cale);
+        }
+        // Secțiunile sunt citite ca tablouri de T direct din mapare
+        if (intrare.offset % aliniere != 0) {
+            throw PersistentaException("Sectiune nealiniata in " + cale);
+        }
+    }
+}
+
+bool CititorSnapshot::areSectiune(Sectiune id) const {
+    return any_of(tabel.begin(), tabel.end(), [id](const IntrareSectiune& intrare) { return intrare.id == id; });
+}
+
+span<const byte> CititorSnapshot::octeti(Sectiune id) const {
+    const auto it = find_if(tabel.begin(), tabel.end(), [id](const IntrareSectiune& intrare) { return intrare.id == id; });
+    if (it == tabel.end()) {
+        throw PersistentaException("Sectiune lipsa din snapshot: " + to_string(static_cast<uint32_t>(id)));
+    }
+    return fisier->continut().subspan(it->offset, it->dimensiune);
+}
@@ -0,0 +1,49 @@
+#include "Utilizator.h"
+#include "Analitice.h"
+#include "CatalogCarti.h"
+#include "Exceptii.h"
+#include "Formatare.h"
+
+#include <iostream>
+
+using namespace std;
+
+RegistruUtilizatori Utilizator::registruUtilizatori;
+PoolInternare Utilizator::facultatiDepartamente;
+
+void Utilizator::adaugaPenalitate(double suma) {
+    penalizari.fetch_add(suma, memory_order_relaxed);
+    analitice.penalitateAplicata(tipUtilizator, suma);
+}
+
+void Utilizator::afisare() const {
+    IesireBufferata iesire(cout);
+    FormatatorText().utilizator(iesire, *this);
+}
+
+void Utilizator::afiseazaIstoriculImprumuturilor(const CatalogCarti& catalog) const {
+    IesireBufferata iesire(cout);
+    FormatatorText formatator;
+    CursorIstoric(*this, catalog, formatator, iesire).scrieTot();
+}
+
+shared_ptr<Utilizator> UtilizatorFactory::creareUtilizator(TipUtilizator tip, string nume, string email, string_view facultateDepartament) {
+    shared_ptr<Utilizator> utilizator;
+    if (tip == TipUtilizator::Student) {
+        utilizator = make_shared<Student>(std::move(nume), std::move(email), facultateDepartament);
+    } else {
+        utilizator = make_shared<Profesor>(std::move(nume), std::move(email), facultateDepartament);
+    }
+    if (!Utilizator::getRegistru().adauga(utilizator)) {
+        throw ImprumutException("Exista deja un utilizator cu acest email!");
+    }
+    return utilizator;
+}
+
+shared_ptr<Utilizator> UtilizatorFactory::creareUtilizator(string_view tip, string nume, string email, string_view facultateDepartament) {
+    const auto tipUtilizator = tipUtilizatorDinText(tip);
+    if (!tipUtilizator) {
+        throw ImprumutException("Tip de utilizator necunoscut!");
+    }
+    return creareUtilizator(*tipUtilizator, std::move(nume), std::move(email), facultateDepartament);
+}
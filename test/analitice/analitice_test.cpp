@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "Analitice.h"
+#include "Utilizator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const DataZi ianuarie = DataZi::dinCalendar(2024, 1, 10);
+const DataZi februarie = DataZi::dinCalendar(2024, 2, 10);
+
+// Utilizatori cu emailuri distincte, fără registru: analiticele văd doar emailul și facultatea
+std::vector<std::unique_ptr<Student>> studenti(std::size_t numar, std::string_view facultate) {
+    std::vector<std::unique_ptr<Student>> rezultat;
+    for (std::size_t i = 0; i < numar; ++i) {
+        rezultat.push_back(std::make_unique<Student>("Student", "s" + std::to_string(i) + "@" + std::string(facultate), facultate));
+    }
+    return rezultat;
+}
+
+} // namespace
+
+TEST(SchitaFrecvente, GasesteCarteaFrecventa) {
+    SchitaFrecvente schita(16);
+    std::mt19937 rng(1);
+    for (int i = 0; i < 20'000; ++i) {
+        schita.adauga(i % 5 == 0 ? 42 : static_cast<IdCarte>(100 + rng() % 1000));
+    }
+    const auto top = schita.top(1);
+    ASSERT_EQ(top.size(), 1u);
+    EXPECT_EQ(top[0].id, 42u);
+    EXPECT_GE(top[0].numar, 4000u);
+    EXPECT_LE(top[0].numar - top[0].eroare, 4000u);
+}
+
+TEST(HyperLogLog, EstimeazaInMargineaErorii) {
+    constexpr std::size_t distincti = 20'000;
+    const auto utilizatori = studenti(distincti, "FMI");
+    AnaliticeImprumuturi agregate;
+    for (const auto& utilizator : utilizatori) {
+        agregate.imprumutCreat(1, *utilizator, ianuarie);
+    }
+    // Trei abateri standard: 3 * 1.04 / sqrt(2^12) pentru total, 3 * 1.04 / sqrt(2^10) pe lună
+    const auto estimare = static_cast<double>(agregate.cititoriDistincti());
+    EXPECT_NEAR(estimare, distincti, 0.05 * distincti);
+    const auto estimareLuna = static_cast<double>(agregate.cititoriDistinctiLuna(ianuarie.getIndexLuna()));
+    EXPECT_NEAR(estimareLuna, distincti, 0.1 * distincti);
+    EXPECT_EQ(agregate.cititoriDistinctiLuna(februarie.getIndexLuna()), 0u);
+}
+
+TEST(AnaliticeImprumuturi, AcelasiEmailNumaraOdata) {
+    AnaliticeImprumuturi agregate;
+    {
+        const Student student("Ana", "ana@test.ro", "FMI");
+        agregate.imprumutCreat(1, student, ianuarie);
+        agregate.imprumutCreat(2, student, februarie);
+    }
+    // Alt obiect, poate la aceeași adresă, dar același email
+    const Student recreat("Ana", "ana@test.ro", "FMI");
+    agregate.imprumutCreat(3, recreat, februarie);
+
+    EXPECT_EQ(agregate.numarImprumuturi(), 3u);
+    EXPECT_EQ(agregate.cititoriDistincti(), 1u);
+    EXPECT_EQ(agregate.cititoriDistinctiLuna(februarie.getIndexLuna()), 1u);
+}
+
+// Împrumuturi create din mai multe fire ajung în shard-uri diferite; citirile le combină
+TEST(AnaliticeImprumuturi, CombinaShardurileFirelor) {
+    constexpr int fire = 8;
+    constexpr int imprumuturiPeFir = 5000;
+    const auto fmi = studenti(50, "FMI");
+    const auto litere = studenti(50, "Litere");
+    AnaliticeImprumuturi agregate;
+
+    std::vector<std::jthread> lucratori;
+    for (int fir = 0; fir < fire; ++fir) {
+        lucratori.emplace_back([&, fir] {
+            std::mt19937 rng(static_cast<unsigned>(fir));
+            for (int i = 0; i < imprumuturiPeFir; ++i) {
+                const auto& utilizator = i % 2 == 0 ? *fmi[rng() % fmi.size()] : *litere[rng() % litere.size()];
+                const IdCarte carte = i % 4 == 0 ? 7 : static_cast<IdCarte>(1000 + rng() % 5000);
+                agregate.imprumutCreat(carte, utilizator, i < imprumuturiPeFir / 2 ? ianuarie : februarie);
+                agregate.penalitateAplicata(TipUtilizator::Student, 0.5);
+            }
+        });
+    }
+    lucratori.clear();
+
+    EXPECT_EQ(agregate.numarImprumuturi(), std::uint64_t{fire} * imprumuturiPeFir);
+    EXPECT_DOUBLE_EQ(agregate.penalitati(TipUtilizator::Student), 0.5 * fire * imprumuturiPeFir);
+    EXPECT_DOUBLE_EQ(agregate.penalitati(TipUtilizator::Profesor), 0);
+
+    const auto top = agregate.topCarti(1);
+    ASSERT_EQ(top.size(), 1u);
+    EXPECT_EQ(top[0].id, 7u);
+    EXPECT_GE(top[0].numar, std::uint64_t{fire} * imprumuturiPeFir / 4);
+    EXPECT_LE(top[0].numar - top[0].eroare, std::uint64_t{fire} * imprumuturiPeFir / 4);
+
+    // Câte un rând per lună și facultate, ordonate după lună, apoi după facultate
+    const auto randuri = agregate.peFacultatiSiLuni();
+    ASSERT_EQ(randuri.size(), 4u);
+    const std::uint64_t peRand = std::uint64_t{fire} * imprumuturiPeFir / 4;
+    const std::uint32_t idFmi = fmi.front()->getIdFacultateDepartament();
+    const std::uint32_t idLitere = litere.front()->getIdFacultateDepartament();
+    const auto [prima, aDoua] = std::minmax(idFmi, idLitere);
+    for (std::size_t i = 0; i < randuri.size(); ++i) {
+        EXPECT_EQ(randuri[i].luna, (i < 2 ? ianuarie : februarie).getIndexLuna());
+        EXPECT_EQ(randuri[i].idFacultateDepartament, i % 2 == 0 ? prima : aDoua);
+        EXPECT_EQ(randuri[i].numar, peRand);
+    }
+    EXPECT_NEAR(static_cast<double>(agregate.cititoriDistincti()), 100, 3);
+}
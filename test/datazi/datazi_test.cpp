@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+#include "DataZi.h"
+#include "Exceptii.h"
+
+#include <chrono>
+#include <string_view>
+
+TEST(DataZi, ParseazaDoarDateValide) {
+    EXPECT_EQ(DataZi::parseaza("1970-01-01"), DataZi(0));
+    EXPECT_EQ(DataZi::parseaza("2024-02-29"), DataZi::dinCalendar(2024, 2, 29));
+    EXPECT_TRUE(DataZi::parseaza("2000-02-29"));
+    for (const std::string_view invalida : {"2023-02-29", "1900-02-29", "2024-04-31", "2024-13-01", "2024-00-10", "2024-01-00",
+                                            "2024-1-01", "2024/01/01", "20a4-01-01", " 2024-01-01", "2024-01-011", ""}) {
+        EXPECT_FALSE(DataZi::parseaza(invalida)) << invalida;
+    }
+    EXPECT_THROW(DataZi::parseazaSauArunca("2024-02-30"), ImprumutException);
+}
+
+// Fiecare zi din două secole, față de calendarul din <chrono>
+TEST(DataZi, CoincideCuCalendarulStandard) {
+    using namespace std::chrono;
+    const sys_days inceput = year{1900} / January / 1;
+    const sys_days sfarsit = year{2100} / December / 31;
+    for (sys_days zi = inceput; zi <= sfarsit; zi += days{1}) {
+        const year_month_day calendar{zi};
+        const auto data = DataZi::dinCalendar(static_cast<int>(calendar.year()), static_cast<unsigned>(calendar.month()),
+                                              static_cast<unsigned>(calendar.day()));
+        ASSERT_EQ(data.getZile(), zi.time_since_epoch().count());
+        ASSERT_EQ(DataZi::parseaza(data.toString()), data) << data.toString();
+        ASSERT_EQ(data.getIndexLuna(), static_cast<int>(calendar.year()) * 12 + static_cast<int>(static_cast<unsigned>(calendar.month())) - 1);
+    }
+}
+
+TEST(DataZi, AritmeticaPesteLuniSiAni) {
+    const auto data = DataZi::dinCalendar(2024, 2, 28);
+    EXPECT_EQ((data + 1).toString(), "2024-02-29");
+    EXPECT_EQ((data + 2).toString(), "2024-03-01");
+    EXPECT_EQ((data + 2).getIndexLuna(), data.getIndexLuna() + 1);
+    EXPECT_EQ(DataZi::dinCalendar(2024, 1, 1) - DataZi::dinCalendar(2023, 12, 31), 1);
+    EXPECT_EQ(DataZi::dinCalendar(2024, 1, 1).getIndexLuna() - DataZi::dinCalendar(2023, 12, 31).getIndexLuna(), 1);
+    EXPECT_EQ(DataZi::dinCalendar(2025, 1, 1) - DataZi::dinCalendar(2024, 1, 1), 366);
+    EXPECT_LT(DataZi::dinCalendar(1969, 12, 31), DataZi(0));
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include "AlocatorIduri.h"
+#include "CatalogCarti.h"
+#include "Imprumut.h"
+#include "Utilizator.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t numarFire = 8;
+
+// Valorile date de `genereaza` pe fiecare fir, toate la un loc
+template <typename Genereaza>
+std::vector<IdImprumut> genereazaPeFire(std::size_t peFir, Genereaza genereaza) {
+    std::vector<std::vector<IdImprumut>> iduri(numarFire);
+    {
+        std::vector<std::jthread> fire;
+        for (std::size_t fir = 0; fir < numarFire; ++fir) {
+            fire.emplace_back([&, fir] {
+                iduri[fir].reserve(peFir);
+                for (std::size_t i = 0; i < peFir; ++i) {
+                    iduri[fir].push_back(genereaza(fir));
+                }
+            });
+        }
+    }
+    std::vector<IdImprumut> toate;
+    for (const auto& iduriFir : iduri) {
+        EXPECT_TRUE(std::is_sorted(iduriFir.begin(), iduriFir.end())); // crescătoare în cadrul firului
+        toate.insert(toate.end(), iduriFir.begin(), iduriFir.end());
+    }
+    std::sort(toate.begin(), toate.end());
+    return toate;
+}
+
+} // namespace
+
+TEST(AlocatorIduri, IduriUniceDinMaiMulteFire) {
+    constexpr std::size_t peFir = 100'000;
+    AlocatorIduri alocator;
+    const auto toate = genereazaPeFire(peFir, [&](std::size_t) { return alocator.genereaza(); });
+    ASSERT_EQ(toate.size(), numarFire * peFir);
+    EXPECT_EQ(std::adjacent_find(toate.begin(), toate.end()), toate.end());
+    EXPECT_GE(toate.front(), 1u);
+    // Fiecare fir a rezervat doar blocurile de care a avut nevoie, plus cel curent
+    EXPECT_LE(alocator.getPrimulLiber() - 1, numarFire * (peFir + AlocatorIduri::dimensiuneBloc));
+}
+
+// Un id restaurat, peste blocurile rezervate sau chiar în blocul curent al firului, nu mai e dat
+TEST(AlocatorIduri, NuRepetaIdurileRestaurate) {
+    AlocatorIduri alocator;
+    const auto primul = alocator.genereaza();
+    const std::vector<IdImprumut> restaurate{primul + 1, primul + 5000};
+    for (const auto id : restaurate) {
+        alocator.avanseazaDupa(id);
+    }
+    for (std::size_t i = 0; i < 10 * AlocatorIduri::dimensiuneBloc; ++i) {
+        const auto id = alocator.genereaza();
+        EXPECT_NE(id, primul);
+        EXPECT_EQ(std::find(restaurate.begin(), restaurate.end(), id), restaurate.end()) << id;
+    }
+}
+
+TEST(Imprumut, ImprumuturiCreateConcurentAuIduriUnice) {
+    constexpr std::size_t peFir = 5000;
+    CatalogCarti catalog;
+    const IdCarte carte = catalog.adauga(CarteFizica("Titlu", "Autor", 2000, 10, "buna"));
+    std::vector<std::unique_ptr<Student>> studenti;
+    for (std::size_t fir = 0; fir < numarFire; ++fir) {
+        studenti.push_back(std::make_unique<Student>("Student", "concurent" + std::to_string(fir) + "@test.ro", "FMI"));
+    }
+
+    const auto inainte = ImprumutAbstract::getNumarTotalImprumuturi();
+    const DataZi data = DataZi::dinCalendar(2024, 3, 1);
+    const auto toate = genereazaPeFire(peFir, [&](std::size_t fir) {
+        return ImprumutFactory::creareImprumut(catalog[carte], *studenti[fir], data, data + 14)->getId();
+    });
+    EXPECT_EQ(std::adjacent_find(toate.begin(), toate.end()), toate.end());
+    EXPECT_EQ(ImprumutAbstract::getNumarTotalImprumuturi() - inainte, numarFire * peFir);
+}
+
+// Aplicări concurente pe același împrumut: soldul utilizatorului ajunge exact la ultima penalitate
+TEST(Imprumut, PenalitateaAplicataConcurentNuSeDubleaza) {
+    CatalogCarti catalog;
+    const IdCarte carte = catalog.adauga(CarteFizica("Titlu", "Autor", 2000, 10, "buna"));
+    Student student("Student", "penalitate.concurenta@test.ro", "FMI");
+    const DataZi data = DataZi::dinCalendar(2024, 3, 1);
+    const auto imprumut = ImprumutFactory::creareImprumut(catalog[carte], student, data, data + 14);
+    {
+        std::vector<std::jthread> fire;
+        for (std::size_t fir = 0; fir < numarFire; ++fir) {
+            fire.emplace_back([&, fir] {
+                for (int i = 0; i < 10'000; ++i) {
+                    imprumut->aplicaPenalitate(static_cast<double>((i + fir) % 8));
+                }
+            });
+        }
+    }
+    EXPECT_DOUBLE_EQ(student.getPenalizari(), imprumut->getPenalitateAplicata());
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include "CatalogCarti.h"
+#include "IndexText.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+const std::vector<std::string> vocabular{"ion", "mara", "baltagul", "luceafarul", "amintiri", "moara", "noroc",
+                                         "padurea", "spanzuratilor", "enigma", "otiliei", "ciuleandra"};
+const std::vector<std::string> autori{"Liviu Rebreanu", "Ioan Slavici", "Mihail Sadoveanu", "Ion Creanga"};
+
+// BM25 calculat direct, pe toate cărțile, fără liste și fără salturi de bloc
+struct CatalogText {
+    CatalogCarti catalog;
+    IndexText index{catalog};
+    std::vector<std::map<std::string, int>> frecvente; // după id-ul cărții
+    std::vector<std::size_t> lungimi;
+    std::mt19937 rng{11};
+
+    void adaugaAleatoare(std::size_t numar) {
+        for (std::size_t i = 0; i < numar; ++i) {
+            std::string titlu;
+            // Cuvintele rare apar mai rar, ca listele să aibă lungimi foarte diferite
+            for (std::size_t cuvinte = 1 + rng() % 4; cuvinte > 0; --cuvinte) {
+                titlu += vocabular[std::min(rng() % vocabular.size(), rng() % vocabular.size())] + " ";
+            }
+            const std::string& autor = autori[rng() % autori.size()];
+            catalog.adauga(RandCarte{TipCarte::Fizica, titlu, autor, 2000, 100, 0, "buna"});
+
+            auto cuvinte = IndexText::cuvinte(titlu);
+            const auto cuvinteAutor = IndexText::cuvinte(autor);
+            cuvinte.insert(cuvinte.end(), cuvinteAutor.begin(), cuvinteAutor.end());
+            auto& frecventeCarte = frecvente.emplace_back();
+            for (const auto& cuvant : cuvinte) {
+                ++frecventeCarte[cuvant];
+            }
+            lungimi.push_back(cuvinte.size());
+        }
+    }
+
+    // Scorul fiecărei cărți care conține toate cuvintele
+    [[nodiscard]] std::vector<RezultatText> toate(const std::vector<std::string>& cuvinte) const {
+        const auto numarCarti = static_cast<double>(frecvente.size());
+        double lungimeMedie = 0;
+        for (const auto lungime : lungimi) {
+            lungimeMedie += static_cast<double>(lungime);
+        }
+        lungimeMedie = std::max(1.0, lungimeMedie / numarCarti);
+        std::vector<double> idf;
+        for (const auto& cuvant : cuvinte) {
+            double df = 0;
+            for (const auto& frecventeCarte : frecvente) {
+                df += frecventeCarte.contains(cuvant);
+            }
+            idf.push_back(std::log(1.0 + (numarCarti - df + 0.5) / (df + 0.5)));
+        }
+        std::vector<RezultatText> rezultat;
+        for (IdCarte id = 0; id < frecvente.size(); ++id) {
+            double scor = 0;
+            bool contine = true;
+            for (std::size_t j = 0; j < cuvinte.size() && contine; ++j) {
+                const auto it = frecvente[id].find(cuvinte[j]);
+                if (it == frecvente[id].end()) {
+                    contine = false;
+                    continue;
+                }
+                const auto tf = static_cast<double>(it->second);
+                const double normalizare = 1 - IndexText::b + IndexText::b * static_cast<double>(lungimi[id]) / lungimeMedie;
+                scor += idf[j] * tf * (IndexText::k1 + 1) / (tf + IndexText::k1 * normalizare);
+            }
+            if (contine) {
+                rezultat.push_back({id, static_cast<float>(scor)});
+            }
+        }
+        std::sort(rezultat.begin(), rezultat.end(), [](const RezultatText& a, const RezultatText& c) {
+            return a.scor > c.scor || (a.scor == c.scor && a.id < c.id);
+        });
+        return rezultat;
+    }
+
+    // Top-k din index față de referință; scorurile sunt float, deci egalitățile se compară cu toleranță
+    void verifica(const std::vector<std::string>& cuvinte, std::size_t k) const {
+        std::string text;
+        for (const auto& cuvant : cuvinte) {
+            text += cuvant + " ";
+        }
+        const auto asteptate = toate(cuvinte);
+        const auto gasite = index.cauta(text, k);
+        ASSERT_EQ(gasite.size(), std::min(k, asteptate.size())) << text;
+        constexpr float toleranta = 1e-4f;
+        for (std::size_t i = 0; i < gasite.size(); ++i) {
+            const auto it = std::find_if(asteptate.begin(), asteptate.end(),
+                                         [&](const RezultatText& r) { return r.id == gasite[i].id; });
+            ASSERT_NE(it, asteptate.end()) << text;
+            EXPECT_NEAR(gasite[i].scor, it->scor, toleranta) << text;
+            EXPECT_NEAR(gasite[i].scor, asteptate[i].scor, toleranta) << text << " locul " << i;
+            if (i > 0) {
+                EXPECT_GE(gasite[i - 1].scor, gasite[i].scor) << text;
+            }
+        }
+    }
+};
+
+} // namespace
+
+TEST(IndexText, NormalizeazaDiacriticeleSiMajusculele) {
+    EXPECT_EQ(IndexText::cuvinte("Ştefan cel MARE, ștefan—stefan!"),
+              (std::vector<std::string>{"stefan", "cel", "mare", "stefan", "stefan"}));
+    EXPECT_EQ(IndexText::cuvinte("Pădurea spânzuraților «Ţara»"),
+              (std::vector<std::string>{"padurea", "spanzuratilor", "tara"}));
+    EXPECT_TRUE(IndexText::cuvinte(" ,.; ").empty());
+}
+
+TEST(IndexText, TopKCoincideCuBm25CalculatDirect) {
+    CatalogText text;
+    text.adaugaAleatoare(3000); // liste de mai multe blocuri, ca salturile să fie exersate
+    text.index.actualizeaza();
+    for (int i = 0; i < 300; ++i) {
+        std::vector<std::string> cuvinte;
+        for (std::size_t numar = 1 + text.rng() % 3; cuvinte.size() < numar;) {
+            cuvinte.push_back(text.rng() % 4 ? vocabular[text.rng() % vocabular.size()] : "rebreanu");
+        }
+        std::sort(cuvinte.begin(), cuvinte.end());
+        cuvinte.erase(std::unique(cuvinte.begin(), cuvinte.end()), cuvinte.end());
+        text.verifica(cuvinte, 1 + text.rng() % 20);
+    }
+}
+
+TEST(IndexText, ActualizareaIncrementalaSchimbaScorurile) {
+    CatalogText text;
+    for (int lot = 0; lot < 4; ++lot) {
+        text.adaugaAleatoare(400);
+        text.index.actualizeaza();
+        text.verifica({"moara"}, 10);
+        text.verifica({"ion", "noroc"}, 5);
+    }
+}
+
+TEST(IndexText, CuvantNecunoscutNuGasesteNimic) {
+    CatalogText text;
+    text.adaugaAleatoare(100);
+    text.index.actualizeaza();
+    EXPECT_TRUE(text.index.cauta("ion necunoscut", 10).empty());
+    EXPECT_TRUE(text.index.cauta("ion", 0).empty());
+    EXPECT_TRUE(text.index.cauta("", 10).empty());
+}
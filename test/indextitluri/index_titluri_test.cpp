@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include "CatalogCarti.h"
+#include "IndexTitluri.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// Titluri scurte dintr-un alfabet mic, ca prefixele și titlurile egale să fie dese
+std::vector<std::string> genereazaTitluri(std::size_t numar, unsigned samanta) {
+    std::mt19937 rng(samanta);
+    std::vector<std::string> titluri;
+    for (std::size_t i = 0; i < numar; ++i) {
+        std::string titlu;
+        for (std::size_t lungime = 1 + rng() % 4; titlu.size() < lungime;) {
+            titlu += static_cast<char>('a' + rng() % 4);
+        }
+        titluri.push_back(std::move(titlu));
+    }
+    return titluri;
+}
+
+// Un catalog cu indexul lui, plus verificările față de ordinea calculată direct
+struct CatalogIndexat {
+    CatalogCarti catalog;
+    IndexTitluri index{catalog};
+
+    IdCarte adaugaInCatalog(std::string_view titlu) {
+        return catalog.adauga(RandCarte{TipCarte::Fizica, titlu, "Autor", 2000, 100, 0, "buna"});
+    }
+
+    // Toate cărțile, după (titlu, id)
+    [[nodiscard]] std::vector<IdCarte> referinta() const {
+        std::vector<IdCarte> iduri(catalog.size());
+        for (IdCarte id = 0; id < iduri.size(); ++id) {
+            iduri[id] = id;
+        }
+        std::sort(iduri.begin(), iduri.end(), [&](IdCarte a, IdCarte b) {
+            return catalog.titlu(a) != catalog.titlu(b) ? catalog.titlu(a) < catalog.titlu(b) : a < b;
+        });
+        return iduri;
+    }
+
+    [[nodiscard]] static std::vector<IdCarte> iduri(const std::vector<IntrareTitlu>& intrari) {
+        std::vector<IdCarte> rezultat;
+        for (const auto& intrare : intrari) {
+            rezultat.push_back(intrare.id);
+        }
+        return rezultat;
+    }
+
+    // Prefixe, intervale și pagini comparate cu ordinea de referință
+    void verificaOrdinea() const {
+        const auto toate = referinta();
+        const auto dupa = [&](auto conditie) {
+            std::vector<IdCarte> rezultat;
+            std::copy_if(toate.begin(), toate.end(), std::back_inserter(rezultat), conditie);
+            return rezultat;
+        };
+        for (const std::string_view prefix : {"", "a", "ab", "dd", "abc", "x"}) {
+            EXPECT_EQ(iduri(index.cautaPrefix(prefix, toate.size())),
+                      dupa([&](IdCarte id) { return catalog.titlu(id).starts_with(prefix); })) << "prefix " << prefix;
+        }
+        EXPECT_EQ(iduri(index.cautaInterval("b", "c", toate.size())),
+                  dupa([&](IdCarte id) { return catalog.titlu(id) >= "b" && catalog.titlu(id) < "c"; }));
+        EXPECT_EQ(iduri(index.cautaInterval("c", "", toate.size())), dupa([&](IdCarte id) { return catalog.titlu(id) >= "c"; }));
+
+        // Paginare cu cursorul pe carte: nimic sărit, nimic repetat, nici la titluri egale
+        std::vector<IdCarte> paginat;
+        for (auto pagina = index.paginaDupa(std::string_view{}, 7); !pagina.empty(); pagina = index.paginaDupa(pagina.back().id, 7)) {
+            const auto idPagina = iduri(pagina);
+            paginat.insert(paginat.end(), idPagina.begin(), idPagina.end());
+        }
+        EXPECT_EQ(paginat, toate);
+    }
+};
+
+} // namespace
+
+TEST(IndexTitluri, CautaPrimaCarteCuTitlul) {
+    CatalogIndexat indexat;
+    const auto titluri = genereazaTitluri(500, 1);
+    for (const auto& titlu : titluri) {
+        indexat.index.adauga(indexat.adaugaInCatalog(titlu));
+    }
+    for (IdCarte id = 0; id < indexat.catalog.size(); ++id) {
+        const auto gasita = indexat.index.cauta(indexat.catalog.titlu(id));
+        ASSERT_TRUE(gasita);
+        EXPECT_EQ(gasita->id, static_cast<IdCarte>(std::find(titluri.begin(), titluri.end(), titluri[id]) - titluri.begin()));
+    }
+    EXPECT_FALSE(indexat.index.cauta("inexistent"));
+}
+
+// Tamponul necompactat e interclasat cu secvența sortată la fiecare interogare
+TEST(IndexTitluri, InterogarileVadTamponul) {
+    CatalogIndexat indexat;
+    for (const auto& titlu : genereazaTitluri(300, 2)) {
+        indexat.index.adauga(indexat.adaugaInCatalog(titlu));
+    }
+    indexat.index.compacteaza();
+    for (const auto& titlu : genereazaTitluri(50, 3)) {
+        indexat.index.adauga(indexat.adaugaInCatalog(titlu));
+    }
+    indexat.verificaOrdinea();
+}
+
+// Loturile intră imediat în potrivirea exactă și în ordine la compactare, interclasate cu restul
+TEST(IndexTitluri, LoturileIntraInOrdineLaCompactare) {
+    CatalogIndexat indexat;
+    for (const auto& titlu : genereazaTitluri(200, 4)) {
+        indexat.index.adauga(indexat.adaugaInCatalog(titlu));
+    }
+    for (unsigned lot = 0; lot < 3; ++lot) {
+        const auto primul = static_cast<IdCarte>(indexat.catalog.size());
+        for (const auto& titlu : genereazaTitluri(150, 10 + lot)) {
+            indexat.adaugaInCatalog(titlu + "z"); // titluri noi, ca potrivirea exactă să găsească exact cartea din lot
+        }
+        indexat.index.adaugaLot(primul, static_cast<IdCarte>(indexat.catalog.size()));
+        const auto gasita = indexat.index.cauta(indexat.catalog.titlu(primul));
+        ASSERT_TRUE(gasita);
+        EXPECT_EQ(indexat.catalog.titlu(gasita->id), indexat.catalog.titlu(primul));
+    }
+    indexat.index.adauga(indexat.adaugaInCatalog("b"));
+    EXPECT_EQ(indexat.index.size(), indexat.catalog.size());
+
+    indexat.index.compacteaza();
+    indexat.verificaOrdinea();
+}
+
+TEST(IndexTitluri, ReconstruiesteAceeasiOrdine) {
+    CatalogIndexat indexat;
+    for (const auto& titlu : genereazaTitluri(400, 5)) {
+        indexat.adaugaInCatalog(titlu);
+    }
+    indexat.index.reconstruieste();
+    EXPECT_EQ(indexat.index.size(), indexat.catalog.size());
+    indexat.verificaOrdinea();
+}
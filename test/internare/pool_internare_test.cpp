@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include "PoolInternare.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(PoolInternare, AceeasiValoareAcelasiId) {
+    PoolInternare pool;
+    const auto fmi = pool.interneaza("FMI");
+    const auto drept = pool.interneaza("Drept");
+    EXPECT_EQ(fmi, 0u);
+    EXPECT_EQ(drept, 1u);
+    EXPECT_EQ(pool.interneaza(std::string("FM") + "I"), fmi);
+    EXPECT_EQ(pool.interneaza(""), 2u);
+    EXPECT_EQ(pool.size(), 3u);
+    EXPECT_EQ(pool[drept], "Drept");
+}
+
+// Referințele întoarse nu se mută când pool-ul crește
+TEST(PoolInternare, ReferinteleRamanValide) {
+    PoolInternare pool;
+    const std::string& prima = pool[pool.interneaza("o valoare destul de lunga cat sa nu fie SSO")];
+    const std::string* adresa = &prima;
+    for (int i = 0; i < 10000; ++i) {
+        pool.interneaza("valoare " + std::to_string(i));
+    }
+    EXPECT_EQ(&pool[0], adresa);
+    EXPECT_EQ(prima, "o valoare destul de lunga cat sa nu fie SSO");
+}
+
+// Fire care internează aceleași valori în ordini diferite primesc aceleași id-uri
+TEST(PoolInternare, InternareConcurenta) {
+    constexpr std::size_t numarFire = 8;
+    constexpr std::size_t numarValori = 500;
+    PoolInternare pool;
+    std::vector<std::vector<std::uint32_t>> iduri(numarFire, std::vector<std::uint32_t>(numarValori));
+    {
+        std::vector<std::jthread> fire;
+        for (std::size_t fir = 0; fir < numarFire; ++fir) {
+            fire.emplace_back([&, fir] {
+                std::vector<std::size_t> ordine(numarValori);
+                for (std::size_t i = 0; i < numarValori; ++i) {
+                    ordine[i] = i;
+                }
+                std::shuffle(ordine.begin(), ordine.end(), std::mt19937(static_cast<unsigned>(fir)));
+                for (int runda = 0; runda < 3; ++runda) {
+                    for (const std::size_t i : ordine) {
+                        iduri[fir][i] = pool.interneaza("facultatea " + std::to_string(i));
+                    }
+                }
+            });
+        }
+    }
+    EXPECT_EQ(pool.size(), numarValori);
+    for (std::size_t fir = 1; fir < numarFire; ++fir) {
+        EXPECT_EQ(iduri[fir], iduri[0]);
+    }
+    for (std::size_t i = 0; i < numarValori; ++i) {
+        ASSERT_LT(iduri[0][i], numarValori);
+        EXPECT_EQ(pool[iduri[0][i]], "facultatea " + std::to_string(i));
+    }
+}
@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+#include "CatalogCarti.h"
+#include "InterogareCarti.h"
+#include "MultimeBiti.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<std::size_t> elemente(const MultimeBiti& multime) {
+    std::vector<std::size_t> rezultat;
+    multime.pentruFiecare([&](std::size_t id) { rezultat.push_back(id); });
+    return rezultat;
+}
+
+// Ce s-a adăugat în catalog, ca să poată fi filtrat și ordonat direct
+struct RandReferinta {
+    TipCarte tip;
+    std::string titlu;
+    std::string autor;
+    std::int32_t an;
+    std::string detaliu;
+};
+
+const std::vector<std::string> autori{"Eminescu", "Creanga", "Slavici", "Rebreanu", "Sadoveanu"};
+const std::vector<std::string> formate{"PDF", "EPUB"};
+
+struct CatalogInterogat {
+    CatalogCarti catalog;
+    IndexCatalog index{catalog};
+    std::vector<RandReferinta> randuri;
+    std::mt19937 rng{7};
+
+    void adaugaAleatoare(std::size_t numar) {
+        for (std::size_t i = 0; i < numar; ++i) {
+            const auto tip = static_cast<TipCarte>(rng() % 3);
+            RandReferinta rand{tip, std::string(1, static_cast<char>('a' + rng() % 6)), autori[rng() % autori.size()],
+                               static_cast<std::int32_t>(1990 + rng() % 20), ""};
+            if (tip == TipCarte::Fizica) {
+                rand.detaliu = rng() % 2 ? "uzata" : "buna";
+            } else if (tip == TipCarte::Digitala) {
+                rand.detaliu = formate[rng() % formate.size()];
+            }
+            catalog.adauga(RandCarte{rand.tip, rand.titlu, rand.autor, rand.an, 100, 1.5f, rand.detaliu});
+            randuri.push_back(std::move(rand));
+        }
+    }
+
+    // Filtrare și ordonare prin scanarea tuturor rândurilor
+    [[nodiscard]] std::vector<IdCarte> referinta(const Interogare& interogare) const {
+        std::vector<IdCarte> gasite;
+        for (IdCarte id = 0; id < randuri.size(); ++id) {
+            const auto& rand = randuri[id];
+            if ((interogare.autor && rand.autor != *interogare.autor)
+                || (interogare.anMinim && rand.an < *interogare.anMinim)
+                || (interogare.anMaxim && rand.an > *interogare.anMaxim)
+                || (interogare.tip && rand.tip != *interogare.tip)
+                || (interogare.stareFizica && (rand.tip != TipCarte::Fizica || rand.detaliu != *interogare.stareFizica))
+                || (interogare.format && (rand.tip != TipCarte::Digitala || rand.detaliu != *interogare.format))) {
+                continue;
+            }
+            gasite.push_back(id);
+        }
+        const auto ordoneaza = [&](auto cheie) {
+            std::stable_sort(gasite.begin(), gasite.end(), [&](IdCarte a, IdCarte b) {
+                return interogare.descrescator ? cheie(b) < cheie(a) : cheie(a) < cheie(b);
+            });
+        };
+        switch (interogare.ordonare) {
+            case OrdonareCarti::Titlu:
+                ordoneaza([&](IdCarte id) { return randuri[id].titlu; });
+                break;
+            case OrdonareCarti::AnPublicare:
+                ordoneaza([&](IdCarte id) { return randuri[id].an; });
+                break;
+            case OrdonareCarti::Autor:
+                ordoneaza([&](IdCarte id) { return randuri[id].autor; });
+                break;
+            default:
+                if (interogare.descrescator) {
+                    std::reverse(gasite.begin(), gasite.end());
+                }
+        }
+        return gasite;
+    }
+
+    [[nodiscard]] Interogare aleatoare() {
+        Interogare interogare;
+        if (rng() % 3 == 0) {
+            interogare.autor = autori[rng() % autori.size()];
+        }
+        if (rng() % 3 == 0) {
+            interogare.anMinim = 1990 + static_cast<int>(rng() % 20);
+        }
+        if (rng() % 3 == 0) {
+            interogare.anMaxim = 1990 + static_cast<int>(rng() % 20);
+        }
+        if (rng() % 3 == 0) {
+            interogare.tip = static_cast<TipCarte>(rng() % 3);
+        }
+        switch (rng() % 4) {
+            case 0:
+                interogare.stareFizica = rng() % 2 ? "uzata" : "buna";
+                break;
+            case 1:
+                interogare.format = formate[rng() % formate.size()];
+                break;
+            default:
+                break;
+        }
+        interogare.ordonare = static_cast<OrdonareCarti>(rng() % 4);
+        interogare.descrescator = rng() % 2;
+        interogare.deplasament = rng() % 2 ? rng() % 50 : 0;
+        if (rng() % 2) {
+            interogare.limita = rng() % 30;
+        }
+        return interogare;
+    }
+
+    void verifica(std::size_t interogari) {
+        for (std::size_t i = 0; i < interogari; ++i) {
+            const Interogare interogare = aleatoare();
+            const auto asteptate = referinta(interogare);
+            const auto rezultat = index.executa(interogare);
+            ASSERT_EQ(rezultat.total, asteptate.size()) << "interogarea " << i;
+            const std::size_t inceput = std::min(interogare.deplasament, asteptate.size());
+            const std::size_t sfarsit = inceput + std::min(interogare.limita, asteptate.size() - inceput);
+            ASSERT_EQ(rezultat.carti, std::vector<IdCarte>(asteptate.begin() + static_cast<std::ptrdiff_t>(inceput),
+                                                           asteptate.begin() + static_cast<std::ptrdiff_t>(sfarsit)))
+                << "interogarea " << i;
+        }
+    }
+};
+
+} // namespace
+
+TEST(MultimeBiti, SeteazaSiParcurgeCrescator) {
+    MultimeBiti multime;
+    for (const std::size_t id : {130u, 5u, 64u, 5u, 63u, 0u}) {
+        multime.seteaza(id);
+    }
+    EXPECT_EQ(multime.size(), 5u);
+    EXPECT_TRUE(multime.contine(64));
+    EXPECT_FALSE(multime.contine(65));
+    EXPECT_FALSE(multime.contine(100000));
+    EXPECT_EQ(elemente(multime), (std::vector<std::size_t>{0, 5, 63, 64, 130}));
+}
+
+TEST(MultimeBiti, PlinaNuDepasesteNumarulDeBiti) {
+    for (const std::size_t numarBiti : {0u, 1u, 63u, 64u, 65u, 200u}) {
+        const auto multime = MultimeBiti::plina(numarBiti);
+        EXPECT_EQ(multime.size(), numarBiti);
+        const auto iduri = elemente(multime);
+        ASSERT_EQ(iduri.size(), numarBiti);
+        EXPECT_TRUE(iduri.empty() || iduri.back() == numarBiti - 1);
+        EXPECT_FALSE(multime.contine(numarBiti));
+    }
+}
+
+TEST(MultimeBiti, IntersectieCuLungimiDiferite) {
+    std::mt19937 rng(3);
+    for (int runda = 0; runda < 50; ++runda) {
+        MultimeBiti a, b;
+        std::set<std::size_t> setA, setB;
+        for (int i = 0; i < 100; ++i) {
+            const std::size_t idA = rng() % 500, idB = rng() % (runda % 2 ? 100 : 1000);
+            a.seteaza(idA);
+            b.seteaza(idB);
+            setA.insert(idA);
+            setB.insert(idB);
+        }
+        std::vector<std::size_t> asteptate;
+        std::set_intersection(setA.begin(), setA.end(), setB.begin(), setB.end(), std::back_inserter(asteptate));
+        a.intersecteaza(b);
+        EXPECT_EQ(elemente(a), asteptate);
+        EXPECT_EQ(a.size(), asteptate.size());
+    }
+}
+
+TEST(InterogareCarti, RezultateleCoincidCuScanareaCatalogului) {
+    CatalogInterogat interogat;
+    interogat.adaugaAleatoare(600);
+    interogat.index.actualizeaza();
+    interogat.verifica(2000);
+}
+
+TEST(InterogareCarti, ActualizareaIncrementalaVedeCartileNoi) {
+    CatalogInterogat interogat;
+    for (int lot = 0; lot < 5; ++lot) {
+        interogat.adaugaAleatoare(150);
+        interogat.index.actualizeaza();
+        interogat.verifica(300);
+    }
+}
+
+TEST(InterogareCarti, AlegeIndexulCelMaiSelectiv) {
+    CatalogCarti catalog;
+    IndexCatalog index(catalog);
+    for (int i = 0; i < 100; ++i) {
+        catalog.adauga(RandCarte{TipCarte::Fizica, "t", i < 3 ? "Rar" : "Des", 2000 + i % 10, 100, 0, "buna"});
+        catalog.adauga(RandCarte{TipCarte::Digitala, "t", "Des", 2000 + i % 10, 0, 2.0f, i < 2 ? "EPUB" : "PDF"});
+    }
+    index.actualizeaza();
+
+    EXPECT_EQ(index.executa({}).sursa, SursaInterogare::Catalog);
+    EXPECT_EQ(index.executa({}).total, 200u);
+
+    Interogare autor;
+    autor.autor = "Rar";
+    autor.anMinim = 2000;
+    EXPECT_EQ(index.executa(autor).sursa, SursaInterogare::Autor);
+    EXPECT_EQ(index.executa(autor).total, 3u);
+
+    Interogare an;
+    an.anMinim = 2004;
+    an.anMaxim = 2004;
+    an.autor = "Des";
+    EXPECT_EQ(index.executa(an).sursa, SursaInterogare::Ani);
+
+    Interogare format;
+    format.format = "EPUB";
+    format.autor = "Des";
+    EXPECT_EQ(index.executa(format).sursa, SursaInterogare::MultimiBiti);
+    EXPECT_EQ(index.executa(format).carti, (std::vector<IdCarte>{1, 3}));
+
+    Interogare necunoscut;
+    necunoscut.autor = "Nimeni";
+    EXPECT_EQ(index.executa(necunoscut).sursa, SursaInterogare::Nimic);
+    EXPECT_EQ(index.executa(necunoscut).total, 0u);
+
+    Interogare contradictoriu;
+    contradictoriu.stareFizica = "buna";
+    contradictoriu.format = "PDF";
+    EXPECT_EQ(index.executa(contradictoriu).total, 0u);
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include "CatalogCarti.h"
+#include "Exceptii.h"
+#include "Inventar.h"
+#include "Utilizator.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Catalogul cu câte o carte din fiecare tip și inventarul lui
+struct InventarCatalog {
+    CatalogCarti catalog;
+    Inventar inventar{catalog};
+    IdCarte fizica = catalog.adauga(RandCarte{TipCarte::Fizica, "Ion", "Liviu Rebreanu", 1920, 400, 0, "buna"});
+    IdCarte digitala = catalog.adauga(RandCarte{TipCarte::Digitala, "Mara", "Ioan Slavici", 1906, 0, 2.5f, "PDF"});
+    IdCarte generica = catalog.adauga(RandCarte{TipCarte::Generica, "Amintiri", "Ion Creanga", 1892, 0, 0, ""});
+
+    InventarCatalog() { inventar.actualizeaza(); }
+};
+
+std::vector<std::unique_ptr<Utilizator>> profesori(std::size_t numar) {
+    std::vector<std::unique_ptr<Utilizator>> rezultat;
+    for (std::size_t i = 0; i < numar; ++i) {
+        rezultat.push_back(std::make_unique<Profesor>("Profesor", "p" + std::to_string(i) + "@test.ro", "Info"));
+    }
+    return rezultat;
+}
+
+} // namespace
+
+TEST(Inventar, ImprumutulIaCelMaiMicExemplarDePeRaft) {
+    InventarCatalog biblioteca;
+    auto& inventar = biblioteca.inventar;
+    const IdCarte id = biblioteca.fizica;
+    Student student("Ana", "ana@test.ro", "FMI");
+    EXPECT_EQ(inventar.exemplare(id), 1u);
+
+    inventar.seteazaExemplare(id, 3);
+    EXPECT_EQ(inventar.imprumuta(id, student), 0);
+    EXPECT_EQ(inventar.imprumuta(id, student), 1);
+    EXPECT_EQ(inventar.detinator(id, 1), &student);
+    EXPECT_EQ(inventar.disponibile(id), 1u);
+    EXPECT_EQ(student.getImprumuturiActive(), 2);
+
+    inventar.returneaza(id, 0, student);
+    EXPECT_EQ(inventar.detinator(id, 0), nullptr);
+    EXPECT_EQ(student.getImprumuturiActive(), 1);
+    EXPECT_EQ(inventar.imprumuta(id, student), 0);
+    EXPECT_EQ(inventar.imprumuta(id, student), 2);
+
+    // Fără exemplare pe raft: excepție, iar locul din limită nu rămâne ocupat
+    EXPECT_THROW(inventar.imprumuta(id, student), ImprumutException);
+    EXPECT_EQ(student.getImprumuturiActive(), 3);
+    EXPECT_EQ(inventar.disponibile(id), 0u);
+}
+
+TEST(Inventar, LimitaSiTipulCartii) {
+    InventarCatalog biblioteca;
+    auto& inventar = biblioteca.inventar;
+    Student student("Ana", "ana@test.ro", "FMI");
+
+    EXPECT_THROW(inventar.imprumuta(biblioteca.generica, student), ImprumutException);
+    for (int i = 0; i < student.limitaImprumuturi(); ++i) {
+        EXPECT_EQ(inventar.imprumuta(biblioteca.digitala, student), Inventar::faraExemplar);
+    }
+    EXPECT_THROW(inventar.imprumuta(biblioteca.digitala, student), ImprumutException);
+    EXPECT_THROW(inventar.imprumuta(biblioteca.fizica, student), ImprumutException);
+    EXPECT_EQ(inventar.disponibile(biblioteca.fizica), 1u); // limita e verificată înainte de raft
+
+    inventar.returneaza(biblioteca.digitala, Inventar::faraExemplar, student);
+    EXPECT_EQ(inventar.imprumuta(biblioteca.fizica, student), 0);
+}
+
+TEST(Inventar, SeteazaExemplare) {
+    InventarCatalog biblioteca;
+    auto& inventar = biblioteca.inventar;
+    const IdCarte id = biblioteca.fizica;
+    Student student("Ana", "ana@test.ro", "FMI");
+
+    EXPECT_THROW(inventar.seteazaExemplare(biblioteca.digitala, 2), ImprumutException);
+    EXPECT_THROW(inventar.seteazaExemplare(id, Inventar::maximExemplare + 1), ImprumutException);
+    inventar.seteazaExemplare(id, Inventar::maximExemplare);
+    EXPECT_EQ(inventar.disponibile(id), Inventar::maximExemplare);
+
+    inventar.seteazaExemplare(id, 4);
+    EXPECT_EQ(inventar.imprumuta(id, student), 0);
+    EXPECT_EQ(inventar.imprumuta(id, student), 1);
+    // Exemplarul 1 e împrumutat, deci nu poate fi scos
+    EXPECT_THROW(inventar.seteazaExemplare(id, 1), ImprumutException);
+    EXPECT_EQ(inventar.exemplare(id), 4u);
+    EXPECT_EQ(inventar.disponibile(id), 2u);
+    inventar.seteazaExemplare(id, 2);
+    EXPECT_EQ(inventar.disponibile(id), 0u);
+    EXPECT_EQ(inventar.exemplarePerCarte(), (std::vector<std::uint8_t>{2, 0, 0}));
+}
+
+// Mai multe fire golesc același raft: fiecare exemplar ajunge la un singur utilizator
+TEST(Inventar, ImprumuturiConcurenteNuDauAcelasiExemplarDeDouaOri) {
+    constexpr std::size_t numarFire = 8;
+    InventarCatalog biblioteca;
+    auto& inventar = biblioteca.inventar;
+    const IdCarte id = biblioteca.fizica;
+    inventar.seteazaExemplare(id, Inventar::maximExemplare);
+    const auto utilizatori = profesori(numarFire);
+
+    std::vector<std::vector<std::uint8_t>> luate(numarFire);
+    {
+        std::vector<std::jthread> fire;
+        for (std::size_t fir = 0; fir < numarFire; ++fir) {
+            fire.emplace_back([&, fir] {
+                for (int i = 0; i < utilizatori[fir]->limitaImprumuturi(); ++i) {
+                    try {
+                        luate[fir].push_back(inventar.imprumuta(id, *utilizatori[fir]));
+                    } catch (const ImprumutException&) {
+                    }
+                }
+            });
+        }
+    }
+    std::vector<int> dat(Inventar::maximExemplare, 0);
+    std::size_t total = 0;
+    for (std::size_t fir = 0; fir < numarFire; ++fir) {
+        for (const auto exemplar : luate[fir]) {
+            ASSERT_LT(exemplar, Inventar::maximExemplare);
+            ++dat[exemplar];
+            EXPECT_EQ(inventar.detinator(id, exemplar), utilizatori[fir].get());
+        }
+        total += luate[fir].size();
+    }
+    EXPECT_EQ(total, Inventar::maximExemplare);
+    for (const int numar : dat) {
+        EXPECT_EQ(numar, 1);
+    }
+    EXPECT_EQ(inventar.disponibile(id), 0u);
+}
+
+// Împrumut și returnare în buclă pe aceeași carte, din mai multe fire
+TEST(Inventar, ImprumutSiReturnareConcurenteLasaRaftulPlin) {
+    constexpr std::size_t numarFire = 8;
+    constexpr unsigned exemplare = 6; // mai puține decât firele, ca raftul gol să fie des întâlnit
+    InventarCatalog biblioteca;
+    auto& inventar = biblioteca.inventar;
+    const IdCarte id = biblioteca.fizica;
+    inventar.seteazaExemplare(id, exemplare);
+    const auto utilizatori = profesori(numarFire);
+
+    std::atomic<std::size_t> detinatoriGresiti{0};
+    std::atomic<std::size_t> imprumuturi{0};
+    {
+        std::vector<std::jthread> fire;
+        for (std::size_t fir = 0; fir < numarFire; ++fir) {
+            fire.emplace_back([&, fir] {
+                auto& utilizator = *utilizatori[fir];
+                for (int i = 0; i < 20000; ++i) {
+                    try {
+                        const auto exemplar = inventar.imprumuta(id, utilizator);
+                        imprumuturi.fetch_add(1, std::memory_order_relaxed);
+                        if (exemplar >= exemplare || inventar.detinator(id, exemplar) != &utilizator) {
+                            detinatoriGresiti.fetch_add(1, std::memory_order_relaxed);
+                        }
+                        inventar.returneaza(id, exemplar, utilizator);
+                    } catch (const ImprumutException&) {
+                    }
+                }
+            });
+        }
+    }
+    EXPECT_GT(imprumuturi.load(), 0u);
+    EXPECT_EQ(detinatoriGresiti.load(), 0u);
+    EXPECT_EQ(inventar.disponibile(id), exemplare);
+    for (unsigned exemplar = 0; exemplar < exemplare; ++exemplar) {
+        EXPECT_EQ(inventar.detinator(id, static_cast<std::uint8_t>(exemplar)), nullptr);
+    }
+    for (const auto& utilizator : utilizatori) {
+        EXPECT_EQ(utilizator->getImprumuturiActive(), 0);
+    }
+}
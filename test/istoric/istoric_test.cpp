@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include "IstoricImprumuturi.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+const DataZi inceput = DataZi::dinCalendar(2020, 1, 1);
+
+// Împrumuturi cu date crescătoare (uneori în aceeași zi), durate și cărți variate
+std::vector<IstoricImprumut> genereaza(std::size_t numar, unsigned samanta) {
+    std::mt19937 rng(samanta);
+    std::vector<IstoricImprumut> rezultat;
+    DataZi data = inceput;
+    for (std::size_t i = 0; i < numar; ++i) {
+        data = data + static_cast<std::int32_t>(rng() % 4);
+        const auto idCarte = static_cast<IdCarte>(rng() % 100'000);
+        rezultat.emplace_back(idCarte, data, data + static_cast<std::int32_t>(1 + rng() % 60));
+    }
+    return rezultat;
+}
+
+bool maiDevreme(const IstoricImprumut& a, const IstoricImprumut& b) {
+    return a.dataImprumut < b.dataImprumut;
+}
+
+void verificaEgale(const std::vector<IstoricImprumut>& obtinute, const std::vector<IstoricImprumut>& asteptate) {
+    ASSERT_EQ(obtinute.size(), asteptate.size());
+    for (std::size_t i = 0; i < asteptate.size(); ++i) {
+        EXPECT_EQ(obtinute[i].idCarte, asteptate[i].idCarte) << "pozitia " << i;
+        EXPECT_EQ(obtinute[i].dataImprumut, asteptate[i].dataImprumut) << "pozitia " << i;
+        EXPECT_EQ(obtinute[i].dataReturnare, asteptate[i].dataReturnare) << "pozitia " << i;
+    }
+}
+
+// Aceleași interogări pe istoric și pe vectorul de referință, ordonat după data împrumutului
+void verificaInterogari(const IstoricImprumuturi& istoric, const std::vector<IstoricImprumut>& referinta) {
+    ASSERT_EQ(istoric.numar(), referinta.size());
+
+    std::vector<IstoricImprumut> tot;
+    istoric.citeste(0, referinta.size(), tot);
+    verificaEgale(tot, referinta);
+
+    const auto primaDupa = [&](DataZi data) {
+        return std::partition_point(referinta.begin(), referinta.end(), [data](const IstoricImprumut& i) { return i.dataImprumut < data; });
+    };
+    const DataZi de = inceput + 100;
+    const DataZi pana = inceput + 400;
+    EXPECT_EQ(istoric.pozitie(de), static_cast<std::size_t>(primaDupa(de) - referinta.begin()));
+    verificaEgale(istoric.intre(de, pana), {primaDupa(de), primaDupa(pana + 1)});
+    verificaEgale(istoric.intre(pana, de), {});
+
+    verificaEgale(istoric.ultimele(5), {referinta.end() - 5, referinta.end()});
+    verificaEgale(istoric.ultimele(referinta.size() + 10), referinta);
+}
+
+} // namespace
+
+TEST(IstoricImprumuturi, RefaceImprumuturileDinBlocuriComprimate) {
+    const auto referinta = genereaza(10 * IstoricImprumuturi::dimensiuneBloc + 37, 1);
+    IstoricImprumuturi istoric;
+    for (const auto& imprumut : referinta) {
+        istoric.adauga(imprumut);
+    }
+    verificaInterogari(istoric, referinta);
+    // Comprimarea chiar câștigă față de 12 octeți pe împrumut
+    EXPECT_LT(istoric.octetiInMemorie(), referinta.size() * sizeof(IstoricImprumut));
+}
+
+TEST(IstoricImprumuturi, InsereazaImprumutIntarziatInBlocSigilat) {
+    auto referinta = genereaza(4 * IstoricImprumuturi::dimensiuneBloc, 2);
+    IstoricImprumuturi istoric;
+    for (const auto& imprumut : referinta) {
+        istoric.adauga(imprumut);
+    }
+    // Un împrumut din primul bloc, adăugat după ce blocul a fost comprimat
+    const IstoricImprumut tarziu(7, inceput + 5, inceput + 20);
+    istoric.adauga(tarziu);
+    referinta.insert(std::upper_bound(referinta.begin(), referinta.end(), tarziu, maiDevreme), tarziu);
+
+    ASSERT_EQ(istoric.numar(), referinta.size());
+    // La date egale ordinea dintre împrumuturi nu e fixată, deci se compară doar mulțimea din ziua lui
+    const auto inZi = istoric.intre(tarziu.dataImprumut, tarziu.dataImprumut);
+    EXPECT_TRUE(std::any_of(inZi.begin(), inZi.end(), [&](const IstoricImprumut& i) {
+        return i.idCarte == tarziu.idCarte && i.dataReturnare == tarziu.dataReturnare;
+    }));
+    EXPECT_EQ(istoric.pozitie(tarziu.dataImprumut + 1),
+              static_cast<std::size_t>(std::upper_bound(referinta.begin(), referinta.end(), tarziu, maiDevreme) - referinta.begin()));
+
+    std::vector<IstoricImprumut> tot;
+    istoric.citeste(0, istoric.numar(), tot);
+    EXPECT_TRUE(std::is_sorted(tot.begin(), tot.end(), maiDevreme));
+}
+
+TEST(IstoricImprumuturi, CitesteBlocurileReciDinArhiva) {
+    const auto cale = std::filesystem::temp_directory_path() / "biblioteca_test_istoric.tmp";
+    IstoricImprumuturi::folosesteArhiva(std::make_shared<ArhivaIstoric>(cale.string()));
+    {
+        const auto referinta = genereaza(8 * IstoricImprumuturi::dimensiuneBloc + 5, 3);
+        IstoricImprumuturi istoric;
+        for (const auto& imprumut : referinta) {
+            istoric.adauga(imprumut);
+        }
+        verificaInterogari(istoric, referinta);
+        // Doar ultimele blocuri și coada rămân în memorie
+        EXPECT_LE(istoric.octetiInMemorie(),
+                  (IstoricImprumuturi::blocuriCalde + 1) * IstoricImprumuturi::dimensiuneBloc * sizeof(IstoricImprumut));
+    }
+    IstoricImprumuturi::folosesteArhiva(nullptr);
+}
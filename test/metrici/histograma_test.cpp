@@ -0,0 +1,17 @@
+#include <gtest/gtest.h>
+#include "HistogramaLatente.h"
+
+#include <cstdint>
+
+TEST(HistogramaLatente, NumaraValorileEgaleCuLimita) {
+    HistogramaLatente histograma;
+    for (const std::uint64_t valoare : {0, 1, 2, 127, 128, 129, 1024, 1025}) {
+        histograma.inregistreaza(valoare);
+    }
+    EXPECT_EQ(histograma.numarCelMult(1), 2u);
+    EXPECT_EQ(histograma.numarCelMult(2), 3u);
+    EXPECT_EQ(histograma.numarCelMult(128), 5u);
+    EXPECT_EQ(histograma.numarCelMult(1024), 7u);
+    EXPECT_EQ(histograma.numarCelMult(std::uint64_t{1} << 40), 8u);
+    EXPECT_EQ(histograma.percentila(1), 1025u);
+}
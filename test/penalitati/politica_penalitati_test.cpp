@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "Exceptii.h"
+#include "PoliticaPenalitati.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+
+// Fișier de reguli temporar, șters la final
+class FisierReguli {
+private:
+    std::filesystem::path cale;
+
+public:
+    FisierReguli(const std::string& nume, const std::string& continut)
+        : cale(std::filesystem::temp_directory_path() / ("biblioteca_test_" + nume + ".txt")) {
+        std::ofstream(cale) << continut;
+    }
+    ~FisierReguli() { std::filesystem::remove(cale); }
+
+    [[nodiscard]] std::string str() const { return cale.string(); }
+};
+
+// Mesajul excepției aruncate la încărcare; gol dacă fișierul e valid
+std::string eroareLaIncarcare(const FisierReguli& fisier) {
+    try {
+        (void)TabelPenalitati::incarca(fisier.str());
+    } catch (const ImportException& e) {
+        return e.what();
+    }
+    return {};
+}
+
+} // namespace
+
+TEST(PoliticaPenalitati, TabelulImplicitUrmeazaPoliticile) {
+    const auto tabel = TabelPenalitati::implicit();
+    for (const auto utilizator : {TipUtilizator::Student, TipUtilizator::Profesor}) {
+        EXPECT_EQ(tabel.rata(TipCarte::Fizica, StareCarte::Buna, utilizator), 10);
+        EXPECT_EQ(tabel.rata(TipCarte::Fizica, StareCarte::Uzata, utilizator), 20);
+        EXPECT_EQ(tabel.rata(TipCarte::Digitala, StareCarte::Buna, utilizator), 5);
+        EXPECT_EQ(tabel.rata(TipCarte::Generica, StareCarte::Uzata, utilizator), 5);
+    }
+    EXPECT_EQ(tabel.getZileGratie(), PoliticaIntarziere::zileGratie);
+    EXPECT_EQ(tabel.penalitate(14, 10), 0);
+    EXPECT_EQ(tabel.penalitate(15, 10), 10);
+}
+
+TEST(PoliticaPenalitati, RegulileSeAplicaInOrdinePesteImplicit) {
+    const FisierReguli fisier("reguli_valide", "# tarife de proba\n"
+                                               "\n"
+                                               "gratie 7\n"
+                                               "Digitala * * 5.5\n"
+                                               "* uzata Profesor 30\n"
+                                               "   Fizica   uzata   Profesor   25  \n");
+    const auto tabel = TabelPenalitati::incarca(fisier.str());
+    EXPECT_EQ(tabel.getZileGratie(), 7);
+    EXPECT_EQ(tabel.penalitate(10, 2), 6);
+    EXPECT_EQ(tabel.rata(TipCarte::Digitala, StareCarte::Buna, TipUtilizator::Student), 5.5);
+    EXPECT_EQ(tabel.rata(TipCarte::Digitala, StareCarte::Uzata, TipUtilizator::Profesor), 30);
+    EXPECT_EQ(tabel.rata(TipCarte::Generica, StareCarte::Uzata, TipUtilizator::Profesor), 30);
+    EXPECT_EQ(tabel.rata(TipCarte::Fizica, StareCarte::Uzata, TipUtilizator::Profesor), 25);
+    // Neatinse de reguli
+    EXPECT_EQ(tabel.rata(TipCarte::Fizica, StareCarte::Uzata, TipUtilizator::Student), 20);
+    EXPECT_EQ(tabel.rata(TipCarte::Fizica, StareCarte::Buna, TipUtilizator::Profesor), 10);
+}
+
+TEST(PoliticaPenalitati, EroarileIndicaLinia) {
+    const struct {
+        const char* nume;
+        const char* continut;
+        const char* linie;
+    } cazuri[] = {
+        {"campuri_lipsa", "gratie 7\nFizica uzata 20\n", ":2: "},
+        {"rata_negativa", "# comentariu\n\nFizica buna Student -1\n", ":3: "},
+        {"rata_cu_sufix", "Fizica buna Student 12lei\n", ":1: "},
+        {"tip_necunoscut", "gratie 3\nFizica buna Student 12\nAudio * * 4\n", ":3: "},
+        {"stare_necunoscuta", "Fizica noua Student 12\n", ":1: "},
+        {"gratie_invalida", "gratie\n", ":1: "},
+        {"gratie_in_plus", "gratie 7 zile\n", ":1: "},
+    };
+    for (const auto& caz : cazuri) {
+        const FisierReguli fisier(caz.nume, caz.continut);
+        const std::string eroare = eroareLaIncarcare(fisier);
+        EXPECT_TRUE(eroare.starts_with(fisier.str() + caz.linie)) << caz.nume << ": " << eroare;
+    }
+}
+
+TEST(PoliticaPenalitati, FisierLipsa) {
+    EXPECT_THROW((void)TabelPenalitati::incarca("/nu/exista/reguli.txt"), ImportException);
+}
@@ -0,0 +1,290 @@
+#include <gtest/gtest.h>
+#include "Biblioteca.h"
+#include "CatalogCarti.h"
+#include "JurnalOperatii.h"
+#include "Persistenta.h"
+#include "Snapshot.h"
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Director temporar, șters la final
+class DirectorTest {
+private:
+    std::filesystem::path cale;
+
+public:
+    explicit DirectorTest(const std::string& nume)
+        : cale(std::filesystem::temp_directory_path() / ("biblioteca_test_" + nume)) {
+        std::filesystem::remove_all(cale);
+        std::filesystem::create_directories(cale);
+    }
+    ~DirectorTest() { std::filesystem::remove_all(cale); }
+
+    [[nodiscard]] std::string fisier(const std::string& nume) const { return (cale / nume).string(); }
+    [[nodiscard]] std::string str() const { return cale.string(); }
+};
+
+void umpleCatalog(CatalogCarti& catalog) {
+    catalog.adauga(RandCarte{TipCarte::Fizica, "Ion", "Liviu Rebreanu", 1920, 420, 0, "buna"});
+    catalog.adauga(RandCarte{TipCarte::Digitala, "Enigma Otiliei", "George Calinescu", 1938, 0, 2.5f, "EPUB"});
+    catalog.adauga(RandCarte{TipCarte::Fizica, "Padurea spanzuratilor", "Liviu Rebreanu", 1922, 310, 0, "uzata"});
+}
+
+void scrieCatalog(const CatalogCarti& catalog, const std::string& cale, std::uint64_t secventa = 0) {
+    ScriitorSnapshot snapshot(cale);
+    catalog.salveaza(snapshot);
+    snapshot.finalizeaza(secventa);
+}
+
+std::vector<char> citesteFisier(const std::string& cale) {
+    std::ifstream intrare(cale, std::ios::binary);
+    return {std::istreambuf_iterator<char>(intrare), std::istreambuf_iterator<char>()};
+}
+
+void scrieFisier(const std::string& cale, const std::vector<char>& continut) {
+    std::ofstream iesire(cale, std::ios::binary | std::ios::trunc);
+    iesire.write(continut.data(), static_cast<std::streamsize>(continut.size()));
+}
+
+// Modifică pe loc octeții unei secțiuni, găsită prin tabelul de secțiuni din fișier
+void modificaSectiune(const std::string& cale, Sectiune id, const std::function<void(char*, std::size_t)>& modificare) {
+    auto continut = citesteFisier(cale);
+    AntetSnapshot antet{};
+    std::memcpy(&antet, continut.data(), sizeof(antet));
+    for (std::uint32_t i = 0; i < antet.numarSectiuni; ++i) {
+        IntrareSectiune intrare{};
+        std::memcpy(&intrare, continut.data() + antet.offsetTabel + i * sizeof(IntrareSectiune), sizeof(intrare));
+        if (intrare.id == id) {
+            modificare(continut.data() + intrare.offset, intrare.dimensiune);
+            scrieFisier(cale, continut);
+            return;
+        }
+    }
+    FAIL() << "Sectiune lipsa";
+}
+
+void incarcaCatalog(const std::string& cale) {
+    const CititorSnapshot snapshot(cale);
+    CatalogCarti catalog;
+    catalog.incarca(snapshot);
+}
+
+} // namespace
+
+TEST(Snapshot, CatalogulSeRefaceIdentic) {
+    const DirectorTest director("snapshot_identic");
+    CatalogCarti original;
+    umpleCatalog(original);
+    scrieCatalog(original, director.fisier("snapshot.bin"), 42);
+
+    const CititorSnapshot snapshot(director.fisier("snapshot.bin"));
+    EXPECT_EQ(snapshot.getSecventaJurnal(), 42u);
+    CatalogCarti incarcat;
+    incarcat.incarca(snapshot);
+
+    ASSERT_EQ(incarcat.size(), original.size());
+    for (IdCarte id = 0; id < original.size(); ++id) {
+        EXPECT_EQ(incarcat[id].getTitlu(), original[id].getTitlu());
+        EXPECT_EQ(incarcat[id].getAutor(), original[id].getAutor());
+        EXPECT_EQ(incarcat[id].getAnPublicare(), original[id].getAnPublicare());
+        EXPECT_EQ(incarcat[id].getTip(), original[id].getTip());
+        EXPECT_EQ(incarcat[id].getNumarPagini(), original[id].getNumarPagini());
+        EXPECT_EQ(incarcat[id].getDimensiuneFisier(), original[id].getDimensiuneFisier());
+        EXPECT_EQ(incarcat[id].getStare(), original[id].getStare());
+        EXPECT_EQ(incarcat[id].getFormat(), original[id].getFormat());
+    }
+    EXPECT_EQ(incarcat.cautaDupaAutor("Liviu Rebreanu"), (std::vector<IdCarte>{0, 2}));
+
+    // Coloanele mapate se copiază la prima modificare, fără să atingă fișierul
+    incarcat.adauga(RandCarte{TipCarte::Fizica, "Baltagul", "Mihail Sadoveanu", 1930, 200, 0, "buna"});
+    EXPECT_EQ(incarcat.size(), 4u);
+    EXPECT_EQ(incarcat[0].getTitlu(), "Ion");
+}
+
+TEST(Snapshot, RespingeIdDeAutorInAfaraPoolului) {
+    const DirectorTest director("snapshot_autor");
+    CatalogCarti catalog;
+    umpleCatalog(catalog);
+    scrieCatalog(catalog, director.fisier("snapshot.bin"));
+    modificaSectiune(director.fisier("snapshot.bin"), Sectiune::CartiAutor, [](char* date, std::size_t) {
+        const std::uint32_t invalid = 1000;
+        std::memcpy(date, &invalid, sizeof(invalid));
+    });
+    EXPECT_THROW(incarcaCatalog(director.fisier("snapshot.bin")), PersistentaException);
+}
+
+TEST(Snapshot, RespingeInceputuriDeSiruriInvalide) {
+    const DirectorTest director("snapshot_siruri");
+    CatalogCarti catalog;
+    umpleCatalog(catalog);
+    scrieCatalog(catalog, director.fisier("descrescator.bin"));
+    scrieCatalog(catalog, director.fisier("depasit.bin"));
+
+    modificaSectiune(director.fisier("descrescator.bin"), Sectiune::TitluriInceputuri, [](char* date, std::size_t) {
+        const std::uint64_t inapoi = 0;
+        std::memcpy(date + 2 * sizeof(std::uint64_t), &inapoi, sizeof(inapoi));
+    });
+    modificaSectiune(director.fisier("depasit.bin"), Sectiune::TitluriInceputuri, [](char* date, std::size_t dimensiune) {
+        const std::uint64_t departe = 1u << 30;
+        std::memcpy(date + dimensiune - sizeof(std::uint64_t), &departe, sizeof(departe));
+    });
+    EXPECT_THROW(incarcaCatalog(director.fisier("descrescator.bin")), PersistentaException);
+    EXPECT_THROW(incarcaCatalog(director.fisier("depasit.bin")), PersistentaException);
+}
+
+TEST(Snapshot, RespingeFisierTrunchiatSauDeAltaVersiune) {
+    const DirectorTest director("snapshot_trunchiat");
+    CatalogCarti catalog;
+    umpleCatalog(catalog);
+    scrieCatalog(catalog, director.fisier("snapshot.bin"));
+    const auto continut = citesteFisier(director.fisier("snapshot.bin"));
+
+    scrieFisier(director.fisier("trunchiat.bin"), {continut.begin(), continut.begin() + static_cast<std::ptrdiff_t>(continut.size() / 2)});
+    EXPECT_THROW(incarcaCatalog(director.fisier("trunchiat.bin")), PersistentaException);
+
+    auto vechi = continut;
+    const std::uint32_t versiuneVeche = AntetSnapshot::versiuneCurenta - 1;
+    std::memcpy(vechi.data() + offsetof(AntetSnapshot, versiune), &versiuneVeche, sizeof(versiuneVeche));
+    scrieFisier(director.fisier("vechi.bin"), vechi);
+    EXPECT_THROW(incarcaCatalog(director.fisier("vechi.bin")), PersistentaException);
+}
+
+TEST(Jurnal, TaieInregistrareaScrisaPeJumatate) {
+    const DirectorTest director("jurnal_taiat");
+    const std::string cale = director.fisier("jurnal.wal");
+    {
+        JurnalOperatii jurnal(cale);
+        for (std::uint32_t i = 1; i <= 3; ++i) {
+            ScriitorOperatie operatie;
+            operatie.scrie(i).scrieSir("carte " + std::to_string(i));
+            jurnal.scrie(TipOperatie::ExemplareSetate, operatie.continut());
+        }
+    }
+    // Crash în timpul ultimei scrieri: lipsesc ultimii octeți
+    std::filesystem::resize_file(cale, std::filesystem::file_size(cale) - 3);
+
+    {
+        JurnalOperatii jurnal(cale);
+        const auto recuperate = jurnal.preiaRecuperate();
+        ASSERT_EQ(recuperate.size(), 2u);
+        for (std::uint32_t i = 0; i < recuperate.size(); ++i) {
+            EXPECT_EQ(recuperate[i].secventa, i + 1);
+            EXPECT_EQ(recuperate[i].tip, TipOperatie::ExemplareSetate);
+            CititorOperatie cititor(recuperate[i].continut);
+            EXPECT_EQ(cititor.citeste<std::uint32_t>(), i + 1);
+            EXPECT_EQ(cititor.citesteSir(), "carte " + std::to_string(i + 1));
+        }
+        // Jurnalul continuă după ultima înregistrare validă, nu după cea tăiată
+        ScriitorOperatie operatie;
+        operatie.scrie(std::uint32_t{4});
+        EXPECT_EQ(jurnal.scrie(TipOperatie::ExemplareSetate, operatie.continut()), 3u);
+    }
+
+    JurnalOperatii jurnal(cale);
+    const auto recuperate = jurnal.preiaRecuperate();
+    ASSERT_EQ(recuperate.size(), 3u);
+    EXPECT_EQ(recuperate.back().secventa, 3u);
+}
+
+// BibliotecaSingleton există o singură dată pe proces, deci fiecare "rulare" e un proces copil:
+// prima lucrează și se oprește brusc (fără snapshot final), a doua reface starea din director
+TEST(Persistenta, RefaceStareaDupaCrashDinSnapshotSiJurnal) {
+    const DirectorTest director("persistenta_crash");
+
+    EXPECT_EXIT(
+        {
+            auto& biblioteca = BibliotecaSingleton::getInstance();
+            std::vector<std::shared_ptr<Utilizator>> utilizatori;
+            std::vector<std::shared_ptr<ImprumutAbstract>> imprumuturi;
+            Persistenta persistenta(director.str());
+            persistenta.recupereaza(biblioteca, utilizatori, imprumuturi);
+
+            utilizatori.push_back(UtilizatorFactory::creareUtilizator(TipUtilizator::Student, "Ana Pop", "ana.crash@test.ro", "FMI"));
+            persistenta.utilizatorAdaugat(*utilizatori.back());
+            const IdCarte ion = biblioteca.adaugaCarte(std::make_shared<CarteFizica>("Ion", "Liviu Rebreanu", 1920, 420, "buna"));
+            persistenta.carteAdaugata(biblioteca.getCarte(ion));
+            persistenta.salveaza(biblioteca, utilizatori, imprumuturi);
+
+            // După snapshot: doar în jurnal
+            const IdCarte enigma = biblioteca.adaugaCarte(std::make_shared<CarteFizica>("Enigma Otiliei", "George Calinescu", 1938, 300, "buna"));
+            persistenta.carteAdaugata(biblioteca.getCarte(enigma));
+            auto imprumut = biblioteca.imprumuta(enigma, *utilizatori.back(), DataZi::dinCalendar(2024, 3, 1), DataZi::dinCalendar(2024, 3, 15));
+            persistenta.imprumutCreat(*imprumut);
+            biblioteca.returneaza(*imprumut);
+            persistenta.imprumutReturnat(*imprumut);
+            std::_Exit(0);
+        },
+        ::testing::ExitedWithCode(0), "");
+
+    EXPECT_EXIT(
+        {
+            auto& biblioteca = BibliotecaSingleton::getInstance();
+            std::vector<std::shared_ptr<Utilizator>> utilizatori;
+            std::vector<std::shared_ptr<ImprumutAbstract>> imprumuturi;
+            Persistenta persistenta(director.str());
+            const auto reaplicate = persistenta.recupereaza(biblioteca, utilizatori, imprumuturi);
+
+            const auto enigma = biblioteca.cautaCarte("Enigma Otiliei");
+            const bool corect = reaplicate == 3 && biblioteca.getCarti().size() == 2 && utilizatori.size() == 1
+                             && imprumuturi.size() == 1 && imprumuturi[0]->esteReturnat() && enigma
+                             && imprumuturi[0]->getIdCarte() == enigma->id
+                             && biblioteca.getInventar().disponibile(enigma->id) == 1;
+            std::_Exit(corect ? 0 : 1);
+        },
+        ::testing::ExitedWithCode(0), "");
+}
+
+// Ceasul planificatorului vine din snapshot: după repornire se raportează doar împrumuturile
+// expirate dar încă neraportate la salvare, nu și cele raportate înainte
+TEST(Persistenta, PastreazaCeasulIntarzierilorInSnapshot) {
+    const DirectorTest director("persistenta_ceas");
+    const DataZi inceput = DataZi::dinCalendar(2024, 3, 1);
+    const DataZi ceas = inceput + 100;
+
+    EXPECT_EXIT(
+        {
+            auto& biblioteca = BibliotecaSingleton::getInstance();
+            std::vector<std::shared_ptr<Utilizator>> utilizatori;
+            std::vector<std::shared_ptr<ImprumutAbstract>> imprumuturi;
+            Persistenta persistenta(director.str());
+            persistenta.recupereaza(biblioteca, utilizatori, imprumuturi);
+
+            utilizatori.push_back(UtilizatorFactory::creareUtilizator(TipUtilizator::Student, "Ana Pop", "ana.ceas@test.ro", "FMI"));
+            const IdCarte ion = biblioteca.adaugaCarte(std::make_shared<CarteFizica>("Ion", "Liviu Rebreanu", 1920, 420, "buna"));
+            biblioteca.seteazaExemplare(ion, 2);
+            imprumuturi.push_back(biblioteca.imprumuta(ion, *utilizatori.back(), inceput, inceput + 14));
+            const bool raportat = biblioteca.getIntarzieri().avanseaza(ceas).imprumuturi.size() == 1;
+            // Antedatat după avansare: de raportat la următoarea
+            imprumuturi.push_back(biblioteca.imprumuta(ion, *utilizatori.back(), inceput + 10, inceput + 24));
+            persistenta.salveaza(biblioteca, utilizatori, imprumuturi);
+            std::_Exit(raportat ? 0 : 1);
+        },
+        ::testing::ExitedWithCode(0), "");
+
+    EXPECT_EXIT(
+        {
+            auto& biblioteca = BibliotecaSingleton::getInstance();
+            std::vector<std::shared_ptr<Utilizator>> utilizatori;
+            std::vector<std::shared_ptr<ImprumutAbstract>> imprumuturi;
+            Persistenta persistenta(director.str());
+            persistenta.recupereaza(biblioteca, utilizatori, imprumuturi);
+
+            auto& intarzieri = biblioteca.getIntarzieri();
+            const bool ceasRestaurat = intarzieri.getData() == ceas && intarzieri.numarIntarziate() == 1;
+            const auto lot = intarzieri.avanseaza(ceas + 1);
+            const bool corect = ceasRestaurat && imprumuturi.size() == 2 && lot.imprumuturi.size() == 1
+                             && lot.imprumuturi[0]->getDataImprumut() == inceput + 10 && intarzieri.numarIntarziate() == 2;
+            std::_Exit(corect ? 0 : 1);
+        },
+        ::testing::ExitedWithCode(0), "");
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include "CatalogCarti.h"
+#include "Exceptii.h"
+#include "PlanificatorIntarzieri.h"
+#include "PoliticaPenalitati.h"
+#include "Utilizator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+class Planificator : public testing::Test {
+protected:
+    CatalogCarti catalog;
+    IdCarte carte = catalog.adauga(CarteFizica("Titlu", "Autor", 2000, 10, "buna"));
+    Student student{"Student", "planificator@test.ro", "Facultate"};
+
+    // Un împrumut a cărui primă zi de întârziere e `expirare`
+    std::shared_ptr<ImprumutAbstract> expiraLa(std::int32_t expirare) {
+        const std::int32_t data = expirare - static_cast<std::int32_t>(TabelPenalitati::curent().getZileGratie()) - 1;
+        return ImprumutFactory::creareImprumut(catalog[carte], student, DataZi(data), DataZi(data + 14));
+    }
+};
+
+} // namespace
+
+// Fiecare expirare e raportată exact în ziua ei, nici cu o zi înainte, inclusiv pe marginile
+// nivelurilor (64, 4096 de zile) și pentru cele din heap (peste 64^3 zile)
+TEST_F(Planificator, RaporteazaExpirareaExactInZiuaEi) {
+    const std::int32_t inceput = 1000;
+    constexpr std::int32_t roata = 1 << (3 * PlanificatorIntarzieri::bitiNivel);
+    PlanificatorIntarzieri planificator{DataZi(inceput)};
+
+    std::vector<std::int32_t> expirari{inceput, inceput + 1};
+    for (const std::int32_t margine : {64, 4096, roata, 2 * roata}) {
+        const std::int32_t aliniata = (inceput + margine) & ~(margine - 1);
+        for (const std::int32_t delta : {-1, 0, 1}) {
+            expirari.push_back(aliniata + delta);
+        }
+    }
+    expirari.push_back(inceput + 5 * roata + 12345);
+    std::sort(expirari.begin(), expirari.end());
+    expirari.erase(std::unique(expirari.begin(), expirari.end()), expirari.end());
+
+    std::vector<std::shared_ptr<ImprumutAbstract>> imprumuturi;
+    for (const auto expirare : expirari) {
+        imprumuturi.push_back(expiraLa(expirare));
+        planificator.adauga(imprumuturi.back());
+    }
+    ASSERT_EQ(planificator.numarProgramate(), expirari.size());
+
+    for (std::size_t i = 0; i < expirari.size(); ++i) {
+        EXPECT_TRUE(planificator.avanseaza(DataZi(expirari[i] - 1)).imprumuturi.empty()) << "ziua " << expirari[i] - 1;
+        const auto lot = planificator.avanseaza(DataZi(expirari[i]));
+        ASSERT_EQ(lot.imprumuturi.size(), 1u) << "ziua " << expirari[i];
+        EXPECT_EQ(lot.imprumuturi[0], imprumuturi[i]);
+        EXPECT_EQ(planificator.getData(), DataZi(expirari[i]));
+    }
+    EXPECT_EQ(planificator.numarProgramate(), 0u);
+    EXPECT_EQ(planificator.numarIntarziate(), expirari.size());
+}
+
+TEST_F(Planificator, SareImprumuturileReturnate) {
+    PlanificatorIntarzieri planificator{DataZi(0)};
+    const auto returnat = expiraLa(100);
+    const auto deschis = expiraLa(100);
+    const auto returnatDupa = expiraLa(5000);
+    for (const auto& imprumut : {returnat, deschis, returnatDupa}) {
+        planificator.adauga(imprumut);
+    }
+    returnat->marcheazaReturnat();
+
+    auto lot = planificator.avanseaza(DataZi(200));
+    ASSERT_EQ(lot.imprumuturi.size(), 1u);
+    EXPECT_EQ(lot.imprumuturi[0], deschis);
+
+    // Returnat după ce a intrat în roata de nivel 1, înainte de coborâre
+    returnatDupa->marcheazaReturnat();
+    EXPECT_TRUE(planificator.avanseaza(DataZi(10'000)).imprumuturi.empty());
+    EXPECT_EQ(planificator.numarProgramate(), 0u);
+
+    // Lista celor întârziate pierde împrumuturile returnate la acumulare
+    deschis->marcheazaReturnat();
+    EXPECT_EQ(planificator.acumuleazaPenalitati().imprumuturi, 0u);
+    EXPECT_EQ(planificator.numarIntarziate(), 0u);
+}
+
+TEST_F(Planificator, RefuzaDateleInapoi) {
+    PlanificatorIntarzieri planificator{DataZi(500)};
+    planificator.avanseaza(DataZi(800));
+    EXPECT_THROW(planificator.avanseaza(DataZi(799)), ImprumutException);
+    EXPECT_NO_THROW(planificator.avanseaza(DataZi(800)));
+
+    // O expirare deja trecută e raportată la următoarea avansare
+    const auto tarziu = expiraLa(10);
+    planificator.adauga(tarziu);
+    const auto lot = planificator.avanseaza(DataZi(800));
+    ASSERT_EQ(lot.imprumuturi.size(), 1u);
+    EXPECT_EQ(lot.imprumuturi[0], tarziu);
+}
+
+// Avansări și adăugări amestecate, cu salturi de la o zi la peste o roată întreagă, comparate
+// cu o parcurgere a tuturor împrumuturilor
+TEST_F(Planificator, CoincideCuParcurgereaCompleta) {
+    std::mt19937 rng(7);
+    const auto aleator = [&](std::int32_t limita) { return static_cast<std::int32_t>(rng() % static_cast<std::uint32_t>(limita)); };
+    for (int runda = 0; runda < 20; ++runda) {
+        const std::int32_t inceput = aleator(300'000) - 5000;
+        PlanificatorIntarzieri planificator{DataZi(inceput)};
+        std::int32_t ceas = inceput - 1;
+        std::vector<std::pair<std::int32_t, std::shared_ptr<ImprumutAbstract>>> toate;
+        std::set<const ImprumutAbstract*> raportate;
+
+        for (int pas = 0; pas < 300; ++pas) {
+            const int operatie = aleator(10);
+            if (operatie < 6) {
+                const int tip = aleator(10);
+                const std::int32_t expirare = tip < 6 ? ceas - 20 + aleator(200)
+                                            : tip < 8 ? ceas + aleator(10'000)
+                                            : tip < 9 ? ceas + aleator(600'000)
+                                                      : ceas - aleator(1000);
+                toate.emplace_back(expirare, expiraLa(expirare));
+                if (aleator(5) == 0) {
+                    toate.back().second->marcheazaReturnat();
+                }
+                planificator.adauga(toate.back().second);
+            } else if (operatie < 7 && !toate.empty()) {
+                toate[static_cast<std::size_t>(aleator(static_cast<std::int32_t>(toate.size())))].second->marcheazaReturnat();
+            } else {
+                const int tip = aleator(10);
+                const std::int32_t nou = ceas + (tip < 7 ? aleator(5) : tip < 9 ? aleator(3000) : aleator(800'000));
+                std::set<const ImprumutAbstract*> asteptate;
+                for (const auto& [expirare, imprumut] : toate) {
+                    if (expirare <= nou && !imprumut->esteReturnat() && !raportate.contains(imprumut.get())) {
+                        asteptate.insert(imprumut.get());
+                    }
+                }
+                const auto lot = planificator.avanseaza(DataZi(nou));
+                std::set<const ImprumutAbstract*> primite;
+                for (const auto& imprumut : lot.imprumuturi) {
+                    primite.insert(imprumut.get());
+                }
+                ASSERT_EQ(primite, asteptate) << "runda " << runda << ", pasul " << pas;
+                // Returnate înainte de expirare: nu mai pot fi raportate
+                for (const auto& [expirare, imprumut] : toate) {
+                    if (expirare <= nou) {
+                        raportate.insert(imprumut.get());
+                    }
+                }
+                ceas = nou;
+                ASSERT_EQ(planificator.getData(), DataZi(ceas));
+            }
+        }
+    }
+}
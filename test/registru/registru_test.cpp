@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include "RegistruUtilizatori.h"
+#include "Utilizator.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::shared_ptr<Utilizator> student(const std::string& email) {
+    return std::make_shared<Student>("Student", email, "FMI");
+}
+
+} // namespace
+
+TEST(RegistruUtilizatori, PastreazaPrimulUtilizatorCuUnEmail) {
+    RegistruUtilizatori registru;
+    const auto primul = student("ana@test.ro");
+    EXPECT_TRUE(registru.adauga(primul));
+    EXPECT_FALSE(registru.adauga(student("ana@test.ro")));
+    EXPECT_TRUE(registru.adauga(student("dan@test.ro")));
+
+    EXPECT_EQ(registru.cauta("ana@test.ro"), primul);
+    EXPECT_EQ(registru.cauta("nimeni@test.ro"), nullptr);
+    EXPECT_EQ(registru.size(), 2u);
+
+    EXPECT_TRUE(registru.sterge("ana@test.ro"));
+    EXPECT_FALSE(registru.sterge("ana@test.ro"));
+    EXPECT_EQ(registru.cauta("ana@test.ro"), nullptr);
+    EXPECT_EQ(registru.size(), 1u);
+}
+
+// Fire care adaugă emailuri suprapuse și caută în paralel: fiecare email e câștigat de un singur fir
+TEST(RegistruUtilizatori, AdaugariConcurenteCuEmailuriDuplicate) {
+    constexpr std::size_t numarFire = 8;
+    constexpr std::size_t emailuri = 5000;
+    RegistruUtilizatori registru;
+    std::atomic<std::size_t> reusite{0};
+    std::atomic<std::size_t> gasiteGresit{0};
+    {
+        std::vector<std::jthread> fire;
+        for (std::size_t fir = 0; fir < numarFire; ++fir) {
+            fire.emplace_back([&, fir] {
+                for (std::size_t i = 0; i < emailuri; ++i) {
+                    // Fiecare email e încercat de două fire
+                    const std::string email = "u" + std::to_string((i + fir / 2 * emailuri)) + "@test.ro";
+                    const auto utilizator = student(email);
+                    if (registru.adauga(utilizator)) {
+                        reusite.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    const auto gasit = registru.cauta(email);
+                    if (!gasit || gasit->getEmail() != email) {
+                        gasiteGresit.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+    }
+    EXPECT_EQ(reusite.load(), numarFire / 2 * emailuri);
+    EXPECT_EQ(registru.size(), numarFire / 2 * emailuri);
+    EXPECT_EQ(gasiteGresit.load(), 0u);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include "CatalogCarti.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::string titluCarte(std::size_t id) { return "carte " + std::to_string(id); }
+std::string autorCarte(std::size_t id) { return "autor " + std::to_string(id % 37); }
+
+void adaugaCarti(CatalogCarti& catalog, std::size_t numar) {
+    for (std::size_t i = 0; i < numar; ++i) {
+        const std::size_t id = catalog.size();
+        const std::string titlu = titluCarte(id), autor = autorCarte(id);
+        catalog.adauga(RandCarte{id % 2 ? TipCarte::Fizica : TipCarte::Digitala, titlu, autor,
+                                 static_cast<std::int32_t>(1900 + id % 100), 100, 1.5f, id % 2 ? "uzata" : "PDF"});
+    }
+}
+
+// Fiecare rând din versiune are valorile cu care a fost adăugat; false la prima diferență
+bool versiuneCorecta(const VersiuneCatalog& versiune) {
+    for (IdCarte id = 0; id < versiune.size(); ++id) {
+        const CarteView carte = versiune[id];
+        if (carte.getTitlu() != titluCarte(id) || carte.getAutor() != autorCarte(id)
+            || carte.getAnPublicare() != static_cast<int>(1900 + id % 100)
+            || carte.getTip() != (id % 2 ? TipCarte::Fizica : TipCarte::Digitala)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST(VersiuneCatalog, VersiuneaFixataNuVedeAdaugarileUlterioare) {
+    CatalogCarti catalog;
+    const auto goala = catalog.versiune();
+    ASSERT_NE(goala, nullptr);
+    EXPECT_TRUE(goala->empty());
+
+    adaugaCarti(catalog, 3);
+    EXPECT_EQ(catalog.versiune(), goala); // fără publica() nu apare o versiune nouă
+    catalog.publica();
+    const auto fixata = catalog.versiune();
+    EXPECT_EQ(fixata->getNumarVersiune(), goala->getNumarVersiune() + 1);
+    EXPECT_EQ(fixata->size(), 3u);
+
+    // Destule adăugări cât coloanele să fie realocate de mai multe ori
+    adaugaCarti(catalog, 20000);
+    catalog.publica();
+    EXPECT_EQ(fixata->size(), 3u);
+    EXPECT_TRUE(versiuneCorecta(*fixata));
+    EXPECT_EQ(fixata->titlu(2), "carte 2");
+    EXPECT_EQ(fixata->coloanaAnPublicare().size(), 3u);
+
+    const auto ultima = catalog.versiune();
+    EXPECT_EQ(ultima->getNumarVersiune(), fixata->getNumarVersiune() + 1);
+    EXPECT_EQ(ultima->size(), 20003u);
+    EXPECT_TRUE(versiuneCorecta(*ultima));
+}
+
+// Versiunea fixată rămâne întreagă și după ce catalogul care a publicat-o dispare
+TEST(VersiuneCatalog, SupravietuiesteCatalogului) {
+    std::shared_ptr<const VersiuneCatalog> fixata;
+    {
+        CatalogCarti catalog;
+        adaugaCarti(catalog, 100);
+        catalog.publica();
+        fixata = catalog.versiune();
+        adaugaCarti(catalog, 5000);
+    }
+    EXPECT_EQ(fixata->size(), 100u);
+    EXPECT_TRUE(versiuneCorecta(*fixata));
+}
+
+// Cititorii parcurg versiuni fixate în timp ce scriitorul adaugă și publică
+TEST(VersiuneCatalog, CititoriConcurentiCuScriitorul) {
+    constexpr std::size_t numarCititori = 4;
+    constexpr std::size_t loturi = 200;
+    constexpr std::size_t cartiPeLot = 50;
+    CatalogCarti catalog;
+    std::atomic<bool> gata{false};
+    std::atomic<std::size_t> versiuniGresite{0};
+    std::atomic<std::size_t> versiuniCitite{0};
+    {
+        std::vector<std::jthread> cititori;
+        for (std::size_t fir = 0; fir < numarCititori; ++fir) {
+            cititori.emplace_back([&] {
+                std::uint64_t ultimulNumar = 0;
+                std::size_t ultimaDimensiune = 0;
+                // Măcar o citire, chiar dacă scriitorul termină înainte ca firul să pornească
+                do {
+                    const auto versiune = catalog.versiune();
+                    if (versiune->getNumarVersiune() < ultimulNumar || versiune->size() < ultimaDimensiune
+                        || versiune->size() % cartiPeLot != 0 || !versiuneCorecta(*versiune)) {
+                        versiuniGresite.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    ultimulNumar = versiune->getNumarVersiune();
+                    ultimaDimensiune = versiune->size();
+                    versiuniCitite.fetch_add(1, std::memory_order_relaxed);
+                    std::this_thread::yield();
+                } while (!gata.load(std::memory_order_acquire));
+            });
+        }
+        for (std::size_t lot = 0; lot < loturi; ++lot) {
+            adaugaCarti(catalog, cartiPeLot);
+            catalog.publica(); // doar loturi întregi devin vizibile
+        }
+        gata.store(true, std::memory_order_release);
+    }
+    EXPECT_GT(versiuniCitite.load(), 0u);
+    EXPECT_EQ(versiuniGresite.load(), 0u);
+    EXPECT_EQ(catalog.versiune()->size(), loturi * cartiPeLot);
+}